@@ -14,10 +14,57 @@ long long alt_bn128_G1::add_cnt = 0;
 long long alt_bn128_G1::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> alt_bn128_G1::wnaf_window_table;
-std::vector<size_t> alt_bn128_G1::fixed_base_exp_window_table;
-alt_bn128_G1 alt_bn128_G1::G1_zero;
-alt_bn128_G1 alt_bn128_G1::G1_one;
+std::vector<size_t> alt_bn128_G1::wnaf_window_table = { 11, 24, 60, 127 };
+std::vector<size_t> alt_bn128_G1::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.99]
+    1,
+    // window 2 is unbeaten in [4.99, 10.99]
+    5,
+    // window 3 is unbeaten in [10.99, 32.29]
+    11,
+    // window 4 is unbeaten in [32.29, 55.23]
+    32,
+    // window 5 is unbeaten in [55.23, 162.03]
+    55,
+    // window 6 is unbeaten in [162.03, 360.15]
+    162,
+    // window 7 is unbeaten in [360.15, 815.44]
+    360,
+    // window 8 is unbeaten in [815.44, 2373.07]
+    815,
+    // window 9 is unbeaten in [2373.07, 6977.75]
+    2373,
+    // window 10 is unbeaten in [6977.75, 7122.23]
+    6978,
+    // window 11 is unbeaten in [7122.23, 57818.46]
+    7122,
+    // window 12 is never the best
+    0,
+    // window 13 is unbeaten in [57818.46, 169679.14]
+    57818,
+    // window 14 is never the best
+    0,
+    // window 15 is unbeaten in [169679.14, 439758.91]
+    169679,
+    // window 16 is unbeaten in [439758.91, 936073.41]
+    439759,
+    // window 17 is unbeaten in [936073.41, 4666554.74]
+    936073,
+    // window 18 is never the best
+    0,
+    // window 19 is unbeaten in [4666554.74, 7580404.42]
+    4666555,
+    // window 20 is unbeaten in [7580404.42, 34552892.20]
+    7580404,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [34552892.20, inf]
+    34552892
+};
+/* (0, 1, 0) */
+alt_bn128_G1 alt_bn128_G1::G1_zero = alt_bn128_G1(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (1, 2, 1) */
+alt_bn128_G1 alt_bn128_G1::G1_one = alt_bn128_G1(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xa6ba871b8b1e1b3a), BIGINT_LIMB64(0x14f1d651eb8e167b), BIGINT_LIMB64(0xccdd46def0f28c58), BIGINT_LIMB64(0x1c14ef83340fbe5e)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)));
 
 alt_bn128_G1::alt_bn128_G1()
 {
@@ -496,6 +543,13 @@ std::istream& operator>>(std::istream& in, std::vector<alt_bn128_G1> &v)
     return in;
 }
 
+template<>
+bool is_in_subgroup<alt_bn128_G1>(const alt_bn128_G1 &P)
+{
+    /* the curve has prime order, so all of its points lie in G1 */
+    return true;
+}
+
 template<>
 void batch_to_special_all_non_zeros<alt_bn128_G1>(std::vector<alt_bn128_G1> &vec)
 {
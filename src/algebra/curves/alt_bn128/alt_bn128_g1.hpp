@@ -35,7 +35,7 @@ public:
 
     // using Jacobian coordinates
     alt_bn128_G1();
-    alt_bn128_G1(const alt_bn128_Fq& X, const alt_bn128_Fq& Y, const alt_bn128_Fq& Z) : X(X), Y(Y), Z(Z) {};
+    constexpr alt_bn128_G1(const alt_bn128_Fq& X, const alt_bn128_Fq& Y, const alt_bn128_Fq& Z) : X(X), Y(Y), Z(Z) {};
 
     void print() const;
     void print_coordinates() const;
@@ -91,5 +91,8 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<alt_bn128_G1>(std::vector<alt_bn128_G1> &vec);
 
+template<>
+bool is_in_subgroup<alt_bn128_G1>(const alt_bn128_G1 &P);
+
 } // libsnark
 #endif // ALT_BN128_G1_HPP_
@@ -14,10 +14,57 @@ long long alt_bn128_G2::add_cnt = 0;
 long long alt_bn128_G2::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> alt_bn128_G2::wnaf_window_table;
-std::vector<size_t> alt_bn128_G2::fixed_base_exp_window_table;
-alt_bn128_G2 alt_bn128_G2::G2_zero;
-alt_bn128_G2 alt_bn128_G2::G2_one;
+std::vector<size_t> alt_bn128_G2::wnaf_window_table = { 5, 15, 39, 109 };
+std::vector<size_t> alt_bn128_G2::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 5.10]
+    1,
+    // window 2 is unbeaten in [5.10, 10.43]
+    5,
+    // window 3 is unbeaten in [10.43, 25.28]
+    10,
+    // window 4 is unbeaten in [25.28, 59.00]
+    25,
+    // window 5 is unbeaten in [59.00, 154.03]
+    59,
+    // window 6 is unbeaten in [154.03, 334.25]
+    154,
+    // window 7 is unbeaten in [334.25, 742.58]
+    334,
+    // window 8 is unbeaten in [742.58, 2034.40]
+    743,
+    // window 9 is unbeaten in [2034.40, 4987.56]
+    2034,
+    // window 10 is unbeaten in [4987.56, 8888.27]
+    4988,
+    // window 11 is unbeaten in [8888.27, 26271.13]
+    8888,
+    // window 12 is unbeaten in [26271.13, 39768.20]
+    26271,
+    // window 13 is unbeaten in [39768.20, 106275.75]
+    39768,
+    // window 14 is unbeaten in [106275.75, 141703.40]
+    106276,
+    // window 15 is unbeaten in [141703.40, 462422.97]
+    141703,
+    // window 16 is unbeaten in [462422.97, 926871.84]
+    462423,
+    // window 17 is unbeaten in [926871.84, 4873049.17]
+    926872,
+    // window 18 is never the best
+    0,
+    // window 19 is unbeaten in [4873049.17, 5706707.88]
+    4873049,
+    // window 20 is unbeaten in [5706707.88, 31673814.95]
+    5706708,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [31673814.95, inf]
+    31673815
+};
+/* ((0, 0), (1, 0), (0, 0)) */
+alt_bn128_G2 alt_bn128_G2::G2_zero = alt_bn128_G2(alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
+/* ((10857046999023057135944570762232829481370756359578518086990519993285655852781, 11559732032986387107991004021392285783925812861821192530917403151452391805634), (8495653923123431417604973247489272438418190587263600148770280649306958101930, 4082367875863433681332203403145435568316851327593401208105741076214120093531), (1, 0)) */
+alt_bn128_G2 alt_bn128_G2::G2_one = alt_bn128_G2(alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x8e83b5d102bc2026), BIGINT_LIMB64(0xdceb1935497b0172), BIGINT_LIMB64(0xfbb8264797811adf), BIGINT_LIMB64(0x19573841af96503b)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xafb4737da84c6140), BIGINT_LIMB64(0x6043dd5a5802d8c4), BIGINT_LIMB64(0x09e950fc52a02f86), BIGINT_LIMB64(0x14fef0833aea7b6b))), alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x619dfa9d886be9f6), BIGINT_LIMB64(0xfe7fd297f59e9b78), BIGINT_LIMB64(0xff9e1a62231b7dfe), BIGINT_LIMB64(0x28fd7eebae9e4206)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x64095b56c71856ee), BIGINT_LIMB64(0xdc57f922327d3cbb), BIGINT_LIMB64(0x55f935be33351076), BIGINT_LIMB64(0x0da4a0e693fd6482))), alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
 
 alt_bn128_G2::alt_bn128_G2()
 {
@@ -477,6 +524,22 @@ std::istream& operator>>(std::istream &in, alt_bn128_G2 &g)
     return in;
 }
 
+template<>
+bool is_in_subgroup<alt_bn128_G2>(const alt_bn128_G2 &P)
+{
+    /*
+      On G2, the endomorphism psi computed by mul_by_q acts as multiplication by
+      q = 6z^2 (mod r), where z = alt_bn128_final_exponent_z is the BN parameter,
+      and for BN curves psi(P) = [6z^2]P holds only on G2 (see Scott, "A note on
+      group membership tests for G1, G2 and GT on BLS pairing-friendly curves",
+      <https://eprint.iacr.org/2021/1130>). This halves the cost of the generic
+      [r]P check.
+    */
+    const alt_bn128_G2 zP = alt_bn128_final_exponent_z * P;
+    const alt_bn128_G2 two_zP = zP.dbl();
+    return (P.mul_by_q() == alt_bn128_final_exponent_z * (two_zP + two_zP.dbl()));
+}
+
 template<>
 void batch_to_special_all_non_zeros<alt_bn128_G2>(std::vector<alt_bn128_G2> &vec)
 {
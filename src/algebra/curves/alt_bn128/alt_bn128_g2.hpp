@@ -36,7 +36,7 @@ public:
 
     // using Jacobian coordinates
     alt_bn128_G2();
-    alt_bn128_G2(const alt_bn128_Fq2& X, const alt_bn128_Fq2& Y, const alt_bn128_Fq2& Z) : X(X), Y(Y), Z(Z) {};
+    constexpr alt_bn128_G2(const alt_bn128_Fq2& X, const alt_bn128_Fq2& Y, const alt_bn128_Fq2& Z) : X(X), Y(Y), Z(Z) {};
 
     static alt_bn128_Fq2 mul_by_b(const alt_bn128_Fq2 &elt);
 
@@ -92,5 +92,8 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<alt_bn128_G2>(std::vector<alt_bn128_G2> &vec);
 
+template<>
+bool is_in_subgroup<alt_bn128_G2>(const alt_bn128_G2 &P);
+
 } // libsnark
 #endif // ALT_BN128_G2_HPP_
@@ -11,263 +11,152 @@
 
 namespace libsnark {
 
-bigint<alt_bn128_r_limbs> alt_bn128_modulus_r;
-bigint<alt_bn128_q_limbs> alt_bn128_modulus_q;
-
-alt_bn128_Fq alt_bn128_coeff_b;
-alt_bn128_Fq2 alt_bn128_twist;
-alt_bn128_Fq2 alt_bn128_twist_coeff_b;
-alt_bn128_Fq alt_bn128_twist_mul_by_b_c0;
-alt_bn128_Fq alt_bn128_twist_mul_by_b_c1;
-alt_bn128_Fq2 alt_bn128_twist_mul_by_q_X;
-alt_bn128_Fq2 alt_bn128_twist_mul_by_q_Y;
-
-bigint<alt_bn128_q_limbs> alt_bn128_ate_loop_count;
-bool alt_bn128_ate_is_loop_count_neg;
-bigint<12*alt_bn128_q_limbs> alt_bn128_final_exponent;
-bigint<alt_bn128_q_limbs> alt_bn128_final_exponent_z;
-bool alt_bn128_final_exponent_is_z_neg;
+/* parameters for scalar field Fr */
+
+/* 21888242871839275222246405745257275088548364400416034343698204186575808495617 */
+bigint<alt_bn128_r_limbs> alt_bn128_modulus_r = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x43e1f593f0000001), BIGINT_LIMB64(0x2833e84879b97091), BIGINT_LIMB64(0xb85045b68181585d), BIGINT_LIMB64(0x30644e72e131a029));
+/* 944936681149208446651664254269745548490766851729442924617792859073125903783 */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::Rsquared = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x1bb8e645ae216da7), BIGINT_LIMB64(0x53fe3ab1e35c59e3), BIGINT_LIMB64(0x8c49833d53bb8085), BIGINT_LIMB64(0x0216d0b17f4e44a5));
+/* 5866548545943845227489894872040244720403868105578784105281690076696998248512 */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::Rcubed = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x5e94d8e1b4bf0040), BIGINT_LIMB64(0x2a489cbe1cfbb6b8), BIGINT_LIMB64(0x893cc664a19fcfed), BIGINT_LIMB64(0x0cf8594b7fcc657c));
+template<> mp_limb_t alt_bn128_Fr::inv = (mp_limb_t) 0xc2e1f593efffffff;
+template<> size_t alt_bn128_Fr::num_bits = 254;
+/* 10944121435919637611123202872628637544274182200208017171849102093287904247808 */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::euler = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xa1f0fac9f8000000), BIGINT_LIMB64(0x9419f4243cdcb848), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+template<> size_t alt_bn128_Fr::s = 28;
+/* 81540058820840996586704275553141814055101440848469862132140264610111 */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::t = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x9b9709143e1f593f), BIGINT_LIMB64(0x181585d2833e8487), BIGINT_LIMB64(0x131a029b85045b68), BIGINT_LIMB64(0x000000030644e72e));
+/* 40770029410420498293352137776570907027550720424234931066070132305055 */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::t_minus_1_over_2 = bigint<alt_bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xcdcb848a1f0fac9f), BIGINT_LIMB64(0x0c0ac2e9419f4243), BIGINT_LIMB64(0x098d014dc2822db4), BIGINT_LIMB64(0x0000000183227397));
+/* 5 */
+template<> alt_bn128_Fr alt_bn128_Fr::multiplicative_generator = alt_bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x1b0d0ef99fffffe6), BIGINT_LIMB64(0xeaba68a3a32a913f), BIGINT_LIMB64(0x47d8eb76d8dd0689), BIGINT_LIMB64(0x15d0085520f5bbc3));
+/* 19103219067921713944291392827692070036145651957329286315305642004821462161904 */
+template<> alt_bn128_Fr alt_bn128_Fr::root_of_unity = alt_bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x636e735580d13d9c), BIGINT_LIMB64(0xa22bf3742445ffd6), BIGINT_LIMB64(0x56452ac01eb203d8), BIGINT_LIMB64(0x1860ef942963f9e7));
+/* 5 */
+template<> alt_bn128_Fr alt_bn128_Fr::nqr = alt_bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x1b0d0ef99fffffe6), BIGINT_LIMB64(0xeaba68a3a32a913f), BIGINT_LIMB64(0x47d8eb76d8dd0689), BIGINT_LIMB64(0x15d0085520f5bbc3));
+/* 19103219067921713944291392827692070036145651957329286315305642004821462161904 */
+template<> alt_bn128_Fr alt_bn128_Fr::nqr_to_t = alt_bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x636e735580d13d9c), BIGINT_LIMB64(0xa22bf3742445ffd6), BIGINT_LIMB64(0x56452ac01eb203d8), BIGINT_LIMB64(0x1860ef942963f9e7));
+
+/* parameters for base field Fq */
+
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208583 */
+bigint<alt_bn128_q_limbs> alt_bn128_modulus_q = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x3c208c16d87cfd47), BIGINT_LIMB64(0x97816a916871ca8d), BIGINT_LIMB64(0xb85045b68181585d), BIGINT_LIMB64(0x30644e72e131a029));
+/* 3096616502983703923843567936837374451735540968419076528771170197431451843209 */
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::Rsquared = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xf32cfc5b538afa89), BIGINT_LIMB64(0xb5e71911d44501fb), BIGINT_LIMB64(0x47ab1eff0a417ff6), BIGINT_LIMB64(0x06d89f71cab8351f));
+/* 14921786541159648185948152738563080959093619838510245177710943249661917737183 */
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::Rcubed = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xb1cd6dafda1530df), BIGINT_LIMB64(0x62f210e6a7283db6), BIGINT_LIMB64(0xef7f0b0c0ada0afb), BIGINT_LIMB64(0x20fd6e902d592544));
+template<> mp_limb_t alt_bn128_Fq::inv = (mp_limb_t) 0x87d20782e4866389;
+template<> size_t alt_bn128_Fq::num_bits = 254;
+/* 10944121435919637611123202872628637544348155578648911831344518947322613104291 */
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::euler = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9e10460b6c3e7ea3), BIGINT_LIMB64(0xcbc0b548b438e546), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+template<> size_t alt_bn128_Fq::s = 1;
+/* 10944121435919637611123202872628637544348155578648911831344518947322613104291 */
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::t = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9e10460b6c3e7ea3), BIGINT_LIMB64(0xcbc0b548b438e546), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+/* 5472060717959818805561601436314318772174077789324455915672259473661306552145 */
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::t_minus_1_over_2 = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x4f082305b61f3f51), BIGINT_LIMB64(0x65e05aa45a1c72a3), BIGINT_LIMB64(0x6e14116da0605617), BIGINT_LIMB64(0x0c19139cb84c680a));
+/* 3 */
+template<> alt_bn128_Fq alt_bn128_Fq::multiplicative_generator = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a17caa950ad28d7), BIGINT_LIMB64(0x1f6ac17ae15521b9), BIGINT_LIMB64(0x334bea4e696bd284), BIGINT_LIMB64(0x2a1f6744ce179d8e));
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+template<> alt_bn128_Fq alt_bn128_Fq::root_of_unity = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa));
+/* 3 */
+template<> alt_bn128_Fq alt_bn128_Fq::nqr = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a17caa950ad28d7), BIGINT_LIMB64(0x1f6ac17ae15521b9), BIGINT_LIMB64(0x334bea4e696bd284), BIGINT_LIMB64(0x2a1f6744ce179d8e));
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+template<> alt_bn128_Fq alt_bn128_Fq::nqr_to_t = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa));
+
+/* parameters for twist field Fq2 */
+
+/* 239547588008311421220994022608339370399626158265550411218223901127035046843189118723920525909718935985594116157406550130918127817069793474323196511433944 */
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::euler = bigint<2*alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9daa2c5113aeb4d8), BIGINT_LIMB64(0x5301039684f56080), BIGINT_LIMB64(0x25280c4e36cb656e), BIGINT_LIMB64(0x82344f4abd092164), BIGINT_LIMB64(0x1376fd2e1a6359c6), BIGINT_LIMB64(0x5805c2a88b1bab03), BIGINT_LIMB64(0x2ccd37be01a4690e), BIGINT_LIMB64(0x0492e25c3b1e5fce));
+template<> size_t alt_bn128_Fq2::s = 4;
+/* 29943448501038927652624252826042421299953269783193801402277987640879380855398639840490065738714866998199264519675818766364765977133724184290399563929243 */
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::t = bigint<2*alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x13b5458a2275d69b), BIGINT_LIMB64(0xca602072d09eac10), BIGINT_LIMB64(0x84a50189c6d96cad), BIGINT_LIMB64(0xd04689e957a1242c), BIGINT_LIMB64(0x626edfa5c34c6b38), BIGINT_LIMB64(0xcb00b85511637560), BIGINT_LIMB64(0xc599a6f7c0348d21), BIGINT_LIMB64(0x00925c4b8763cbf9));
+/* 14971724250519463826312126413021210649976634891596900701138993820439690427699319920245032869357433499099632259837909383182382988566862092145199781964621 */
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::t_minus_1_over_2 = bigint<2*alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x09daa2c5113aeb4d), BIGINT_LIMB64(0xe5301039684f5608), BIGINT_LIMB64(0x425280c4e36cb656), BIGINT_LIMB64(0x682344f4abd09216), BIGINT_LIMB64(0x31376fd2e1a6359c), BIGINT_LIMB64(0xe5805c2a88b1bab0), BIGINT_LIMB64(0xe2ccd37be01a4690), BIGINT_LIMB64(0x00492e25c3b1e5fc));
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+template<> alt_bn128_Fq alt_bn128_Fq2::non_residue = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa));
+/* (2, 1) */
+template<> alt_bn128_Fq2 alt_bn128_Fq2::nqr = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xa6ba871b8b1e1b3a), BIGINT_LIMB64(0x14f1d651eb8e167b), BIGINT_LIMB64(0xccdd46def0f28c58), BIGINT_LIMB64(0x1c14ef83340fbe5e)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)));
+/* (5033503716262624267312492558379982687175200734934877598599011485707452665730, 314498342015008975724433667930697407966947188435857772134235984660852259084) */
+template<> alt_bn128_Fq2 alt_bn128_Fq2::nqr_to_t = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x801dd97687961532), BIGINT_LIMB64(0xb2fe144b3e84d778), BIGINT_LIMB64(0x936464b898f81824), BIGINT_LIMB64(0x2581f70bad99ce67)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x60b5b57507394ed9), BIGINT_LIMB64(0xf3a19577808492c9), BIGINT_LIMB64(0xd0048196eb1419ec), BIGINT_LIMB64(0x0e752acf9ba98a59)));
+template<> alt_bn128_Fq alt_bn128_Fq2::Frobenius_coeffs_c1[2] = {
+    alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), /* 1 */
+    alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa)) /* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+};
+
+/* parameters for Fq6 */
+
+/* (9, 1) */
+template<> alt_bn128_Fq2 alt_bn128_Fq6::non_residue = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xf60647ce410d7ff7), BIGINT_LIMB64(0x2f3d6f4dd31bd011), BIGINT_LIMB64(0x2943337e3940c6d1), BIGINT_LIMB64(0x1d9598e8a7e39857)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)));
+template<> alt_bn128_Fq2 alt_bn128_Fq6::Frobenius_coeffs_c1[6] = {
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (1, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xb5773b104563ab30), BIGINT_LIMB64(0x347f91c8a9aa6454), BIGINT_LIMB64(0x7a007127242e0991), BIGINT_LIMB64(0x1956bcd8118214ec)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x6e849f1ea0aa4757), BIGINT_LIMB64(0xaa1c7b6d89f89141), BIGINT_LIMB64(0xb6e713cdfae0ca3a), BIGINT_LIMB64(0x26694fbb4e82ebc3))), /* (21575463638280843010398324269430826099269044274347216827212613867836435027261, 10307601595873709700152284273816112264069230130616436755625194854815875713954) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x3350c88e13e80b9c), BIGINT_LIMB64(0x7dce557cdb5e56b9), BIGINT_LIMB64(0x6001b4b8b615564a), BIGINT_LIMB64(0x2682e617020217e0)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (21888242871839275220042445260109153167277707414472061641714758635765020556616, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xc9af22f716ad6bad), BIGINT_LIMB64(0xb311782a4aa662b2), BIGINT_LIMB64(0x19eeaf64e248c7f4), BIGINT_LIMB64(0x20273e77e3439f82)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xacc02860f7ce93ac), BIGINT_LIMB64(0x3933d5817ba76b4c), BIGINT_LIMB64(0x69e6188b446c8467), BIGINT_LIMB64(0x0a46036d4417cc55))), /* (3772000881919853776433695186713858239009073593817195771773381919316419345261, 2236595495967245188281701248203181795121068902605861227855261137820944008926) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x71930c11d782e155), BIGINT_LIMB64(0xa6bb947cffbe3323), BIGINT_LIMB64(0xaa303344d4741444), BIGINT_LIMB64(0x2c3b3f0d26594943)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (2203960485148121921418603742825762020974279258880205651966, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xf91aba2654e8e3b1), BIGINT_LIMB64(0x4771cb2fdc92ce12), BIGINT_LIMB64(0xdcb16ae0fc8bdf35), BIGINT_LIMB64(0x274aa195cd9d8be4)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x5cfc50ae18811f8b), BIGINT_LIMB64(0x4bb28433cb43988c), BIGINT_LIMB64(0x4fd35f13c3b56219), BIGINT_LIMB64(0x301949bd2fc8883a))) /* (18429021223477853657660792034369865839114504446431234726392080002137598044644, 9344045779998320333812420223237981029506012124075525679208581902008406485703) */
+};
+template<> alt_bn128_Fq2 alt_bn128_Fq6::Frobenius_coeffs_c2[6] = {
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (1, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7361d77f843abe92), BIGINT_LIMB64(0xa5bb2bd3273411fb), BIGINT_LIMB64(0x9c941f314b3e2399), BIGINT_LIMB64(0x15df9cddbb9fd3ec)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x5dddfd154bd8c949), BIGINT_LIMB64(0x62cb29a5a4445b60), BIGINT_LIMB64(0x37bc870a0c7dd2b9), BIGINT_LIMB64(0x24830a9d3171f0fd))), /* (2581911344467009335267311115468803099551665605076196740867805258568234346338, 19937756971775647987995932169929341994314640652964949448313374472400716661030) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x71930c11d782e155), BIGINT_LIMB64(0xa6bb947cffbe3323), BIGINT_LIMB64(0xaa303344d4741444), BIGINT_LIMB64(0x2c3b3f0d26594943)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (2203960485148121921418603742825762020974279258880205651966, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x448a93a57b6762df), BIGINT_LIMB64(0xbfd62df528fdeadf), BIGINT_LIMB64(0xd858f5d00e9bd47a), BIGINT_LIMB64(0x06b03d4d3476ec58)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x2b19daf4bcc936d1), BIGINT_LIMB64(0xa1a54e7a56f4299f), BIGINT_LIMB64(0xb533eee05adeaef1), BIGINT_LIMB64(0x170c812b84dda0b2))), /* (5324479202449903542726783395506214481928257762400643279780343368557297135718, 16208900380737693084919495127334387981393726419856888799917914180988844123039) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x3350c88e13e80b9c), BIGINT_LIMB64(0x7dce557cdb5e56b9), BIGINT_LIMB64(0x6001b4b8b615564a), BIGINT_LIMB64(0x2682e617020217e0)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (21888242871839275220042445260109153167277707414472061641714758635765020556616, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x843420f1d8dadbd6), BIGINT_LIMB64(0x31f010c9183fcdb2), BIGINT_LIMB64(0x436330b527a76049), BIGINT_LIMB64(0x13d47447f11adfe4)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xef494023a857fa74), BIGINT_LIMB64(0x2a925d02d5ab101a), BIGINT_LIMB64(0x83b015829ba62f10), BIGINT_LIMB64(0x2539111d0c13aea3))) /* (13981852324922362344252311234282257507216387789820983642040889267519694726527, 7629828391165209371577384193250820201684255241773809077146787135900891633097) */
+};
+
+/* parameters for Fq12 */
+
+/* (9, 1) */
+template<> alt_bn128_Fq2 alt_bn128_Fq12::non_residue = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xf60647ce410d7ff7), BIGINT_LIMB64(0x2f3d6f4dd31bd011), BIGINT_LIMB64(0x2943337e3940c6d1), BIGINT_LIMB64(0x1d9598e8a7e39857)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)));
+template<> alt_bn128_Fq2 alt_bn128_Fq12::Frobenius_coeffs_c1[12] = {
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (1, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xaf9ba69633144907), BIGINT_LIMB64(0xca6b1d7387afb78a), BIGINT_LIMB64(0x11bded5ef08a2087), BIGINT_LIMB64(0x02f34d751a1f3a7c)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xa222ae234c492d72), BIGINT_LIMB64(0xd00f02a4565de15b), BIGINT_LIMB64(0xdc2ff3a253dfc926), BIGINT_LIMB64(0x10a75716b3899551))), /* (8376118865763821496583973867626364092589906065868298776909617916018768340080, 16469823323077808223889137241176536799009286646108169935659301613961712198316) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xca8d800500fa1bf2), BIGINT_LIMB64(0xf0c5d61468b39769), BIGINT_LIMB64(0x0e201271ad0d4418), BIGINT_LIMB64(0x04290f65bad856e6)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (21888242871839275220042445260109153167277707414472061641714758635765020556617, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x365316184e46d97d), BIGINT_LIMB64(0x0af7129ed4c96d9f), BIGINT_LIMB64(0x659da72fca1009b5), BIGINT_LIMB64(0x08116d8983a20d23)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xb1df4af7c39c1939), BIGINT_LIMB64(0x3d9f02878a73bf7f), BIGINT_LIMB64(0x9b2220928caf0ae0), BIGINT_LIMB64(0x26684515eff054a6))), /* (11697423496358154304825782922584725312912383441159505038794027105778954184319, 303847389135065887422783454877609941456349188919719272345083954437860409601) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x3350c88e13e80b9c), BIGINT_LIMB64(0x7dce557cdb5e56b9), BIGINT_LIMB64(0x6001b4b8b615564a), BIGINT_LIMB64(0x2682e617020217e0)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (21888242871839275220042445260109153167277707414472061641714758635765020556616, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x86b76f821b329076), BIGINT_LIMB64(0x408bf52b4d19b614), BIGINT_LIMB64(0x53dfb9d0d985e92d), BIGINT_LIMB64(0x051e20146982d2a7)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0fbc9cd47752ebc7), BIGINT_LIMB64(0x6d8fffe33415de24), BIGINT_LIMB64(0xbef22cf038cf41b9), BIGINT_LIMB64(0x15c0edff3c66bf54))), /* (3321304630594332808241809054958361220322477375291206261884409189760185844239, 5722266937896532885780051958958348231143373700109372999374820235121374419868) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (21888242871839275222246405745257275088696311157297823662689037894645226208582, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x8c84e580a568b440), BIGINT_LIMB64(0xcd164d1de0c21302), BIGINT_LIMB64(0xa692585790f737d5), BIGINT_LIMB64(0x2d7100fdc71265ad)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x99fdddf38c33cfd5), BIGINT_LIMB64(0xc77267ed1213e931), BIGINT_LIMB64(0xdc2052142da18f36), BIGINT_LIMB64(0x1fbcf75c2da80ad7))), /* (13512124006075453725662431877630910996106405091429524885779419978626457868503, 5418419548761466998357268504080738289687024511189653727029736280683514010267) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x71930c11d782e155), BIGINT_LIMB64(0xa6bb947cffbe3323), BIGINT_LIMB64(0xaa303344d4741444), BIGINT_LIMB64(0x2c3b3f0d26594943)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (2203960485148121921418603742825762020974279258880205651966, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x05cd75fe8a3623ca), BIGINT_LIMB64(0x8c8a57f293a85cee), BIGINT_LIMB64(0x52b29e86b7714ea8), BIGINT_LIMB64(0x2852e0e95d8f9306)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x8a41411f14e0e40e), BIGINT_LIMB64(0x59e26809ddfe0b0d), BIGINT_LIMB64(0x1d2e2523f4d24d7d), BIGINT_LIMB64(0x09fc095cf1414b83))), /* (10190819375481120917420622822672549775783927716138318623895010788866272024264, 21584395482704209334823622290379665147239961968378104390343953940207365798982) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x08cfc388c494f1ab), BIGINT_LIMB64(0x19b315148d1373d4), BIGINT_LIMB64(0x584e90fdcb6c0213), BIGINT_LIMB64(0x09e1685bdf2f8849)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), /* (2203960485148121921418603742825762020974279258880205651967, 0) */
+    alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xb5691c94bd4a6cd1), BIGINT_LIMB64(0x56f575661b581478), BIGINT_LIMB64(0x64708be5a7fb6f30), BIGINT_LIMB64(0x2b462e5e77aecd82)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x2c63ef42612a1180), BIGINT_LIMB64(0x29f16aae345bec69), BIGINT_LIMB64(0xf95e18c648b216a4), BIGINT_LIMB64(0x1aa36073a4cae0d4))) /* (18566938241244942414004596690298913868373833782006617400804628704885040364344, 16165975933942742336466353786298926857552937457188450663314217659523851788715) */
+};
+
+/* choice of short Weierstrass curve and its twist */
+
+/* 3 */
+alt_bn128_Fq alt_bn128_coeff_b = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a17caa950ad28d7), BIGINT_LIMB64(0x1f6ac17ae15521b9), BIGINT_LIMB64(0x334bea4e696bd284), BIGINT_LIMB64(0x2a1f6744ce179d8e));
+/* (9, 1) */
+alt_bn128_Fq2 alt_bn128_twist = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xf60647ce410d7ff7), BIGINT_LIMB64(0x2f3d6f4dd31bd011), BIGINT_LIMB64(0x2943337e3940c6d1), BIGINT_LIMB64(0x1d9598e8a7e39857)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xd35d438dc58f0d9d), BIGINT_LIMB64(0x0a78eb28f5c70b3d), BIGINT_LIMB64(0x666ea36f7879462c), BIGINT_LIMB64(0x0e0a77c19a07df2f)));
+/* alt_bn128_coeff_b * alt_bn128_twist.inverse() */
+alt_bn128_Fq2 alt_bn128_twist_coeff_b = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x3bf938e377b802a8), BIGINT_LIMB64(0x020b1b273633535d), BIGINT_LIMB64(0x26b7edf049755260), BIGINT_LIMB64(0x2514c6324384a86d)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x38e7ecccd1dcff67), BIGINT_LIMB64(0x65f0b37d93ce0d3e), BIGINT_LIMB64(0xd749d0dd22ac00aa), BIGINT_LIMB64(0x0141b9ce4a688d4d)));
+/* alt_bn128_coeff_b * alt_bn128_Fq2::non_residue */
+alt_bn128_Fq alt_bn128_twist_mul_by_b_c0 = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xc208c16d87cfd470), BIGINT_LIMB64(0x7816a916871ca8d3), BIGINT_LIMB64(0x85045b68181585d9), BIGINT_LIMB64(0x0644e72e131a029b));
+/* alt_bn128_coeff_b * alt_bn128_Fq2::non_residue */
+alt_bn128_Fq alt_bn128_twist_mul_by_b_c1 = alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xc208c16d87cfd470), BIGINT_LIMB64(0x7816a916871ca8d3), BIGINT_LIMB64(0x85045b68181585d9), BIGINT_LIMB64(0x0644e72e131a029b));
+/* (21575463638280843010398324269430826099269044274347216827212613867836435027261, 10307601595873709700152284273816112264069230130616436755625194854815875713954) */
+alt_bn128_Fq2 alt_bn128_twist_mul_by_q_X = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xb5773b104563ab30), BIGINT_LIMB64(0x347f91c8a9aa6454), BIGINT_LIMB64(0x7a007127242e0991), BIGINT_LIMB64(0x1956bcd8118214ec)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x6e849f1ea0aa4757), BIGINT_LIMB64(0xaa1c7b6d89f89141), BIGINT_LIMB64(0xb6e713cdfae0ca3a), BIGINT_LIMB64(0x26694fbb4e82ebc3)));
+/* (2821565182194536844548159561693502659359617185244120367078079554186484126554, 3505843767911556378687030309984248845540243509899259641013678093033130930403) */
+alt_bn128_Fq2 alt_bn128_twist_mul_by_q_Y = alt_bn128_Fq2(alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xe4bbdd0c2936b629), BIGINT_LIMB64(0xbb30f162e133bacb), BIGINT_LIMB64(0x31a9d1b6f9645366), BIGINT_LIMB64(0x253570bea500f8dd)), alt_bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0xa1d77ce45ffe77c7), BIGINT_LIMB64(0x07affd117826d1db), BIGINT_LIMB64(0x6d16bd27bb7edc6b), BIGINT_LIMB64(0x2c87200285defecc)));
+
+/* pairing parameters */
+
+/* 29793968203157093288 */
+bigint<alt_bn128_q_limbs> alt_bn128_ate_loop_count = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9d797039be763ba8), BIGINT_LIMB64(0x0000000000000001));
+bool alt_bn128_ate_is_loop_count_neg = false;
+/* 552484233613224096312617126783173147097382103762957654188882734314196910839907541213974502761540629817009608548654680343627701153829446747810907373256841551006201639677726139946029199968412598804882391702273019083653272047566316584365559776493027495458238373902875937659943504873220554161550525926302303331747463515644711876653177129578303191095900909191624817826566688241804408081892785725967931714097716709526092261278071952560171111444072049229123565057483750161460024353346284167282452756217662335528813519139808291170539072125381230815729071544861602750936964829313608137325426383735122175229541155376346436093930287402089517426973178917569713384748081827255472576937471496195752727188261435633271238710131736096299798168852925540549342330775279877006784354801422249722573783561685179618816480037695005515426162362431072245638324744480 */
+bigint<12*alt_bn128_q_limbs> alt_bn128_final_exponent = bigint<12*alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x86964b64ca86f120), BIGINT_LIMB64(0x40a4efb7e54523a4), BIGINT_LIMB64(0x837fa97896e84abb), BIGINT_LIMB64(0x361102b6b9b2b918), BIGINT_LIMB64(0xc0de81def35692da), BIGINT_LIMB64(0xbe04c7e8a6c3c760), BIGINT_LIMB64(0xd766f9c9d570bb7f), BIGINT_LIMB64(0xc230974d83561841), BIGINT_LIMB64(0x5bba1668c3be69a3), BIGINT_LIMB64(0x7f3811c410526294), BIGINT_LIMB64(0x29baee7ddadda71c), BIGINT_LIMB64(0xbf813b8d145da900), BIGINT_LIMB64(0x641bbadf423f9a2c), BIGINT_LIMB64(0xa80bb4ea44eacc5e), BIGINT_LIMB64(0xcd65664814fde37c), BIGINT_LIMB64(0x4a0364b9580291d2), BIGINT_LIMB64(0xee93dfb10826f0dd), BIGINT_LIMB64(0x6b42db8dc5514724), BIGINT_LIMB64(0xbb10cf430b0f3785), BIGINT_LIMB64(0x40494e406f804216), BIGINT_LIMB64(0x55cfe107acf3aafb), BIGINT_LIMB64(0x2088ec80e0ebae87), BIGINT_LIMB64(0x846a3ed011a337a0), BIGINT_LIMB64(0x48a45a4a1e3a5195), BIGINT_LIMB64(0xe5664568dfc50e16), BIGINT_LIMB64(0xab6a41294c0cc4eb), BIGINT_LIMB64(0x82d0d602d268c7da), BIGINT_LIMB64(0x6668449aed3cc48a), BIGINT_LIMB64(0x5062cd0fb2015dfc), BIGINT_LIMB64(0x7f2940a8b1ddb3d1), BIGINT_LIMB64(0x77f5b63a2a226448), BIGINT_LIMB64(0xfef0781361e443ae), BIGINT_LIMB64(0xf977870e88d5c6c8), BIGINT_LIMB64(0x790364a61f676baa), BIGINT_LIMB64(0x5887e72eceaddea3), BIGINT_LIMB64(0x1377e563a09a1b70), BIGINT_LIMB64(0x0c54efee1bd8c3b2), BIGINT_LIMB64(0x3ec3d15ad524d8f7), BIGINT_LIMB64(0xdaf15466b2383a5d), BIGINT_LIMB64(0xe1e30a73bb94fec0), BIGINT_LIMB64(0x6a1c71015f3f7be2), BIGINT_LIMB64(0x842d43bf6369b1ff), BIGINT_LIMB64(0x20fddadf107d20bc), BIGINT_LIMB64(0x0000002f4b6dc970));
+/* 4965661367192848881 */
+bigint<alt_bn128_q_limbs> alt_bn128_final_exponent_z = bigint<alt_bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x44e992b44a6909f1));
+bool alt_bn128_final_exponent_is_z_neg = false;
 
 void init_alt_bn128_params()
 {
-    typedef bigint<alt_bn128_r_limbs> bigint_r;
-    typedef bigint<alt_bn128_q_limbs> bigint_q;
-
-    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4); // Montgomery assumes this
-
-    /* parameters for scalar field Fr */
-
-    alt_bn128_modulus_r = bigint_r("21888242871839275222246405745257275088548364400416034343698204186575808495617");
+    /* all parameters are constant-initialized above; just check that Montgomery arithmetic applies */
+    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4);
     assert(alt_bn128_Fr::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        alt_bn128_Fr::Rsquared = bigint_r("944936681149208446651664254269745548490766851729442924617792859073125903783");
-        alt_bn128_Fr::Rcubed = bigint_r("5866548545943845227489894872040244720403868105578784105281690076696998248512");
-        alt_bn128_Fr::inv = 0xc2e1f593efffffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        alt_bn128_Fr::Rsquared = bigint_r("944936681149208446651664254269745548490766851729442924617792859073125903783");
-        alt_bn128_Fr::Rcubed = bigint_r("5866548545943845227489894872040244720403868105578784105281690076696998248512");
-        alt_bn128_Fr::inv = 0xefffffff;
-    }
-    alt_bn128_Fr::num_bits = 254;
-    alt_bn128_Fr::euler = bigint_r("10944121435919637611123202872628637544274182200208017171849102093287904247808");
-    alt_bn128_Fr::s = 28;
-    alt_bn128_Fr::t = bigint_r("81540058820840996586704275553141814055101440848469862132140264610111");
-    alt_bn128_Fr::t_minus_1_over_2 = bigint_r("40770029410420498293352137776570907027550720424234931066070132305055");
-    alt_bn128_Fr::multiplicative_generator = alt_bn128_Fr("5");
-    alt_bn128_Fr::root_of_unity = alt_bn128_Fr("19103219067921713944291392827692070036145651957329286315305642004821462161904");
-    alt_bn128_Fr::nqr = alt_bn128_Fr("5");
-    alt_bn128_Fr::nqr_to_t = alt_bn128_Fr("19103219067921713944291392827692070036145651957329286315305642004821462161904");
-
-    /* parameters for base field Fq */
-
-    alt_bn128_modulus_q = bigint_q("21888242871839275222246405745257275088696311157297823662689037894645226208583");
     assert(alt_bn128_Fq::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        alt_bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735540968419076528771170197431451843209");
-        alt_bn128_Fq::Rcubed = bigint_q("14921786541159648185948152738563080959093619838510245177710943249661917737183");
-        alt_bn128_Fq::inv = 0x87d20782e4866389;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        alt_bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735540968419076528771170197431451843209");
-        alt_bn128_Fq::Rcubed = bigint_q("14921786541159648185948152738563080959093619838510245177710943249661917737183");
-        alt_bn128_Fq::inv = 0xe4866389;
-    }
-    alt_bn128_Fq::num_bits = 254;
-    alt_bn128_Fq::euler = bigint_q("10944121435919637611123202872628637544348155578648911831344518947322613104291");
-    alt_bn128_Fq::s = 1;
-    alt_bn128_Fq::t = bigint_q("10944121435919637611123202872628637544348155578648911831344518947322613104291");
-    alt_bn128_Fq::t_minus_1_over_2 = bigint_q("5472060717959818805561601436314318772174077789324455915672259473661306552145");
-    alt_bn128_Fq::multiplicative_generator = alt_bn128_Fq("3");
-    alt_bn128_Fq::root_of_unity = alt_bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
-    alt_bn128_Fq::nqr = alt_bn128_Fq("3");
-    alt_bn128_Fq::nqr_to_t = alt_bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
-
-    /* parameters for twist field Fq2 */
-    alt_bn128_Fq2::euler = bigint<2*alt_bn128_q_limbs>("239547588008311421220994022608339370399626158265550411218223901127035046843189118723920525909718935985594116157406550130918127817069793474323196511433944");
-    alt_bn128_Fq2::s = 4;
-    alt_bn128_Fq2::t = bigint<2*alt_bn128_q_limbs>("29943448501038927652624252826042421299953269783193801402277987640879380855398639840490065738714866998199264519675818766364765977133724184290399563929243");
-    alt_bn128_Fq2::t_minus_1_over_2 = bigint<2*alt_bn128_q_limbs>("14971724250519463826312126413021210649976634891596900701138993820439690427699319920245032869357433499099632259837909383182382988566862092145199781964621");
-    alt_bn128_Fq2::non_residue = alt_bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
-    alt_bn128_Fq2::nqr = alt_bn128_Fq2(alt_bn128_Fq("2"),alt_bn128_Fq("1"));
-    alt_bn128_Fq2::nqr_to_t = alt_bn128_Fq2(alt_bn128_Fq("5033503716262624267312492558379982687175200734934877598599011485707452665730"),alt_bn128_Fq("314498342015008975724433667930697407966947188435857772134235984660852259084"));
-    alt_bn128_Fq2::Frobenius_coeffs_c1[0] = alt_bn128_Fq("1");
-    alt_bn128_Fq2::Frobenius_coeffs_c1[1] = alt_bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
-
-    /* parameters for Fq6 */
-    alt_bn128_Fq6::non_residue = alt_bn128_Fq2(alt_bn128_Fq("9"),alt_bn128_Fq("1"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[0] = alt_bn128_Fq2(alt_bn128_Fq("1"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[1] = alt_bn128_Fq2(alt_bn128_Fq("21575463638280843010398324269430826099269044274347216827212613867836435027261"),alt_bn128_Fq("10307601595873709700152284273816112264069230130616436755625194854815875713954"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[2] = alt_bn128_Fq2(alt_bn128_Fq("21888242871839275220042445260109153167277707414472061641714758635765020556616"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[3] = alt_bn128_Fq2(alt_bn128_Fq("3772000881919853776433695186713858239009073593817195771773381919316419345261"),alt_bn128_Fq("2236595495967245188281701248203181795121068902605861227855261137820944008926"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[4] = alt_bn128_Fq2(alt_bn128_Fq("2203960485148121921418603742825762020974279258880205651966"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c1[5] = alt_bn128_Fq2(alt_bn128_Fq("18429021223477853657660792034369865839114504446431234726392080002137598044644"),alt_bn128_Fq("9344045779998320333812420223237981029506012124075525679208581902008406485703"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[0] = alt_bn128_Fq2(alt_bn128_Fq("1"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[1] = alt_bn128_Fq2(alt_bn128_Fq("2581911344467009335267311115468803099551665605076196740867805258568234346338"),alt_bn128_Fq("19937756971775647987995932169929341994314640652964949448313374472400716661030"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[2] = alt_bn128_Fq2(alt_bn128_Fq("2203960485148121921418603742825762020974279258880205651966"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[3] = alt_bn128_Fq2(alt_bn128_Fq("5324479202449903542726783395506214481928257762400643279780343368557297135718"),alt_bn128_Fq("16208900380737693084919495127334387981393726419856888799917914180988844123039"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[4] = alt_bn128_Fq2(alt_bn128_Fq("21888242871839275220042445260109153167277707414472061641714758635765020556616"),alt_bn128_Fq("0"));
-    alt_bn128_Fq6::Frobenius_coeffs_c2[5] = alt_bn128_Fq2(alt_bn128_Fq("13981852324922362344252311234282257507216387789820983642040889267519694726527"),alt_bn128_Fq("7629828391165209371577384193250820201684255241773809077146787135900891633097"));
-
-    /* parameters for Fq12 */
-
-    alt_bn128_Fq12::non_residue = alt_bn128_Fq2(alt_bn128_Fq("9"),alt_bn128_Fq("1"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[0]  = alt_bn128_Fq2(alt_bn128_Fq("1"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[1]  = alt_bn128_Fq2(alt_bn128_Fq("8376118865763821496583973867626364092589906065868298776909617916018768340080"),alt_bn128_Fq("16469823323077808223889137241176536799009286646108169935659301613961712198316"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[2]  = alt_bn128_Fq2(alt_bn128_Fq("21888242871839275220042445260109153167277707414472061641714758635765020556617"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[3]  = alt_bn128_Fq2(alt_bn128_Fq("11697423496358154304825782922584725312912383441159505038794027105778954184319"),alt_bn128_Fq("303847389135065887422783454877609941456349188919719272345083954437860409601"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[4]  = alt_bn128_Fq2(alt_bn128_Fq("21888242871839275220042445260109153167277707414472061641714758635765020556616"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[5]  = alt_bn128_Fq2(alt_bn128_Fq("3321304630594332808241809054958361220322477375291206261884409189760185844239"),alt_bn128_Fq("5722266937896532885780051958958348231143373700109372999374820235121374419868"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[6]  = alt_bn128_Fq2(alt_bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[7]  = alt_bn128_Fq2(alt_bn128_Fq("13512124006075453725662431877630910996106405091429524885779419978626457868503"),alt_bn128_Fq("5418419548761466998357268504080738289687024511189653727029736280683514010267"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[8]  = alt_bn128_Fq2(alt_bn128_Fq("2203960485148121921418603742825762020974279258880205651966"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[9]  = alt_bn128_Fq2(alt_bn128_Fq("10190819375481120917420622822672549775783927716138318623895010788866272024264"),alt_bn128_Fq("21584395482704209334823622290379665147239961968378104390343953940207365798982"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[10] = alt_bn128_Fq2(alt_bn128_Fq("2203960485148121921418603742825762020974279258880205651967"),alt_bn128_Fq("0"));
-    alt_bn128_Fq12::Frobenius_coeffs_c1[11] = alt_bn128_Fq2(alt_bn128_Fq("18566938241244942414004596690298913868373833782006617400804628704885040364344"),alt_bn128_Fq("16165975933942742336466353786298926857552937457188450663314217659523851788715"));
-
-    /* choice of short Weierstrass curve and its twist */
-
-    alt_bn128_coeff_b = alt_bn128_Fq("3");
-    alt_bn128_twist = alt_bn128_Fq2(alt_bn128_Fq("9"), alt_bn128_Fq("1"));
-    alt_bn128_twist_coeff_b = alt_bn128_coeff_b * alt_bn128_twist.inverse();
-    alt_bn128_twist_mul_by_b_c0 = alt_bn128_coeff_b * alt_bn128_Fq2::non_residue;
-    alt_bn128_twist_mul_by_b_c1 = alt_bn128_coeff_b * alt_bn128_Fq2::non_residue;
-    alt_bn128_twist_mul_by_q_X = alt_bn128_Fq2(alt_bn128_Fq("21575463638280843010398324269430826099269044274347216827212613867836435027261"),
-                                           alt_bn128_Fq("10307601595873709700152284273816112264069230130616436755625194854815875713954"));
-    alt_bn128_twist_mul_by_q_Y = alt_bn128_Fq2(alt_bn128_Fq("2821565182194536844548159561693502659359617185244120367078079554186484126554"),
-                                           alt_bn128_Fq("3505843767911556378687030309984248845540243509899259641013678093033130930403"));
-
-    /* choice of group G1 */
-    alt_bn128_G1::G1_zero = alt_bn128_G1(alt_bn128_Fq::zero(),
-                                     alt_bn128_Fq::one(),
-                                     alt_bn128_Fq::zero());
-    alt_bn128_G1::G1_one = alt_bn128_G1(alt_bn128_Fq("1"),
-                                    alt_bn128_Fq("2"),
-                                    alt_bn128_Fq::one());
-    alt_bn128_G1::wnaf_window_table.push_back(11);
-    alt_bn128_G1::wnaf_window_table.push_back(24);
-    alt_bn128_G1::wnaf_window_table.push_back(60);
-    alt_bn128_G1::wnaf_window_table.push_back(127);
-
-    alt_bn128_G1::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.99]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.99, 10.99]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(5);
-    // window 3 is unbeaten in [10.99, 32.29]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(11);
-    // window 4 is unbeaten in [32.29, 55.23]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(32);
-    // window 5 is unbeaten in [55.23, 162.03]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(55);
-    // window 6 is unbeaten in [162.03, 360.15]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(162);
-    // window 7 is unbeaten in [360.15, 815.44]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(360);
-    // window 8 is unbeaten in [815.44, 2373.07]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(815);
-    // window 9 is unbeaten in [2373.07, 6977.75]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(2373);
-    // window 10 is unbeaten in [6977.75, 7122.23]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(6978);
-    // window 11 is unbeaten in [7122.23, 57818.46]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(7122);
-    // window 12 is never the best
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 13 is unbeaten in [57818.46, 169679.14]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(57818);
-    // window 14 is never the best
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 15 is unbeaten in [169679.14, 439758.91]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(169679);
-    // window 16 is unbeaten in [439758.91, 936073.41]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(439759);
-    // window 17 is unbeaten in [936073.41, 4666554.74]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(936073);
-    // window 18 is never the best
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 19 is unbeaten in [4666554.74, 7580404.42]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(4666555);
-    // window 20 is unbeaten in [7580404.42, 34552892.20]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(7580404);
-    // window 21 is never the best
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 22 is unbeaten in [34552892.20, inf]
-    alt_bn128_G1::fixed_base_exp_window_table.push_back(34552892);
-
-    /* choice of group G2 */
-
-    alt_bn128_G2::G2_zero = alt_bn128_G2(alt_bn128_Fq2::zero(),
-                                     alt_bn128_Fq2::one(),
-                                     alt_bn128_Fq2::zero());
-
-    alt_bn128_G2::G2_one = alt_bn128_G2(alt_bn128_Fq2(alt_bn128_Fq("10857046999023057135944570762232829481370756359578518086990519993285655852781"),
-                                                alt_bn128_Fq("11559732032986387107991004021392285783925812861821192530917403151452391805634")),
-                                    alt_bn128_Fq2(alt_bn128_Fq("8495653923123431417604973247489272438418190587263600148770280649306958101930"),
-                                                alt_bn128_Fq("4082367875863433681332203403145435568316851327593401208105741076214120093531")),
-                                    alt_bn128_Fq2::one());
-    alt_bn128_G2::wnaf_window_table.push_back(5);
-    alt_bn128_G2::wnaf_window_table.push_back(15);
-    alt_bn128_G2::wnaf_window_table.push_back(39);
-    alt_bn128_G2::wnaf_window_table.push_back(109);
-
-    alt_bn128_G2::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 5.10]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [5.10, 10.43]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(5);
-    // window 3 is unbeaten in [10.43, 25.28]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(10);
-    // window 4 is unbeaten in [25.28, 59.00]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(25);
-    // window 5 is unbeaten in [59.00, 154.03]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(59);
-    // window 6 is unbeaten in [154.03, 334.25]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(154);
-    // window 7 is unbeaten in [334.25, 742.58]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(334);
-    // window 8 is unbeaten in [742.58, 2034.40]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(743);
-    // window 9 is unbeaten in [2034.40, 4987.56]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(2034);
-    // window 10 is unbeaten in [4987.56, 8888.27]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(4988);
-    // window 11 is unbeaten in [8888.27, 26271.13]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(8888);
-    // window 12 is unbeaten in [26271.13, 39768.20]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(26271);
-    // window 13 is unbeaten in [39768.20, 106275.75]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(39768);
-    // window 14 is unbeaten in [106275.75, 141703.40]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(106276);
-    // window 15 is unbeaten in [141703.40, 462422.97]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(141703);
-    // window 16 is unbeaten in [462422.97, 926871.84]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(462423);
-    // window 17 is unbeaten in [926871.84, 4873049.17]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(926872);
-    // window 18 is never the best
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(0);
-    // window 19 is unbeaten in [4873049.17, 5706707.88]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(4873049);
-    // window 20 is unbeaten in [5706707.88, 31673814.95]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(5706708);
-    // window 21 is never the best
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(0);
-    // window 22 is unbeaten in [31673814.95, inf]
-    alt_bn128_G2::fixed_base_exp_window_table.push_back(31673815);
-
-    /* pairing parameters */
-
-    alt_bn128_ate_loop_count = bigint_q("29793968203157093288");
-    alt_bn128_ate_is_loop_count_neg = false;
-    alt_bn128_final_exponent = bigint<12*alt_bn128_q_limbs>("552484233613224096312617126783173147097382103762957654188882734314196910839907541213974502761540629817009608548654680343627701153829446747810907373256841551006201639677726139946029199968412598804882391702273019083653272047566316584365559776493027495458238373902875937659943504873220554161550525926302303331747463515644711876653177129578303191095900909191624817826566688241804408081892785725967931714097716709526092261278071952560171111444072049229123565057483750161460024353346284167282452756217662335528813519139808291170539072125381230815729071544861602750936964829313608137325426383735122175229541155376346436093930287402089517426973178917569713384748081827255472576937471496195752727188261435633271238710131736096299798168852925540549342330775279877006784354801422249722573783561685179618816480037695005515426162362431072245638324744480");
-    alt_bn128_final_exponent_z = bigint_q("4965661367192848881");
-    alt_bn128_final_exponent_is_z_neg = false;
-
 }
+
 } // libsnark
@@ -48,6 +48,49 @@ extern bigint<12*alt_bn128_q_limbs> alt_bn128_final_exponent;
 extern bigint<alt_bn128_q_limbs> alt_bn128_final_exponent_z;
 extern bool alt_bn128_final_exponent_is_z_neg;
 
+/*
+ * The parameters of the fields above are constant-initialized in
+ * alt_bn128_init.cpp (as are all other parameters of the curve), so they
+ * can be used without calling init_alt_bn128_params() first.
+ */
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::Rsquared;
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::Rcubed;
+template<> mp_limb_t alt_bn128_Fr::inv;
+template<> size_t alt_bn128_Fr::num_bits;
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::euler;
+template<> size_t alt_bn128_Fr::s;
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::t;
+template<> bigint<alt_bn128_r_limbs> alt_bn128_Fr::t_minus_1_over_2;
+template<> alt_bn128_Fr alt_bn128_Fr::multiplicative_generator;
+template<> alt_bn128_Fr alt_bn128_Fr::root_of_unity;
+template<> alt_bn128_Fr alt_bn128_Fr::nqr;
+template<> alt_bn128_Fr alt_bn128_Fr::nqr_to_t;
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::Rsquared;
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::Rcubed;
+template<> mp_limb_t alt_bn128_Fq::inv;
+template<> size_t alt_bn128_Fq::num_bits;
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::euler;
+template<> size_t alt_bn128_Fq::s;
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::t;
+template<> bigint<alt_bn128_q_limbs> alt_bn128_Fq::t_minus_1_over_2;
+template<> alt_bn128_Fq alt_bn128_Fq::multiplicative_generator;
+template<> alt_bn128_Fq alt_bn128_Fq::root_of_unity;
+template<> alt_bn128_Fq alt_bn128_Fq::nqr;
+template<> alt_bn128_Fq alt_bn128_Fq::nqr_to_t;
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::euler;
+template<> size_t alt_bn128_Fq2::s;
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::t;
+template<> bigint<2*alt_bn128_q_limbs> alt_bn128_Fq2::t_minus_1_over_2;
+template<> alt_bn128_Fq alt_bn128_Fq2::non_residue;
+template<> alt_bn128_Fq2 alt_bn128_Fq2::nqr;
+template<> alt_bn128_Fq2 alt_bn128_Fq2::nqr_to_t;
+template<> alt_bn128_Fq alt_bn128_Fq2::Frobenius_coeffs_c1[2];
+template<> alt_bn128_Fq2 alt_bn128_Fq6::non_residue;
+template<> alt_bn128_Fq2 alt_bn128_Fq6::Frobenius_coeffs_c1[6];
+template<> alt_bn128_Fq2 alt_bn128_Fq6::Frobenius_coeffs_c2[6];
+template<> alt_bn128_Fq2 alt_bn128_Fq12::non_residue;
+template<> alt_bn128_Fq2 alt_bn128_Fq12::Frobenius_coeffs_c1[12];
+
 void init_alt_bn128_params();
 
 class alt_bn128_G1;
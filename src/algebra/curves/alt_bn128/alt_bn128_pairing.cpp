@@ -10,6 +10,7 @@
 #include "algebra/curves/alt_bn128/alt_bn128_g1.hpp"
 #include "algebra/curves/alt_bn128/alt_bn128_g2.hpp"
 #include <cassert>
+#include "algebra/fields/field_utils.hpp"
 #include "common/profiling.hpp"
 
 namespace libsnark {
@@ -60,18 +61,35 @@ std::istream& operator>>(std::istream &in, alt_bn128_ate_ell_coeffs &c)
     return in;
 }
 
+size_t alt_bn128_ate_G2_precomp::coeffs_per_line() const
+{
+    return (affine_lines ? 2 : 3);
+}
+
+size_t alt_bn128_ate_G2_precomp::num_lines() const
+{
+    return ell_coeffs.size() / coeffs_per_line();
+}
+
+size_t alt_bn128_ate_G2_precomp::size_in_bytes() const
+{
+    return sizeof(*this) + ell_coeffs.size() * sizeof(alt_bn128_Fq2);
+}
+
 bool alt_bn128_ate_G2_precomp::operator==(const alt_bn128_ate_G2_precomp &other) const
 {
     return (this->QX == other.QX &&
             this->QY == other.QY &&
-            this->coeffs == other.coeffs);
+            this->affine_lines == other.affine_lines &&
+            this->ell_coeffs == other.ell_coeffs);
 }
 
 std::ostream& operator<<(std::ostream& out, const alt_bn128_ate_G2_precomp &prec_Q)
 {
     out << prec_Q.QX << OUTPUT_SEPARATOR << prec_Q.QY << "\n";
-    out << prec_Q.coeffs.size() << "\n";
-    for (const alt_bn128_ate_ell_coeffs &c : prec_Q.coeffs)
+    out << prec_Q.affine_lines << "\n";
+    out << prec_Q.ell_coeffs.size() << "\n";
+    for (const alt_bn128_Fq2 &c : prec_Q.ell_coeffs)
     {
         out << c << OUTPUT_NEWLINE;
     }
@@ -85,20 +103,21 @@ std::istream& operator>>(std::istream& in, alt_bn128_ate_G2_precomp &prec_Q)
     in >> prec_Q.QY;
     consume_newline(in);
 
-    prec_Q.coeffs.clear();
+    in >> prec_Q.affine_lines;
+    consume_newline(in);
+
+    prec_Q.ell_coeffs.clear();
     size_t s;
     in >> s;
 
     consume_newline(in);
 
-    prec_Q.coeffs.reserve(s);
+    prec_Q.ell_coeffs.resize(s);
 
     for (size_t i = 0; i < s; ++i)
     {
-        alt_bn128_ate_ell_coeffs c;
-        in >> c;
+        in >> prec_Q.ell_coeffs[i];
         consume_OUTPUT_NEWLINE(in);
-        prec_Q.coeffs.emplace_back(c);
     }
 
     return in;
@@ -301,7 +320,7 @@ alt_bn128_ate_G1_precomp alt_bn128_ate_precompute_G1(const alt_bn128_G1& P)
     return result;
 }
 
-alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q)
+alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q, const bool affine_lines)
 {
     enter_block("Call to alt_bn128_ate_precompute_G2");
 
@@ -313,6 +332,7 @@ alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q)
     alt_bn128_ate_G2_precomp result;
     result.QX = Qcopy.X;
     result.QY = Qcopy.Y;
+    result.affine_lines = affine_lines;
 
     alt_bn128_G2 R;
     R.X = Qcopy.X;
@@ -322,6 +342,7 @@ alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q)
     const bigint<alt_bn128_Fr::num_limbs> &loop_count = alt_bn128_ate_loop_count;
     bool found_one = false;
     alt_bn128_ate_ell_coeffs c;
+    std::vector<alt_bn128_ate_ell_coeffs> lines;
 
     for (long i = loop_count.max_bits(); i >= 0; --i)
     {
@@ -334,12 +355,12 @@ alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q)
         }
 
         doubling_step_for_flipped_miller_loop(two_inv, R, c);
-        result.coeffs.push_back(c);
+        lines.push_back(c);
 
         if (bit)
         {
             mixed_addition_step_for_flipped_miller_loop(Qcopy, R, c);
-            result.coeffs.push_back(c);
+            lines.push_back(c);
         }
     }
 
@@ -355,27 +376,73 @@ alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q)
     Q2.Y = - Q2.Y;
 
     mixed_addition_step_for_flipped_miller_loop(Q1, R, c);
-    result.coeffs.push_back(c);
+    lines.push_back(c);
 
     mixed_addition_step_for_flipped_miller_loop(Q2, R, c);
-    result.coeffs.push_back(c);
+    lines.push_back(c);
+
+    result.ell_coeffs.reserve(lines.size() * result.coeffs_per_line());
+    if (affine_lines)
+    {
+        /* scaling a line by an element of Fq2 does not change the reduced pairing */
+        std::vector<alt_bn128_Fq2> ell_VW_inv;
+        ell_VW_inv.reserve(lines.size());
+        for (const alt_bn128_ate_ell_coeffs &l : lines)
+        {
+            ell_VW_inv.emplace_back(l.ell_VW);
+        }
+        batch_invert<alt_bn128_Fq2>(ell_VW_inv);
+
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            result.ell_coeffs.emplace_back(lines[i].ell_0 * ell_VW_inv[i]);
+            result.ell_coeffs.emplace_back(lines[i].ell_VV * ell_VW_inv[i]);
+        }
+    }
+    else
+    {
+        for (const alt_bn128_ate_ell_coeffs &l : lines)
+        {
+            result.ell_coeffs.emplace_back(l.ell_0);
+            result.ell_coeffs.emplace_back(l.ell_VW);
+            result.ell_coeffs.emplace_back(l.ell_VV);
+        }
+    }
 
     leave_block("Call to alt_bn128_ate_precompute_G2");
     return result;
 }
 
-alt_bn128_Fq12 alt_bn128_ate_miller_loop(const alt_bn128_ate_G1_precomp &prec_P,
-                                     const alt_bn128_ate_G2_precomp &prec_Q)
+/* multiplies f by the line of prec_Q starting at c, evaluated at prec_P, and advances c to the next line */
+void alt_bn128_ate_mul_by_line(alt_bn128_Fq12 &f,
+                               const alt_bn128_ate_G1_precomp &prec_P,
+                               const alt_bn128_Fq2 &PY_affine,
+                               const bool affine_lines,
+                               const alt_bn128_Fq2* &c)
 {
-    enter_block("Call to alt_bn128_ate_miller_loop");
+    if (affine_lines)
+    {
+        f = f.mul_by_024(c[0], PY_affine, prec_P.PX * c[1]);
+        c += 2;
+    }
+    else
+    {
+        f = f.mul_by_024(c[0], prec_P.PY * c[1], prec_P.PX * c[2]);
+        c += 3;
+    }
+}
 
+/* the Miller loop, up to the inversion that a negative loop count requires */
+static alt_bn128_Fq12 alt_bn128_ate_miller_loop_uninverted(const alt_bn128_ate_G1_precomp &prec_P,
+                                                           const alt_bn128_ate_G2_precomp &prec_Q)
+{
     alt_bn128_Fq12 f = alt_bn128_Fq12::one();
 
     bool found_one = false;
-    size_t idx = 0;
+    const alt_bn128_Fq2 *c = prec_Q.ell_coeffs.data();
+    const alt_bn128_Fq2 PY_affine(prec_P.PY, alt_bn128_Fq::zero()); /* prec_P.PY * ell_VW for affine lines */
 
     const bigint<alt_bn128_Fr::num_limbs> &loop_count = alt_bn128_ate_loop_count;
-    alt_bn128_ate_ell_coeffs c;
 
     for (long i = loop_count.max_bits(); i >= 0; --i)
     {
@@ -391,28 +458,45 @@ alt_bn128_Fq12 alt_bn128_ate_miller_loop(const alt_bn128_ate_G1_precomp &prec_P,
            alt_bn128_param_p (skipping leading zeros) in MSB to LSB
            order */
 
-        c = prec_Q.coeffs[idx++];
         f = f.squared();
-        f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+        alt_bn128_ate_mul_by_line(f, prec_P, PY_affine, prec_Q.affine_lines, c);
 
         if (bit)
         {
-            c = prec_Q.coeffs[idx++];
-            f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+            alt_bn128_ate_mul_by_line(f, prec_P, PY_affine, prec_Q.affine_lines, c);
         }
 
     }
+    assert(c == prec_Q.ell_coeffs.data() + prec_Q.ell_coeffs.size() - 2 * prec_Q.coeffs_per_line());
+
+    return f;
+}
+
+/* the two lines that follow the inversion */
+static void alt_bn128_ate_mul_by_final_lines(alt_bn128_Fq12 &f,
+                                             const alt_bn128_ate_G1_precomp &prec_P,
+                                             const alt_bn128_ate_G2_precomp &prec_Q)
+{
+    const alt_bn128_Fq2 *c = prec_Q.ell_coeffs.data() + prec_Q.ell_coeffs.size() - 2 * prec_Q.coeffs_per_line();
+    const alt_bn128_Fq2 PY_affine(prec_P.PY, alt_bn128_Fq::zero());
+
+    alt_bn128_ate_mul_by_line(f, prec_P, PY_affine, prec_Q.affine_lines, c);
+    alt_bn128_ate_mul_by_line(f, prec_P, PY_affine, prec_Q.affine_lines, c);
+}
+
+alt_bn128_Fq12 alt_bn128_ate_miller_loop(const alt_bn128_ate_G1_precomp &prec_P,
+                                     const alt_bn128_ate_G2_precomp &prec_Q)
+{
+    enter_block("Call to alt_bn128_ate_miller_loop");
+
+    alt_bn128_Fq12 f = alt_bn128_ate_miller_loop_uninverted(prec_P, prec_Q);
 
     if (alt_bn128_ate_is_loop_count_neg)
     {
     	f = f.inverse();
     }
 
-    c = prec_Q.coeffs[idx++];
-    f = f.mul_by_024(c.ell_0,prec_P.PY * c.ell_VW,prec_P.PX * c.ell_VV);
-
-    c = prec_Q.coeffs[idx++];
-    f = f.mul_by_024(c.ell_0,prec_P.PY * c.ell_VW,prec_P.PX * c.ell_VV);
+    alt_bn128_ate_mul_by_final_lines(f, prec_P, prec_Q);
 
     leave_block("Call to alt_bn128_ate_miller_loop");
     return f;
@@ -428,7 +512,10 @@ alt_bn128_Fq12 alt_bn128_ate_double_miller_loop(const alt_bn128_ate_G1_precomp &
     alt_bn128_Fq12 f = alt_bn128_Fq12::one();
 
     bool found_one = false;
-    size_t idx = 0;
+    const alt_bn128_Fq2 *c1 = prec_Q1.ell_coeffs.data();
+    const alt_bn128_Fq2 *c2 = prec_Q2.ell_coeffs.data();
+    const alt_bn128_Fq2 PY1_affine(prec_P1.PY, alt_bn128_Fq::zero());
+    const alt_bn128_Fq2 PY2_affine(prec_P2.PY, alt_bn128_Fq::zero());
 
     const bigint<alt_bn128_Fr::num_limbs> &loop_count = alt_bn128_ate_loop_count;
     for (long i = loop_count.max_bits(); i >= 0; --i)
@@ -445,23 +532,15 @@ alt_bn128_Fq12 alt_bn128_ate_double_miller_loop(const alt_bn128_ate_G1_precomp &
            alt_bn128_param_p (skipping leading zeros) in MSB to LSB
            order */
 
-        alt_bn128_ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-        alt_bn128_ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
-        ++idx;
-
         f = f.squared();
 
-        f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-        f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+        alt_bn128_ate_mul_by_line(f, prec_P1, PY1_affine, prec_Q1.affine_lines, c1);
+        alt_bn128_ate_mul_by_line(f, prec_P2, PY2_affine, prec_Q2.affine_lines, c2);
 
         if (bit)
         {
-            alt_bn128_ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-            alt_bn128_ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
-            ++idx;
-
-            f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-            f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+            alt_bn128_ate_mul_by_line(f, prec_P1, PY1_affine, prec_Q1.affine_lines, c1);
+            alt_bn128_ate_mul_by_line(f, prec_P2, PY2_affine, prec_Q2.affine_lines, c2);
         }
     }
 
@@ -470,23 +549,50 @@ alt_bn128_Fq12 alt_bn128_ate_double_miller_loop(const alt_bn128_ate_G1_precomp &
     	f = f.inverse();
     }
 
-    alt_bn128_ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-    alt_bn128_ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
-    ++idx;
-    f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-    f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+    alt_bn128_ate_mul_by_line(f, prec_P1, PY1_affine, prec_Q1.affine_lines, c1);
+    alt_bn128_ate_mul_by_line(f, prec_P2, PY2_affine, prec_Q2.affine_lines, c2);
 
-    c1 = prec_Q1.coeffs[idx];
-    c2 = prec_Q2.coeffs[idx];
-    ++idx;
-    f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-    f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+    alt_bn128_ate_mul_by_line(f, prec_P1, PY1_affine, prec_Q1.affine_lines, c1);
+    alt_bn128_ate_mul_by_line(f, prec_P2, PY2_affine, prec_Q2.affine_lines, c2);
 
     leave_block("Call to alt_bn128_ate_double_miller_loop");
 
     return f;
 }
 
+std::vector<alt_bn128_Fq12> alt_bn128_ate_batch_miller_loop(const std::vector<alt_bn128_ate_G1_precomp> &prec_P,
+                                                            const std::vector<alt_bn128_ate_G2_precomp> &prec_Q)
+{
+    enter_block("Call to alt_bn128_ate_batch_miller_loop");
+    assert(prec_P.size() == prec_Q.size());
+
+    std::vector<alt_bn128_Fq12> f(prec_P.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < f.size(); ++j)
+    {
+        f[j] = alt_bn128_ate_miller_loop_uninverted(prec_P[j], prec_Q[j]);
+    }
+
+    if (alt_bn128_ate_is_loop_count_neg)
+    {
+        /* one inversion for all pairs */
+        batch_invert(f);
+    }
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < f.size(); ++j)
+    {
+        alt_bn128_ate_mul_by_final_lines(f[j], prec_P[j], prec_Q[j]);
+    }
+
+    leave_block("Call to alt_bn128_ate_batch_miller_loop");
+    return f;
+}
+
 alt_bn128_Fq12 alt_bn128_ate_pairing(const alt_bn128_G1& P, const alt_bn128_G2 &Q)
 {
     enter_block("Call to alt_bn128_ate_pairing");
@@ -532,6 +638,12 @@ alt_bn128_Fq12 alt_bn128_double_miller_loop(const alt_bn128_G1_precomp &prec_P1,
     return alt_bn128_ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<alt_bn128_Fq12> alt_bn128_batch_miller_loop(const std::vector<alt_bn128_G1_precomp> &prec_P,
+                                                    const std::vector<alt_bn128_G2_precomp> &prec_Q)
+{
+    return alt_bn128_ate_batch_miller_loop(prec_P, prec_Q);
+}
+
 alt_bn128_Fq12 alt_bn128_pairing(const alt_bn128_G1& P,
                       const alt_bn128_G2 &Q)
 {
@@ -9,6 +9,7 @@
 #define ALT_BN128_PAIRING_HPP_
 #include <vector>
 #include "algebra/curves/alt_bn128/alt_bn128_init.hpp"
+#include "common/aligned_allocator.hpp"
 
 namespace libsnark {
 
@@ -37,10 +38,27 @@ struct alt_bn128_ate_ell_coeffs {
     friend std::istream& operator>>(std::istream &in, alt_bn128_ate_ell_coeffs &dc);
 };
 
+/*
+ * The line coefficients of all Miller loop steps are stored back to back in
+ * one cache-line aligned buffer, in the order in which the Miller loop
+ * consumes them: (ell_0, ell_VW, ell_VV) for each line, or only
+ * (ell_0, ell_VV) for affine lines, which are scaled so that ell_VW = 1.
+ * Affine lines cost a batch inversion to precompute, but take 2/3 of the
+ * memory and save a multiplication per line in every Miller loop, so they
+ * pay off for points that are paired many times (e.g. in verification keys).
+ *
+ * The serialized form writes the affine_lines flag before the coefficients,
+ * so streams written before affine lines were added cannot be read back.
+ */
 struct alt_bn128_ate_G2_precomp {
     alt_bn128_Fq2 QX;
     alt_bn128_Fq2 QY;
-    std::vector<alt_bn128_ate_ell_coeffs> coeffs;
+    bool affine_lines = false;
+    std::vector<alt_bn128_Fq2, aligned_allocator<alt_bn128_Fq2> > ell_coeffs;
+
+    size_t coeffs_per_line() const;
+    size_t num_lines() const;
+    size_t size_in_bytes() const;
 
     bool operator==(const alt_bn128_ate_G2_precomp &other) const;
     friend std::ostream& operator<<(std::ostream &out, const alt_bn128_ate_G2_precomp &prec_Q);
@@ -48,7 +66,7 @@ struct alt_bn128_ate_G2_precomp {
 };
 
 alt_bn128_ate_G1_precomp alt_bn128_ate_precompute_G1(const alt_bn128_G1& P);
-alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q);
+alt_bn128_ate_G2_precomp alt_bn128_ate_precompute_G2(const alt_bn128_G2& Q, const bool affine_lines = false);
 
 alt_bn128_Fq12 alt_bn128_ate_miller_loop(const alt_bn128_ate_G1_precomp &prec_P,
                               const alt_bn128_ate_G2_precomp &prec_Q);
@@ -57,6 +75,10 @@ alt_bn128_Fq12 alt_bn128_ate_double_miller_loop(const alt_bn128_ate_G1_precomp &
                                      const alt_bn128_ate_G1_precomp &prec_P2,
                                      const alt_bn128_ate_G2_precomp &prec_Q2);
 
+/* Miller loops of the independent pairs (prec_P[i], prec_Q[i]) */
+std::vector<alt_bn128_Fq12> alt_bn128_ate_batch_miller_loop(const std::vector<alt_bn128_ate_G1_precomp> &prec_P,
+                                                            const std::vector<alt_bn128_ate_G2_precomp> &prec_Q);
+
 alt_bn128_Fq12 alt_bn128_ate_pairing(const alt_bn128_G1& P,
                           const alt_bn128_G2 &Q);
 alt_bn128_GT alt_bn128_ate_reduced_pairing(const alt_bn128_G1 &P,
@@ -79,6 +101,9 @@ alt_bn128_Fq12 alt_bn128_double_miller_loop(const alt_bn128_G1_precomp &prec_P1,
                                  const alt_bn128_G1_precomp &prec_P2,
                                  const alt_bn128_G2_precomp &prec_Q2);
 
+std::vector<alt_bn128_Fq12> alt_bn128_batch_miller_loop(const std::vector<alt_bn128_G1_precomp> &prec_P,
+                                                        const std::vector<alt_bn128_G2_precomp> &prec_Q);
+
 alt_bn128_Fq12 alt_bn128_pairing(const alt_bn128_G1& P,
                       const alt_bn128_G2 &Q);
 
@@ -29,6 +29,12 @@ alt_bn128_G2_precomp alt_bn128_pp::precompute_G2(const alt_bn128_G2 &Q)
     return alt_bn128_precompute_G2(Q);
 }
 
+alt_bn128_G2_precomp alt_bn128_pp::precompute_G2_for_reuse(const alt_bn128_G2 &Q)
+{
+    /* affine lines are slower to precompute, but faster in every Miller loop */
+    return alt_bn128_ate_precompute_G2(Q, true);
+}
+
 alt_bn128_Fq12 alt_bn128_pp::miller_loop(const alt_bn128_G1_precomp &prec_P,
                                          const alt_bn128_G2_precomp &prec_Q)
 {
@@ -43,6 +49,12 @@ alt_bn128_Fq12 alt_bn128_pp::double_miller_loop(const alt_bn128_G1_precomp &prec
     return alt_bn128_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<alt_bn128_Fq12> alt_bn128_pp::batch_miller_loop(const std::vector<alt_bn128_G1_precomp> &prec_P,
+                                                            const std::vector<alt_bn128_G2_precomp> &prec_Q)
+{
+    return alt_bn128_batch_miller_loop(prec_P, prec_Q);
+}
+
 alt_bn128_Fq12 alt_bn128_pp::pairing(const alt_bn128_G1 &P,
                                      const alt_bn128_G2 &Q)
 {
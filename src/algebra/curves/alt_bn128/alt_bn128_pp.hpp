@@ -33,12 +33,15 @@ public:
     static alt_bn128_GT final_exponentiation(const alt_bn128_Fq12 &elt);
     static alt_bn128_G1_precomp precompute_G1(const alt_bn128_G1 &P);
     static alt_bn128_G2_precomp precompute_G2(const alt_bn128_G2 &Q);
+    static alt_bn128_G2_precomp precompute_G2_for_reuse(const alt_bn128_G2 &Q);
     static alt_bn128_Fq12 miller_loop(const alt_bn128_G1_precomp &prec_P,
                                       const alt_bn128_G2_precomp &prec_Q);
     static alt_bn128_Fq12 double_miller_loop(const alt_bn128_G1_precomp &prec_P1,
                                              const alt_bn128_G2_precomp &prec_Q1,
                                              const alt_bn128_G1_precomp &prec_P2,
                                              const alt_bn128_G2_precomp &prec_Q2);
+    static std::vector<alt_bn128_Fq12> batch_miller_loop(const std::vector<alt_bn128_G1_precomp> &prec_P,
+                                                         const std::vector<alt_bn128_G2_precomp> &prec_Q);
     static alt_bn128_Fq12 pairing(const alt_bn128_G1 &P,
                                   const alt_bn128_G2 &Q);
     static alt_bn128_Fq12 reduced_pairing(const alt_bn128_G1 &P,
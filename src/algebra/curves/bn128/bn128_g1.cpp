@@ -15,8 +15,53 @@ long long bn128_G1::add_cnt = 0;
 long long bn128_G1::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> bn128_G1::wnaf_window_table;
-std::vector<size_t> bn128_G1::fixed_base_exp_window_table;
+std::vector<size_t> bn128_G1::wnaf_window_table = { 10, 24, 40, 132 };
+std::vector<size_t> bn128_G1::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.24]
+    1,
+    // window 2 is unbeaten in [4.24, 10.43]
+    4,
+    // window 3 is unbeaten in [10.43, 24.88]
+    10,
+    // window 4 is unbeaten in [24.88, 62.10]
+    25,
+    // window 5 is unbeaten in [62.10, 157.80]
+    62,
+    // window 6 is unbeaten in [157.80, 362.05]
+    158,
+    // window 7 is unbeaten in [362.05, 806.67]
+    362,
+    // window 8 is unbeaten in [806.67, 2090.34]
+    807,
+    // window 9 is unbeaten in [2090.34, 4459.58]
+    2090,
+    // window 10 is unbeaten in [4459.58, 9280.12]
+    4460,
+    // window 11 is unbeaten in [9280.12, 43302.64]
+    9280,
+    // window 12 is unbeaten in [43302.64, 210998.73]
+    43303,
+    // window 13 is never the best
+    0,
+    // window 14 is never the best
+    0,
+    // window 15 is unbeaten in [210998.73, 506869.47]
+    210999,
+    // window 16 is unbeaten in [506869.47, 930023.36]
+    506869,
+    // window 17 is unbeaten in [930023.36, 8350812.20]
+    930023,
+    // window 18 is never the best
+    0,
+    // window 19 is never the best
+    0,
+    // window 20 is unbeaten in [8350812.20, 21708138.87]
+    8350812,
+    // window 21 is unbeaten in [21708138.87, 29482995.52]
+    21708139,
+    // window 22 is unbeaten in [29482995.52, inf]
+    29482996
+};
 bn128_G1 bn128_G1::G1_zero;
 bn128_G1 bn128_G1::G1_one;
 
@@ -28,31 +73,25 @@ bn::Fp bn128_G1::sqrt(const bn::Fp &el)
     bn::Fp x = el * w;
     bn::Fp b = x * w;
 
-#if DEBUG
-    // check if square with Euler's criterion
-    bn::Fp check = b;
-    for (size_t i = 0; i < v-1; ++i)
-    {
-        bn::Fp::square(check, check);
-    }
-
-    assert(check == bn::Fp(1));
-#endif
-
     // compute square root with Tonelli--Shanks
-    // (does not terminate if not a square!)
 
     while (b != bn::Fp(1))
     {
         size_t m = 0;
         bn::Fp b2m = b;
-        while (b2m != bn::Fp(1))
+        while (b2m != bn::Fp(1) && m < v)
         {
             // invariant: b2m = b^(2^m) after entering this loop
             bn::Fp::square(b2m, b2m);
             m += 1;
         }
 
+        if (m == v)
+        {
+            // b has order 2^v (or is zero): el is zero, and so is x, or not a square
+            break;
+        }
+
         int j = v-m-1;
         w = z;
         while (j > 0)
@@ -491,6 +530,13 @@ std::istream& operator>>(std::istream& in, std::vector<bn128_G1> &v)
     return in;
 }
 
+template<>
+bool is_in_subgroup<bn128_G1>(const bn128_G1 &P)
+{
+    /* the curve has prime order, so all of its points lie in G1 */
+    return true;
+}
+
 template<>
 void batch_to_special_all_non_zeros<bn128_G1>(std::vector<bn128_G1> &vec)
 {
@@ -90,5 +90,8 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<bn128_G1>(std::vector<bn128_G1> &vec);
 
+template<>
+bool is_in_subgroup<bn128_G1>(const bn128_G1 &P);
+
 } // libsnark
 #endif // BN128_G1_HPP_
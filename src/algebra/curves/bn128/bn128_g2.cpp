@@ -15,8 +15,53 @@ long long bn128_G2::add_cnt = 0;
 long long bn128_G2::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> bn128_G2::wnaf_window_table;
-std::vector<size_t> bn128_G2::fixed_base_exp_window_table;
+std::vector<size_t> bn128_G2::wnaf_window_table = { 7, 18, 35, 116 };
+std::vector<size_t> bn128_G2::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.13]
+    1,
+    // window 2 is unbeaten in [4.13, 10.72]
+    4,
+    // window 3 is unbeaten in [10.72, 25.60]
+    11,
+    // window 4 is unbeaten in [25.60, 60.99]
+    26,
+    // window 5 is unbeaten in [60.99, 153.66]
+    61,
+    // window 6 is unbeaten in [153.66, 353.13]
+    154,
+    // window 7 is unbeaten in [353.13, 771.87]
+    353,
+    // window 8 is unbeaten in [771.87, 2025.85]
+    772,
+    // window 9 is unbeaten in [2025.85, 4398.65]
+    2026,
+    // window 10 is unbeaten in [4398.65, 10493.42]
+    4399,
+    // window 11 is unbeaten in [10493.42, 37054.73]
+    10493,
+    // window 12 is unbeaten in [37054.73, 49928.78]
+    37055,
+    // window 13 is unbeaten in [49928.78, 114502.82]
+    49929,
+    // window 14 is unbeaten in [114502.82, 161445.26]
+    114503,
+    // window 15 is unbeaten in [161445.26, 470648.01]
+    161445,
+    // window 16 is unbeaten in [470648.01, 1059821.87]
+    470648,
+    // window 17 is unbeaten in [1059821.87, 5450848.25]
+    1059822,
+    // window 18 is never the best
+    0,
+    // window 19 is unbeaten in [5450848.25, 5566795.57]
+    5450848,
+    // window 20 is unbeaten in [5566795.57, 33055217.52]
+    5566796,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [33055217.52, inf]
+    33055218
+};
 bn128_G2 bn128_G2::G2_zero;
 bn128_G2 bn128_G2::G2_one;
 
@@ -28,31 +73,25 @@ bn::Fp2 bn128_G2::sqrt(const bn::Fp2 &el)
     bn::Fp2 x = el * w;
     bn::Fp2 b = x * w;
 
-#if DEBUG
-    // check if square with Euler's criterion
-    bn::Fp2 check = b;
-    for (size_t i = 0; i < v-1; ++i)
-    {
-        bn::Fp2::square(check, check);
-    }
-
-    assert(check == bn::Fp2(bn::Fp(1), bn::Fp(0)));
-#endif
-
     // compute square root with Tonelli--Shanks
-    // (does not terminate if not a square!)
 
     while (b != bn::Fp2(1))
     {
         size_t m = 0;
         bn::Fp2 b2m = b;
-        while (b2m != bn::Fp2(bn::Fp(1), bn::Fp(0)))
+        while (b2m != bn::Fp2(bn::Fp(1), bn::Fp(0)) && m < v)
         {
             // invariant: b2m = b^(2^m) after entering this loop
             bn::Fp2::square(b2m, b2m);
             m += 1;
         }
 
+        if (m == v)
+        {
+            // b has order 2^v (or is zero): el is zero, and so is x, or not a square
+            break;
+        }
+
         int j = v-m-1;
         w = z;
         while (j > 0)
@@ -39,6 +39,14 @@ bn128_GT bn128_GT::unitary_inverse() const
     return result;
 }
 
+bn128_GT bn128_GT::cyclotomic_squared() const
+{
+    // ate-pairing does not expose its cyclotomic squaring, so square generically
+    bn128_GT result;
+    bn::Fp12::mul(result.elem, this->elem, this->elem);
+    return result;
+}
+
 bn128_GT bn128_GT::one()
 {
     return GT_one;
@@ -29,6 +29,7 @@ public:
 
     bn128_GT operator*(const bn128_GT &other) const;
     bn128_GT unitary_inverse() const;
+    bn128_GT cyclotomic_squared() const;
 
     static bn128_GT one();
 
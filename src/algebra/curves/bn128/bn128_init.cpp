@@ -12,8 +12,57 @@
 
 namespace libsnark {
 
-bigint<bn128_r_limbs> bn128_modulus_r;
-bigint<bn128_q_limbs> bn128_modulus_q;
+/* parameters for scalar field Fr */
+
+/* 21888242871839275222246405745257275088548364400416034343698204186575808495617 */
+bigint<bn128_r_limbs> bn128_modulus_r = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x43e1f593f0000001), BIGINT_LIMB64(0x2833e84879b97091), BIGINT_LIMB64(0xb85045b68181585d), BIGINT_LIMB64(0x30644e72e131a029));
+/* 944936681149208446651664254269745548490766851729442924617792859073125903783 */
+template<> bigint<bn128_r_limbs> bn128_Fr::Rsquared = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x1bb8e645ae216da7), BIGINT_LIMB64(0x53fe3ab1e35c59e3), BIGINT_LIMB64(0x8c49833d53bb8085), BIGINT_LIMB64(0x0216d0b17f4e44a5));
+/* 5866548545943845227489894872040244720403868105578784105281690076696998248512 */
+template<> bigint<bn128_r_limbs> bn128_Fr::Rcubed = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x5e94d8e1b4bf0040), BIGINT_LIMB64(0x2a489cbe1cfbb6b8), BIGINT_LIMB64(0x893cc664a19fcfed), BIGINT_LIMB64(0x0cf8594b7fcc657c));
+template<> mp_limb_t bn128_Fr::inv = (mp_limb_t) 0xc2e1f593efffffff;
+template<> size_t bn128_Fr::num_bits = 254;
+/* 10944121435919637611123202872628637544274182200208017171849102093287904247808 */
+template<> bigint<bn128_r_limbs> bn128_Fr::euler = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xa1f0fac9f8000000), BIGINT_LIMB64(0x9419f4243cdcb848), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+template<> size_t bn128_Fr::s = 28;
+/* 81540058820840996586704275553141814055101440848469862132140264610111 */
+template<> bigint<bn128_r_limbs> bn128_Fr::t = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x9b9709143e1f593f), BIGINT_LIMB64(0x181585d2833e8487), BIGINT_LIMB64(0x131a029b85045b68), BIGINT_LIMB64(0x000000030644e72e));
+/* 40770029410420498293352137776570907027550720424234931066070132305055 */
+template<> bigint<bn128_r_limbs> bn128_Fr::t_minus_1_over_2 = bigint<bn128_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xcdcb848a1f0fac9f), BIGINT_LIMB64(0x0c0ac2e9419f4243), BIGINT_LIMB64(0x098d014dc2822db4), BIGINT_LIMB64(0x0000000183227397));
+/* 5 */
+template<> bn128_Fr bn128_Fr::multiplicative_generator = bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x1b0d0ef99fffffe6), BIGINT_LIMB64(0xeaba68a3a32a913f), BIGINT_LIMB64(0x47d8eb76d8dd0689), BIGINT_LIMB64(0x15d0085520f5bbc3));
+/* 19103219067921713944291392827692070036145651957329286315305642004821462161904 */
+template<> bn128_Fr bn128_Fr::root_of_unity = bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x636e735580d13d9c), BIGINT_LIMB64(0xa22bf3742445ffd6), BIGINT_LIMB64(0x56452ac01eb203d8), BIGINT_LIMB64(0x1860ef942963f9e7));
+/* 5 */
+template<> bn128_Fr bn128_Fr::nqr = bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x1b0d0ef99fffffe6), BIGINT_LIMB64(0xeaba68a3a32a913f), BIGINT_LIMB64(0x47d8eb76d8dd0689), BIGINT_LIMB64(0x15d0085520f5bbc3));
+/* 19103219067921713944291392827692070036145651957329286315305642004821462161904 */
+template<> bn128_Fr bn128_Fr::nqr_to_t = bn128_Fr(montgomery_limbs, BIGINT_LIMB64(0x636e735580d13d9c), BIGINT_LIMB64(0xa22bf3742445ffd6), BIGINT_LIMB64(0x56452ac01eb203d8), BIGINT_LIMB64(0x1860ef942963f9e7));
+
+/* parameters for base field Fq */
+
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208583 */
+bigint<bn128_q_limbs> bn128_modulus_q = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x3c208c16d87cfd47), BIGINT_LIMB64(0x97816a916871ca8d), BIGINT_LIMB64(0xb85045b68181585d), BIGINT_LIMB64(0x30644e72e131a029));
+/* 3096616502983703923843567936837374451735540968419076528771170197431451843209 */
+template<> bigint<bn128_q_limbs> bn128_Fq::Rsquared = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xf32cfc5b538afa89), BIGINT_LIMB64(0xb5e71911d44501fb), BIGINT_LIMB64(0x47ab1eff0a417ff6), BIGINT_LIMB64(0x06d89f71cab8351f));
+/* 14921786541159648185948152738563080959093619838510245177710943249661917737183 */
+template<> bigint<bn128_q_limbs> bn128_Fq::Rcubed = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xb1cd6dafda1530df), BIGINT_LIMB64(0x62f210e6a7283db6), BIGINT_LIMB64(0xef7f0b0c0ada0afb), BIGINT_LIMB64(0x20fd6e902d592544));
+template<> mp_limb_t bn128_Fq::inv = (mp_limb_t) 0x87d20782e4866389;
+template<> size_t bn128_Fq::num_bits = 254;
+/* 10944121435919637611123202872628637544348155578648911831344518947322613104291 */
+template<> bigint<bn128_q_limbs> bn128_Fq::euler = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9e10460b6c3e7ea3), BIGINT_LIMB64(0xcbc0b548b438e546), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+template<> size_t bn128_Fq::s = 1;
+/* 10944121435919637611123202872628637544348155578648911831344518947322613104291 */
+template<> bigint<bn128_q_limbs> bn128_Fq::t = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x9e10460b6c3e7ea3), BIGINT_LIMB64(0xcbc0b548b438e546), BIGINT_LIMB64(0xdc2822db40c0ac2e), BIGINT_LIMB64(0x183227397098d014));
+/* 5472060717959818805561601436314318772174077789324455915672259473661306552145 */
+template<> bigint<bn128_q_limbs> bn128_Fq::t_minus_1_over_2 = bigint<bn128_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x4f082305b61f3f51), BIGINT_LIMB64(0x65e05aa45a1c72a3), BIGINT_LIMB64(0x6e14116da0605617), BIGINT_LIMB64(0x0c19139cb84c680a));
+/* 3 */
+template<> bn128_Fq bn128_Fq::multiplicative_generator = bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a17caa950ad28d7), BIGINT_LIMB64(0x1f6ac17ae15521b9), BIGINT_LIMB64(0x334bea4e696bd284), BIGINT_LIMB64(0x2a1f6744ce179d8e));
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+template<> bn128_Fq bn128_Fq::root_of_unity = bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa));
+/* 3 */
+template<> bn128_Fq bn128_Fq::nqr = bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a17caa950ad28d7), BIGINT_LIMB64(0x1f6ac17ae15521b9), BIGINT_LIMB64(0x334bea4e696bd284), BIGINT_LIMB64(0x2a1f6744ce179d8e));
+/* 21888242871839275222246405745257275088696311157297823662689037894645226208582 */
+template<> bn128_Fq bn128_Fq::nqr_to_t = bn128_Fq(montgomery_limbs, BIGINT_LIMB64(0x68c3488912edefaa), BIGINT_LIMB64(0x8d087f6872aabf4f), BIGINT_LIMB64(0x51e1a24709081231), BIGINT_LIMB64(0x2259d6b14729c0fa));
 
 bn::Fp bn128_coeff_b;
 size_t bn128_Fq_s;
@@ -29,60 +78,10 @@ void init_bn128_params()
 {
     bn::Param::init(); // init ate-pairing library
 
-    typedef bigint<bn128_r_limbs> bigint_r;
-    typedef bigint<bn128_q_limbs> bigint_q;
-
-    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4); // Montgomery assumes this
-
-    /* parameters for scalar field Fr */
-    bn128_modulus_r = bigint_r("21888242871839275222246405745257275088548364400416034343698204186575808495617");
+    /* parameters of Fr and Fq are constant-initialized above; just check that Montgomery arithmetic applies */
+    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4);
     assert(bn128_Fr::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        bn128_Fr::Rsquared = bigint_r("944936681149208446651664254269745548490766851729442924617792859073125903783");
-        bn128_Fr::Rcubed = bigint_r("5866548545943845227489894872040244720403868105578784105281690076696998248512");
-        bn128_Fr::inv = 0xc2e1f593efffffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        bn128_Fr::Rsquared = bigint_r("944936681149208446651664254269745548490766851729442924617792859073125903783");
-        bn128_Fr::Rcubed = bigint_r("5866548545943845227489894872040244720403868105578784105281690076696998248512");
-        bn128_Fr::inv = 0xefffffff;
-    }
-    bn128_Fr::num_bits = 254;
-    bn128_Fr::euler = bigint_r("10944121435919637611123202872628637544274182200208017171849102093287904247808");
-    bn128_Fr::s = 28;
-    bn128_Fr::t = bigint_r("81540058820840996586704275553141814055101440848469862132140264610111");
-    bn128_Fr::t_minus_1_over_2 = bigint_r("40770029410420498293352137776570907027550720424234931066070132305055");
-    bn128_Fr::multiplicative_generator = bn128_Fr("5");
-    bn128_Fr::root_of_unity = bn128_Fr("19103219067921713944291392827692070036145651957329286315305642004821462161904");
-    bn128_Fr::nqr = bn128_Fr("5");
-    bn128_Fr::nqr_to_t = bn128_Fr("19103219067921713944291392827692070036145651957329286315305642004821462161904");
-
-    /* parameters for base field Fq */
-    bn128_modulus_q = bigint_q("21888242871839275222246405745257275088696311157297823662689037894645226208583");
     assert(bn128_Fq::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735540968419076528771170197431451843209");
-        bn128_Fq::Rcubed = bigint_q("14921786541159648185948152738563080959093619838510245177710943249661917737183");
-        bn128_Fq::inv = 0x87d20782e4866389;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        bn128_Fq::Rsquared = bigint_q("3096616502983703923843567936837374451735540968419076528771170197431451843209");
-        bn128_Fq::Rcubed = bigint_q("14921786541159648185948152738563080959093619838510245177710943249661917737183");
-        bn128_Fq::inv = 0xe4866389;
-    }
-    bn128_Fq::num_bits = 254;
-    bn128_Fq::euler = bigint_q("10944121435919637611123202872628637544348155578648911831344518947322613104291");
-    bn128_Fq::s = 1;
-    bn128_Fq::t = bigint_q("10944121435919637611123202872628637544348155578648911831344518947322613104291");
-    bn128_Fq::t_minus_1_over_2 = bigint_q("5472060717959818805561601436314318772174077789324455915672259473661306552145");
-    bn128_Fq::multiplicative_generator = bn128_Fq("3");
-    bn128_Fq::root_of_unity = bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
-    bn128_Fq::nqr = bn128_Fq("3");
-    bn128_Fq::nqr_to_t = bn128_Fq("21888242871839275222246405745257275088696311157297823662689037894645226208582");
 
     /* additional parameters for square roots in Fq/Fq2 */
     bn128_coeff_b = bn::Fp(3);
@@ -106,58 +105,6 @@ void init_bn128_params()
     bn128_G1::G1_one.coord[1] = bn::Fp(2);
     bn128_G1::G1_one.coord[2] = bn::Fp(1);
 
-    bn128_G1::wnaf_window_table.resize(0);
-    bn128_G1::wnaf_window_table.push_back(10);
-    bn128_G1::wnaf_window_table.push_back(24);
-    bn128_G1::wnaf_window_table.push_back(40);
-    bn128_G1::wnaf_window_table.push_back(132);
-
-    bn128_G1::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.24]
-    bn128_G1::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.24, 10.43]
-    bn128_G1::fixed_base_exp_window_table.push_back(4);
-    // window 3 is unbeaten in [10.43, 24.88]
-    bn128_G1::fixed_base_exp_window_table.push_back(10);
-    // window 4 is unbeaten in [24.88, 62.10]
-    bn128_G1::fixed_base_exp_window_table.push_back(25);
-    // window 5 is unbeaten in [62.10, 157.80]
-    bn128_G1::fixed_base_exp_window_table.push_back(62);
-    // window 6 is unbeaten in [157.80, 362.05]
-    bn128_G1::fixed_base_exp_window_table.push_back(158);
-    // window 7 is unbeaten in [362.05, 806.67]
-    bn128_G1::fixed_base_exp_window_table.push_back(362);
-    // window 8 is unbeaten in [806.67, 2090.34]
-    bn128_G1::fixed_base_exp_window_table.push_back(807);
-    // window 9 is unbeaten in [2090.34, 4459.58]
-    bn128_G1::fixed_base_exp_window_table.push_back(2090);
-    // window 10 is unbeaten in [4459.58, 9280.12]
-    bn128_G1::fixed_base_exp_window_table.push_back(4460);
-    // window 11 is unbeaten in [9280.12, 43302.64]
-    bn128_G1::fixed_base_exp_window_table.push_back(9280);
-    // window 12 is unbeaten in [43302.64, 210998.73]
-    bn128_G1::fixed_base_exp_window_table.push_back(43303);
-    // window 13 is never the best
-    bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 14 is never the best
-    bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 15 is unbeaten in [210998.73, 506869.47]
-    bn128_G1::fixed_base_exp_window_table.push_back(210999);
-    // window 16 is unbeaten in [506869.47, 930023.36]
-    bn128_G1::fixed_base_exp_window_table.push_back(506869);
-    // window 17 is unbeaten in [930023.36, 8350812.20]
-    bn128_G1::fixed_base_exp_window_table.push_back(930023);
-    // window 18 is never the best
-    bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 19 is never the best
-    bn128_G1::fixed_base_exp_window_table.push_back(0);
-    // window 20 is unbeaten in [8350812.20, 21708138.87]
-    bn128_G1::fixed_base_exp_window_table.push_back(8350812);
-    // window 21 is unbeaten in [21708138.87, 29482995.52]
-    bn128_G1::fixed_base_exp_window_table.push_back(21708139);
-    // window 22 is unbeaten in [29482995.52, inf]
-    bn128_G1::fixed_base_exp_window_table.push_back(29482996);
-
     /* choice of group G2 */
     bn128_G2::G2_zero.coord[0] = bn::Fp2(bn::Fp(1), bn::Fp(0));
     bn128_G2::G2_zero.coord[1] = bn::Fp2(bn::Fp(1), bn::Fp(0));
@@ -169,58 +116,6 @@ void init_bn128_params()
                                         bn::Fp("20532875081203448695448744255224543661959516361327385779878476709582931298750"));
     bn128_G2::G2_one.coord[2] = bn::Fp2(bn::Fp(1), bn::Fp(0));
 
-    bn128_G2::wnaf_window_table.resize(0);
-    bn128_G2::wnaf_window_table.push_back(7);
-    bn128_G2::wnaf_window_table.push_back(18);
-    bn128_G2::wnaf_window_table.push_back(35);
-    bn128_G2::wnaf_window_table.push_back(116);
-
-    bn128_G2::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.13]
-    bn128_G2::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.13, 10.72]
-    bn128_G2::fixed_base_exp_window_table.push_back(4);
-    // window 3 is unbeaten in [10.72, 25.60]
-    bn128_G2::fixed_base_exp_window_table.push_back(11);
-    // window 4 is unbeaten in [25.60, 60.99]
-    bn128_G2::fixed_base_exp_window_table.push_back(26);
-    // window 5 is unbeaten in [60.99, 153.66]
-    bn128_G2::fixed_base_exp_window_table.push_back(61);
-    // window 6 is unbeaten in [153.66, 353.13]
-    bn128_G2::fixed_base_exp_window_table.push_back(154);
-    // window 7 is unbeaten in [353.13, 771.87]
-    bn128_G2::fixed_base_exp_window_table.push_back(353);
-    // window 8 is unbeaten in [771.87, 2025.85]
-    bn128_G2::fixed_base_exp_window_table.push_back(772);
-    // window 9 is unbeaten in [2025.85, 4398.65]
-    bn128_G2::fixed_base_exp_window_table.push_back(2026);
-    // window 10 is unbeaten in [4398.65, 10493.42]
-    bn128_G2::fixed_base_exp_window_table.push_back(4399);
-    // window 11 is unbeaten in [10493.42, 37054.73]
-    bn128_G2::fixed_base_exp_window_table.push_back(10493);
-    // window 12 is unbeaten in [37054.73, 49928.78]
-    bn128_G2::fixed_base_exp_window_table.push_back(37055);
-    // window 13 is unbeaten in [49928.78, 114502.82]
-    bn128_G2::fixed_base_exp_window_table.push_back(49929);
-    // window 14 is unbeaten in [114502.82, 161445.26]
-    bn128_G2::fixed_base_exp_window_table.push_back(114503);
-    // window 15 is unbeaten in [161445.26, 470648.01]
-    bn128_G2::fixed_base_exp_window_table.push_back(161445);
-    // window 16 is unbeaten in [470648.01, 1059821.87]
-    bn128_G2::fixed_base_exp_window_table.push_back(470648);
-    // window 17 is unbeaten in [1059821.87, 5450848.25]
-    bn128_G2::fixed_base_exp_window_table.push_back(1059822);
-    // window 18 is never the best
-    bn128_G2::fixed_base_exp_window_table.push_back(0);
-    // window 19 is unbeaten in [5450848.25, 5566795.57]
-    bn128_G2::fixed_base_exp_window_table.push_back(5450848);
-    // window 20 is unbeaten in [5566795.57, 33055217.52]
-    bn128_G2::fixed_base_exp_window_table.push_back(5566796);
-    // window 21 is never the best
-    bn128_G2::fixed_base_exp_window_table.push_back(0);
-    // window 22 is unbeaten in [33055217.52, inf]
-    bn128_G2::fixed_base_exp_window_table.push_back(33055218);
-
     bn128_GT::GT_one.elem = bn::Fp12(1);
 }
 } // libsnark
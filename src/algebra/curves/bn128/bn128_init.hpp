@@ -35,6 +35,36 @@ extern mie::Vuint bn128_Fq2_t_minus_1_over_2;
 typedef Fp_model<bn128_r_limbs, bn128_modulus_r> bn128_Fr;
 typedef Fp_model<bn128_q_limbs, bn128_modulus_q> bn128_Fq;
 
+/*
+ * The parameters of Fr and Fq are constant-initialized in bn128_init.cpp,
+ * so they can be used without calling init_bn128_params() first. (The
+ * ate-pairing library still has to be initialized by it.)
+ */
+template<> bigint<bn128_r_limbs> bn128_Fr::Rsquared;
+template<> bigint<bn128_r_limbs> bn128_Fr::Rcubed;
+template<> mp_limb_t bn128_Fr::inv;
+template<> size_t bn128_Fr::num_bits;
+template<> bigint<bn128_r_limbs> bn128_Fr::euler;
+template<> size_t bn128_Fr::s;
+template<> bigint<bn128_r_limbs> bn128_Fr::t;
+template<> bigint<bn128_r_limbs> bn128_Fr::t_minus_1_over_2;
+template<> bn128_Fr bn128_Fr::multiplicative_generator;
+template<> bn128_Fr bn128_Fr::root_of_unity;
+template<> bn128_Fr bn128_Fr::nqr;
+template<> bn128_Fr bn128_Fr::nqr_to_t;
+template<> bigint<bn128_q_limbs> bn128_Fq::Rsquared;
+template<> bigint<bn128_q_limbs> bn128_Fq::Rcubed;
+template<> mp_limb_t bn128_Fq::inv;
+template<> size_t bn128_Fq::num_bits;
+template<> bigint<bn128_q_limbs> bn128_Fq::euler;
+template<> size_t bn128_Fq::s;
+template<> bigint<bn128_q_limbs> bn128_Fq::t;
+template<> bigint<bn128_q_limbs> bn128_Fq::t_minus_1_over_2;
+template<> bn128_Fq bn128_Fq::multiplicative_generator;
+template<> bn128_Fq bn128_Fq::root_of_unity;
+template<> bn128_Fq bn128_Fq::nqr;
+template<> bn128_Fq bn128_Fq::nqr_to_t;
+
 void init_bn128_params();
 
 class bn128_G1;
@@ -8,6 +8,7 @@
  * @copyright  MIT license (see LICENSE file)
  *******************************************************************************/
 
+#include <cassert>
 #include <sstream>
 
 #include "algebra/curves/bn128/bn128_pairing.hpp"
@@ -201,6 +202,21 @@ bn128_Fq12 bn128_double_ate_miller_loop(const bn128_ate_G1_precomp &prec_P1,
     return f;
 }
 
+std::vector<bn128_Fq12> bn128_ate_batch_miller_loop(const std::vector<bn128_ate_G1_precomp> &prec_P,
+                                                    const std::vector<bn128_ate_G2_precomp> &prec_Q)
+{
+    assert(prec_P.size() == prec_Q.size());
+    std::vector<bn128_Fq12> result(prec_P.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < prec_P.size(); ++j)
+    {
+        bn::components::millerLoop(result[j].elem, prec_Q[j].coeffs, prec_P[j].P);
+    }
+    return result;
+}
+
 bn128_GT bn128_final_exponentiation(const bn128_Fq12 &elt)
 {
     enter_block("Call to bn128_final_exponentiation");
@@ -10,6 +10,7 @@
 
 #ifndef BN128_PAIRING_HPP_
 #define BN128_PAIRING_HPP_
+#include <vector>
 #include "algebra/curves/bn128/bn128_g1.hpp"
 #include "algebra/curves/bn128/bn128_g2.hpp"
 #include "algebra/curves/bn128/bn128_gt.hpp"
@@ -45,6 +46,9 @@ bn128_Fq12 bn128_double_ate_miller_loop(const bn128_ate_G1_precomp &prec_P1,
                                         const bn128_ate_G2_precomp &prec_Q2);
 bn128_Fq12 bn128_ate_miller_loop(const bn128_ate_G1_precomp &prec_P,
                                  const bn128_ate_G2_precomp &prec_Q);
+/* Miller loops of the independent pairs (prec_P[i], prec_Q[i]) */
+std::vector<bn128_Fq12> bn128_ate_batch_miller_loop(const std::vector<bn128_ate_G1_precomp> &prec_P,
+                                                    const std::vector<bn128_ate_G2_precomp> &prec_Q);
 
 bn128_GT bn128_final_exponentiation(const bn128_Fq12 &elt);
 
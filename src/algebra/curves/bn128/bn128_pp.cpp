@@ -30,6 +30,11 @@ bn128_ate_G2_precomp bn128_pp::precompute_G2(const bn128_G2 &Q)
     return bn128_ate_precompute_G2(Q);
 }
 
+bn128_ate_G2_precomp bn128_pp::precompute_G2_for_reuse(const bn128_G2 &Q)
+{
+    return bn128_pp::precompute_G2(Q);
+}
+
 bn128_Fq12 bn128_pp::miller_loop(const bn128_ate_G1_precomp &prec_P,
                                  const bn128_ate_G2_precomp &prec_Q)
 {
@@ -50,6 +55,15 @@ bn128_Fq12 bn128_pp::double_miller_loop(const bn128_ate_G1_precomp &prec_P1,
     return result;
 }
 
+std::vector<bn128_Fq12> bn128_pp::batch_miller_loop(const std::vector<bn128_ate_G1_precomp> &prec_P,
+                                                    const std::vector<bn128_ate_G2_precomp> &prec_Q)
+{
+    enter_block("Call to batch_miller_loop<bn128_pp>");
+    std::vector<bn128_Fq12> result = bn128_ate_batch_miller_loop(prec_P, prec_Q);
+    leave_block("Call to batch_miller_loop<bn128_pp>");
+    return result;
+}
+
 bn128_Fq12 bn128_pp::pairing(const bn128_G1 &P,
                              const bn128_G2 &Q)
 {
@@ -33,12 +33,15 @@ public:
     static bn128_GT final_exponentiation(const bn128_Fq12 &elt);
     static bn128_ate_G1_precomp precompute_G1(const bn128_G1 &P);
     static bn128_ate_G2_precomp precompute_G2(const bn128_G2 &Q);
+    static bn128_ate_G2_precomp precompute_G2_for_reuse(const bn128_G2 &Q);
     static bn128_Fq12 miller_loop(const bn128_ate_G1_precomp &prec_P,
                                   const bn128_ate_G2_precomp &prec_Q);
     static bn128_Fq12 double_miller_loop(const bn128_ate_G1_precomp &prec_P1,
                                          const bn128_ate_G2_precomp &prec_Q1,
                                          const bn128_ate_G1_precomp &prec_P2,
                                          const bn128_ate_G2_precomp &prec_Q2);
+    static std::vector<bn128_Fq12> batch_miller_loop(const std::vector<bn128_ate_G1_precomp> &prec_P,
+                                                     const std::vector<bn128_ate_G2_precomp> &prec_Q);
 
     /* the following are used in test files */
     static bn128_GT pairing(const bn128_G1 &P,
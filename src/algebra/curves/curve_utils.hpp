@@ -8,6 +8,7 @@
 #ifndef CURVE_UTILS_HPP_
 #define CURVE_UTILS_HPP_
 #include <cstdint>
+#include <vector>
 
 #include "algebra/fields/bigint.hpp"
 
@@ -16,6 +17,25 @@ namespace libsnark {
 template<typename GroupT, mp_size_t m>
 GroupT scalar_mul(const GroupT &base, const bigint<m> &scalar);
 
+/**
+ * Check that a point P, assumed to lie on the curve, lies in the subgroup of
+ * order GroupT::order().
+ *
+ * The generic check multiplies P by the order; curves specialize it when the
+ * cofactor is 1 (nothing to check) or an endomorphism yields a cheaper test.
+ */
+template<typename GroupT>
+bool is_in_subgroup(const GroupT &P);
+
+/**
+ * Check that all elements of vec lie on the curve and in the subgroup of order
+ * GroupT::order(), in parallel across elements (when compiled with MULTICORE).
+ *
+ * Points read from untrusted sources (e.g., proofs) must pass this check.
+ */
+template<typename GroupT>
+bool batch_is_valid(const std::vector<GroupT> &vec);
+
 } // libsnark
 #include "algebra/curves/curve_utils.tcc"
 
@@ -33,5 +33,26 @@ GroupT scalar_mul(const GroupT &base, const bigint<m> &scalar)
     return result;
 }
 
+template<typename GroupT>
+bool is_in_subgroup(const GroupT &P)
+{
+    return scalar_mul<GroupT>(P, GroupT::order()).is_zero();
+}
+
+template<typename GroupT>
+bool batch_is_valid(const std::vector<GroupT> &vec)
+{
+    bool result = true;
+#ifdef MULTICORE
+#pragma omp parallel for reduction(&&:result)
+#endif
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        result = result && vec[i].is_well_formed() && is_in_subgroup<GroupT>(vec[i]);
+    }
+
+    return result;
+}
+
 } // libsnark
 #endif // CURVE_UTILS_TCC_
@@ -14,10 +14,57 @@ long long edwards_G1::add_cnt = 0;
 long long edwards_G1::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> edwards_G1::wnaf_window_table;
-std::vector<size_t> edwards_G1::fixed_base_exp_window_table;
-edwards_G1 edwards_G1::G1_zero;
-edwards_G1 edwards_G1::G1_one;
+std::vector<size_t> edwards_G1::wnaf_window_table = { 9, 14, 24, 117 };
+std::vector<size_t> edwards_G1::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.10]
+    1,
+    // window 2 is unbeaten in [4.10, 9.69]
+    4,
+    // window 3 is unbeaten in [9.69, 25.21]
+    10,
+    // window 4 is unbeaten in [25.21, 60.00]
+    25,
+    // window 5 is unbeaten in [60.00, 149.33]
+    60,
+    // window 6 is unbeaten in [149.33, 369.61]
+    149,
+    // window 7 is unbeaten in [369.61, 849.07]
+    370,
+    // window 8 is unbeaten in [849.07, 1764.94]
+    849,
+    // window 9 is unbeaten in [1764.94, 4429.59]
+    1765,
+    // window 10 is unbeaten in [4429.59, 13388.78]
+    4430,
+    // window 11 is unbeaten in [13388.78, 15368.00]
+    13389,
+    // window 12 is unbeaten in [15368.00, 74912.07]
+    15368,
+    // window 13 is unbeaten in [74912.07, 438107.20]
+    74912,
+    // window 14 is never the best
+    0,
+    // window 15 is unbeaten in [438107.20, 1045626.18]
+    438107,
+    // window 16 is never the best
+    0,
+    // window 17 is unbeaten in [1045626.18, 1577434.48]
+    1045626,
+    // window 18 is unbeaten in [1577434.48, 17350594.23]
+    1577434,
+    // window 19 is never the best
+    0,
+    // window 20 is never the best
+    0,
+    // window 21 is unbeaten in [17350594.23, inf]
+    17350594,
+    // window 22 is never the best
+    0
+};
+/* (1, 0, 0) */
+edwards_G1 edwards_G1::G1_zero = edwards_G1(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (4869953702976555123067178261685365085639705297852816679, 3713709671941291996998665608188072510389821008693530490, 5784117754931168290907668375627317834973537199927293100) */
+edwards_G1 edwards_G1::G1_one = edwards_G1(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb30273ff7784c6ad), BIGINT_LIMB64(0x4026bd1ce5f27c4d), BIGINT_LIMB64(0x0002e3974749392b)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x83404532a5e4e1c2), BIGINT_LIMB64(0x41985d6bf3d13c97), BIGINT_LIMB64(0x003b1f51f0e532ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x1b48dbf01e8c0c38), BIGINT_LIMB64(0x275f567400be1278), BIGINT_LIMB64(0x000ad2b4e125be71)));
 
 edwards_G1::edwards_G1()
 {
@@ -10,6 +10,9 @@
 #include <vector>
 #include "algebra/curves/edwards/edwards_init.hpp"
 #include "algebra/curves/curve_utils.hpp"
+#ifdef EDWARDS_EXTENDED_COORDINATES
+#include "algebra/scalar_multiplication/multiexp.hpp"
+#endif
 
 namespace libsnark {
 
@@ -31,7 +34,7 @@ public:
     edwards_Fq X, Y, Z;
     edwards_G1();
 private:
-    edwards_G1(const edwards_Fq& X, const edwards_Fq& Y, const edwards_Fq& Z) : X(X), Y(Y), Z(Z) {};
+    constexpr edwards_G1(const edwards_Fq& X, const edwards_Fq& Y, const edwards_Fq& Z) : X(X), Y(Y), Z(Z) {};
 
 public:
     typedef edwards_Fq base_field;
@@ -93,5 +96,16 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<edwards_G1>(std::vector<edwards_G1> &vec);
 
+#ifdef EDWARDS_EXTENDED_COORDINATES
+/* runs in extended coordinates; see edwards_g1_extended.hpp */
+template<>
+edwards_G1 multi_exp<edwards_G1, edwards_Fr>(typename std::vector<edwards_G1>::const_iterator vec_start,
+                                             typename std::vector<edwards_G1>::const_iterator vec_end,
+                                             typename std::vector<edwards_Fr>::const_iterator scalar_start,
+                                             typename std::vector<edwards_Fr>::const_iterator scalar_end,
+                                             const size_t chunks,
+                                             const bool use_multiexp);
+#endif
+
 } // libsnark
 #endif // EDWARDS_G1_HPP_
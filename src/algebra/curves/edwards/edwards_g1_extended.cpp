@@ -0,0 +1,374 @@
+/** @file
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "algebra/curves/edwards/edwards_g1_extended.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
+
+namespace libsnark {
+
+#ifdef PROFILE_OP_COUNTS
+long long edwards_G1_extended::add_cnt = 0;
+long long edwards_G1_extended::dbl_cnt = 0;
+#endif
+
+/*
+ * Copied from edwards_G1, and not tuned for extended coordinates: additions are
+ * cheaper here while doublings cost the same, so the optimal windows may differ
+ * slightly. Any table gives correct results; only the speed depends on it.
+ */
+std::vector<size_t> edwards_G1_extended::wnaf_window_table = { 9, 14, 24, 117 };
+std::vector<size_t> edwards_G1_extended::fixed_base_exp_window_table = {
+    1, 4, 10, 25, 60, 149, 370, 849, 1765, 4430, 13389, 15368, 74912, 0, 438107, 0, 1045626, 1577434, 0, 0, 17350594, 0
+};
+/* (0 : 1 : 0 : 1) */
+edwards_G1_extended edwards_G1_extended::G1_zero = edwards_G1_extended(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)));
+/* (1327083757088188761489777392944171127510681576046362549 : 4869953702976555123067178261685365085639705297852816679 : 3116582408467394607114223719259564873589852056782792368 : 1) */
+edwards_G1_extended edwards_G1_extended::G1_one = edwards_G1_extended(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb0382c80b8d6b928), BIGINT_LIMB64(0xa3aaba7c9f78992c), BIGINT_LIMB64(0x00170517ab31e956)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb30273ff7784c6ad), BIGINT_LIMB64(0x4026bd1ce5f27c4d), BIGINT_LIMB64(0x0002e3974749392b)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x9cfa79557d0cdc09), BIGINT_LIMB64(0xdbd2e3bc6e995697), BIGINT_LIMB64(0x002db06e846651ff)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)));
+/* 2673475430809012542195773683354635313487149135583974261 */
+edwards_Fq edwards_G1_extended::sqrt_minus_one = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xfb2d0fdfa3914637), BIGINT_LIMB64(0x82db20d0d5f56423), BIGINT_LIMB64(0x000fca14df46f627));
+/* 5008880256719072028433907471060961736896551157318705953 */
+edwards_Fq edwards_G1_extended::coeff_k = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb55c4ba220f8c48b), BIGINT_LIMB64(0x3e9335d9517903ec), BIGINT_LIMB64(0x0000c646ea10ab4c));
+
+edwards_G1_extended::edwards_G1_extended()
+{
+    this->X = G1_zero.X;
+    this->Y = G1_zero.Y;
+    this->T = G1_zero.T;
+    this->Z = G1_zero.Z;
+}
+
+edwards_G1_extended::edwards_G1_extended(const edwards_G1 &P)
+{
+    if (P.is_zero())
+    {
+        *this = G1_zero;
+    }
+    else
+    {
+        /* P is (x, y) = (P.Z/P.X, P.Z/P.Y) and u = sqrt(-1)*x, so take Z = P.X*P.Y */
+        this->X = sqrt_minus_one * (P.Y * P.Z);
+        this->Y = P.X * P.Z;
+        this->T = sqrt_minus_one * P.Z.squared();
+        this->Z = P.X * P.Y;
+    }
+}
+
+edwards_G1 edwards_G1_extended::to_edwards_G1() const
+{
+    if (this->is_zero())
+    {
+        return edwards_G1::zero();
+    }
+
+    // NOTE: like edwards_G1 itself, does not handle pts of order 2,4 (x = 0 or y = 0)
+    /* x = -sqrt(-1)*X/Z and y = Y/Z */
+    const edwards_Fq x_num = -(sqrt_minus_one * this->X);
+    edwards_G1 result;
+    result.X = this->Y * this->Z;
+    result.Y = x_num * this->Z;
+    result.Z = x_num * this->Y;
+    return result;
+}
+
+void edwards_G1_extended::print() const
+{
+    if (this->is_zero())
+    {
+        printf("O\n");
+    }
+    else
+    {
+        /* print (x, y) on the edwards curve, not (u, y) */
+        this->to_edwards_G1().print();
+    }
+}
+
+void edwards_G1_extended::print_coordinates() const
+{
+    gmp_printf("(%Nd : %Nd : %Nd : %Nd)\n",
+               this->X.as_bigint().data, edwards_Fq::num_limbs,
+               this->Y.as_bigint().data, edwards_Fq::num_limbs,
+               this->T.as_bigint().data, edwards_Fq::num_limbs,
+               this->Z.as_bigint().data, edwards_Fq::num_limbs);
+}
+
+void edwards_G1_extended::to_affine_coordinates()
+{
+    const edwards_Fq Z_inv = this->Z.inverse();
+    this->X = this->X * Z_inv;
+    this->Y = this->Y * Z_inv;
+    this->T = this->T * Z_inv;
+    this->Z = edwards_Fq::one();
+}
+
+void edwards_G1_extended::to_special()
+{
+    this->to_affine_coordinates();
+}
+
+bool edwards_G1_extended::is_special() const
+{
+    return (this->Z == edwards_Fq::one());
+}
+
+bool edwards_G1_extended::is_zero() const
+{
+    return (this->X.is_zero() && this->Y == this->Z);
+}
+
+bool edwards_G1_extended::operator==(const edwards_G1_extended &other) const
+{
+    // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+    if ((this->X * other.Z) != (other.X * this->Z))
+    {
+        return false;
+    }
+
+    // Y1/Z1 = Y2/Z2 <=> Y1*Z2 = Y2*Z1
+    if ((this->Y * other.Z) != (other.Y * this->Z))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool edwards_G1_extended::operator!=(const edwards_G1_extended& other) const
+{
+    return !(operator==(other));
+}
+
+edwards_G1_extended edwards_G1_extended::operator+(const edwards_G1_extended &other) const
+{
+    // the addition law is complete, so there are no special cases
+    return this->add(other);
+}
+
+edwards_G1_extended edwards_G1_extended::operator-() const
+{
+    return edwards_G1_extended(-(this->X), this->Y, -(this->T), this->Z);
+}
+
+edwards_G1_extended edwards_G1_extended::operator-(const edwards_G1_extended &other) const
+{
+    return (*this) + (-other);
+}
+
+edwards_G1_extended edwards_G1_extended::add(const edwards_G1_extended &other) const
+{
+#ifdef PROFILE_OP_COUNTS
+    this->add_cnt++;
+#endif
+    // http://www.hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
+
+    const edwards_Fq A = (this->Y-this->X)*(other.Y-other.X);     // A = (Y1-X1)*(Y2-X2)
+    const edwards_Fq B = (this->Y+this->X)*(other.Y+other.X);     // B = (Y1+X1)*(Y2+X2)
+    const edwards_Fq C = coeff_k * ((this->T) * (other.T));       // C = T1*k*T2
+    const edwards_Fq ZZ = (this->Z) * (other.Z);
+    const edwards_Fq D = ZZ + ZZ;                                 // D = Z1*2*Z2
+    const edwards_Fq E = B - A;                                   // E = B-A
+    const edwards_Fq F = D - C;                                   // F = D-C
+    const edwards_Fq G = D + C;                                   // G = D+C
+    const edwards_Fq H = B + A;                                   // H = B+A
+    const edwards_Fq X3 = E*F;                                    // X3 = E*F
+    const edwards_Fq Y3 = G*H;                                    // Y3 = G*H
+    const edwards_Fq T3 = E*H;                                    // T3 = E*H
+    const edwards_Fq Z3 = F*G;                                    // Z3 = F*G
+
+    return edwards_G1_extended(X3, Y3, T3, Z3);
+}
+
+edwards_G1_extended edwards_G1_extended::mixed_add(const edwards_G1_extended &other) const
+{
+#ifdef PROFILE_OP_COUNTS
+    this->add_cnt++;
+#endif
+
+#ifdef DEBUG
+    assert(other.is_special());
+#endif
+
+    // http://www.hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
+
+    const edwards_Fq A = (this->Y-this->X)*(other.Y-other.X);     // A = (Y1-X1)*(Y2-X2)
+    const edwards_Fq B = (this->Y+this->X)*(other.Y+other.X);     // B = (Y1+X1)*(Y2+X2)
+    const edwards_Fq C = coeff_k * ((this->T) * (other.T));       // C = T1*k*T2
+    const edwards_Fq D = this->Z + this->Z;                       // D = 2*Z1
+    const edwards_Fq E = B - A;                                   // E = B-A
+    const edwards_Fq F = D - C;                                   // F = D-C
+    const edwards_Fq G = D + C;                                   // G = D+C
+    const edwards_Fq H = B + A;                                   // H = B+A
+    const edwards_Fq X3 = E*F;                                    // X3 = E*F
+    const edwards_Fq Y3 = G*H;                                    // Y3 = G*H
+    const edwards_Fq T3 = E*H;                                    // T3 = E*H
+    const edwards_Fq Z3 = F*G;                                    // Z3 = F*G
+
+    return edwards_G1_extended(X3, Y3, T3, Z3);
+}
+
+edwards_G1_extended edwards_G1_extended::dbl() const
+{
+#ifdef PROFILE_OP_COUNTS
+    this->dbl_cnt++;
+#endif
+    // http://www.hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#doubling-dbl-2008-hwcd
+
+    const edwards_Fq A = (this->X).squared();                     // A = X1^2
+    const edwards_Fq B = (this->Y).squared();                     // B = Y1^2
+    const edwards_Fq ZZ = (this->Z).squared();
+    const edwards_Fq C = ZZ + ZZ;                                 // C = 2*Z1^2
+    const edwards_Fq E = (this->X+this->Y).squared()-A-B;         // E = (X1+Y1)^2-A-B
+    const edwards_Fq G = B - A;                                   // G = D+B, D = a*A = -A
+    const edwards_Fq F = G - C;                                   // F = G-C
+    const edwards_Fq H = -(A + B);                                // H = D-B
+    const edwards_Fq X3 = E*F;                                    // X3 = E*F
+    const edwards_Fq Y3 = G*H;                                    // Y3 = G*H
+    const edwards_Fq T3 = E*H;                                    // T3 = E*H
+    const edwards_Fq Z3 = F*G;                                    // Z3 = F*G
+
+    return edwards_G1_extended(X3, Y3, T3, Z3);
+}
+
+bool edwards_G1_extended::is_well_formed() const
+{
+    /*
+      -u^2 + y^2 = 1 - d u^2 y^2 (the image of a x^2 + y^2 = 1 + d x^2 y^2, with a = 1 for G1)
+
+      In extended coordinates this reads
+
+      -X^2 + Y^2 = Z^2 - d T^2 and X*Y = T*Z
+    */
+    if (this->Z.is_zero())
+    {
+        return false;
+    }
+
+    const edwards_Fq X2 = this->X.squared();
+    const edwards_Fq Y2 = this->Y.squared();
+    const edwards_Fq Z2 = this->Z.squared();
+    const edwards_Fq T2 = this->T.squared();
+
+    return (Y2 - X2 == Z2 - edwards_coeff_d * T2 &&
+            this->X * this->Y == this->T * this->Z);
+}
+
+edwards_G1_extended edwards_G1_extended::zero()
+{
+    return G1_zero;
+}
+
+edwards_G1_extended edwards_G1_extended::one()
+{
+    return G1_one;
+}
+
+edwards_G1_extended edwards_G1_extended::random_element()
+{
+    return edwards_Fr::random_element().as_bigint() * G1_one;
+}
+
+std::ostream& operator<<(std::ostream &out, const edwards_G1_extended &g)
+{
+    /* same format as edwards_G1 */
+    out << g.to_edwards_G1();
+    return out;
+}
+
+std::istream& operator>>(std::istream &in, edwards_G1_extended &g)
+{
+    edwards_G1 P;
+    in >> P;
+    g = edwards_G1_extended(P);
+
+#ifdef USE_MIXED_ADDITION
+    g.to_special();
+#endif
+
+    return in;
+}
+
+std::ostream& operator<<(std::ostream& out, const std::vector<edwards_G1_extended> &v)
+{
+    out << v.size() << "\n";
+    for (const edwards_G1_extended& t : v)
+    {
+        out << t << OUTPUT_NEWLINE;
+    }
+
+    return out;
+}
+
+std::istream& operator>>(std::istream& in, std::vector<edwards_G1_extended> &v)
+{
+    v.clear();
+
+    size_t s;
+    in >> s;
+    v.reserve(s);
+    consume_newline(in);
+
+    for (size_t i = 0; i < s; ++i)
+    {
+        edwards_G1_extended g;
+        in >> g;
+        v.emplace_back(g);
+        consume_OUTPUT_NEWLINE(in);
+    }
+
+    return in;
+}
+
+template<>
+void batch_to_special_all_non_zeros<edwards_G1_extended>(std::vector<edwards_G1_extended> &vec)
+{
+    std::vector<edwards_Fq> Z_vec;
+    Z_vec.reserve(vec.size());
+
+    for (auto &el: vec)
+    {
+        Z_vec.emplace_back(el.Z);
+    }
+    batch_invert<edwards_Fq>(Z_vec);
+
+    const edwards_Fq one = edwards_Fq::one();
+
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        vec[i].X = vec[i].X * Z_vec[i];
+        vec[i].Y = vec[i].Y * Z_vec[i];
+        vec[i].T = vec[i].T * Z_vec[i];
+        vec[i].Z = one;
+    }
+}
+
+#ifdef EDWARDS_EXTENDED_COORDINATES
+template<>
+edwards_G1 multi_exp<edwards_G1, edwards_Fr>(typename std::vector<edwards_G1>::const_iterator vec_start,
+                                             typename std::vector<edwards_G1>::const_iterator vec_end,
+                                             typename std::vector<edwards_Fr>::const_iterator scalar_start,
+                                             typename std::vector<edwards_Fr>::const_iterator scalar_end,
+                                             const size_t chunks,
+                                             const bool use_multiexp)
+{
+    /* the conversion takes 5M+1S per base, and every addition afterwards saves 1M+1S */
+    std::vector<edwards_G1_extended> ext_vec(vec_end - vec_start);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < ext_vec.size(); ++i)
+    {
+        ext_vec[i] = edwards_G1_extended(*(vec_start + i));
+    }
+
+    const edwards_G1_extended result = multi_exp<edwards_G1_extended, edwards_Fr>(ext_vec.begin(), ext_vec.end(),
+                                                                                  scalar_start, scalar_end,
+                                                                                  chunks, use_multiexp);
+    return result.to_edwards_G1();
+}
+#endif
+
+} // libsnark
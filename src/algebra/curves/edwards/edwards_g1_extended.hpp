@@ -0,0 +1,129 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of interfaces for the group G1 of the edwards curve, in extended
+ coordinates.
+
+ As q = 1 (mod 4), the curve x^2 + y^2 = 1 + d x^2 y^2 is isomorphic, via
+ (x, y) -> (u, y) = (sqrt(-1)*x, y), to the twisted Edwards curve
+ -u^2 + y^2 = 1 - d u^2 y^2, whose a = -1 admits the fastest formulas of
+ [HWCD08]. A point is stored as (X : Y : T : Z) on that curve, with u = X/Z,
+ y = Y/Z and T = X*Y/Z. Unlike the inverted coordinates of edwards_G1, the
+ addition law is unified and (as -1 is a square and -d is not) complete: it
+ also doubles, and the neutral element (0 : 1 : 0 : 1) needs no special case.
+ An addition costs 9M (versus 10M+1S), a mixed addition 8M (versus 9M+1S) and
+ a doubling 4M+4S (as before).
+
+ edwards_G1_extended can be used wherever a group type is expected (scalar
+ multiplication, multi-exponentiation, etc.), and converts to and from
+ edwards_G1 without inversions. Building with EDWARDS_EXTENDED_COORDINATES
+ makes multi_exp<edwards_G1, edwards_Fr> run in these coordinates.
+
+ References:
+
+ [HWCD08]:
+ "Twisted Edwards Curves Revisited",
+ Huseyin Hisil, Kenneth Koon-Ho Wong, Gary Carter, Ed Dawson,
+ ASIACRYPT 2008,
+ <https://eprint.iacr.org/2008/522>
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef EDWARDS_G1_EXTENDED_HPP_
+#define EDWARDS_G1_EXTENDED_HPP_
+#include <vector>
+#include "algebra/curves/edwards/edwards_init.hpp"
+#include "algebra/curves/edwards/edwards_g1.hpp"
+#include "algebra/curves/curve_utils.hpp"
+
+namespace libsnark {
+
+class edwards_G1_extended;
+std::ostream& operator<<(std::ostream &, const edwards_G1_extended&);
+std::istream& operator>>(std::istream &, edwards_G1_extended&);
+
+class edwards_G1_extended {
+public:
+#ifdef PROFILE_OP_COUNTS
+    static long long add_cnt;
+    static long long dbl_cnt;
+#endif
+    static std::vector<size_t> wnaf_window_table;
+    static std::vector<size_t> fixed_base_exp_window_table;
+    static edwards_G1_extended G1_zero;
+    static edwards_G1_extended G1_one;
+    static edwards_Fq sqrt_minus_one;
+    static edwards_Fq coeff_k; /* 2*(-d) */
+
+    edwards_Fq X, Y, T, Z;
+    edwards_G1_extended();
+    explicit edwards_G1_extended(const edwards_G1 &P);
+private:
+    constexpr edwards_G1_extended(const edwards_Fq& X, const edwards_Fq& Y, const edwards_Fq& T, const edwards_Fq& Z) : X(X), Y(Y), T(T), Z(Z) {};
+
+public:
+    typedef edwards_Fq base_field;
+    typedef edwards_Fr scalar_field;
+
+    edwards_G1 to_edwards_G1() const;
+
+    void print() const;
+    void print_coordinates() const;
+
+    void to_affine_coordinates();
+    void to_special();
+    bool is_special() const;
+
+    bool is_zero() const;
+
+    bool operator==(const edwards_G1_extended &other) const;
+    bool operator!=(const edwards_G1_extended &other) const;
+
+    edwards_G1_extended operator+(const edwards_G1_extended &other) const;
+    edwards_G1_extended operator-() const;
+    edwards_G1_extended operator-(const edwards_G1_extended &other) const;
+
+    edwards_G1_extended add(const edwards_G1_extended &other) const;
+    edwards_G1_extended mixed_add(const edwards_G1_extended &other) const;
+    edwards_G1_extended dbl() const;
+
+    bool is_well_formed() const;
+
+    static edwards_G1_extended zero();
+    static edwards_G1_extended one();
+    static edwards_G1_extended random_element();
+
+    static size_t size_in_bits() { return edwards_G1::size_in_bits(); }
+    static bigint<base_field::num_limbs> base_field_char() { return base_field::field_char(); }
+    static bigint<scalar_field::num_limbs> order() { return scalar_field::field_char(); }
+
+    friend std::ostream& operator<<(std::ostream &out, const edwards_G1_extended &g);
+    friend std::istream& operator>>(std::istream &in, edwards_G1_extended &g);
+};
+
+template<mp_size_t m>
+edwards_G1_extended operator*(const bigint<m> &lhs, const edwards_G1_extended &rhs)
+{
+    return scalar_mul<edwards_G1_extended, m>(rhs, lhs);
+}
+
+template<mp_size_t m, const bigint<m>& modulus_p>
+edwards_G1_extended operator*(const Fp_model<m,modulus_p> &lhs, const edwards_G1_extended &rhs)
+{
+    return scalar_mul<edwards_G1_extended, m>(rhs, lhs.as_bigint());
+}
+
+std::ostream& operator<<(std::ostream& out, const std::vector<edwards_G1_extended> &v);
+std::istream& operator>>(std::istream& in, std::vector<edwards_G1_extended> &v);
+
+template<typename T>
+void batch_to_special_all_non_zeros(std::vector<T> &vec);
+template<>
+void batch_to_special_all_non_zeros<edwards_G1_extended>(std::vector<edwards_G1_extended> &vec);
+
+} // libsnark
+#endif // EDWARDS_G1_EXTENDED_HPP_
@@ -14,11 +14,58 @@ long long edwards_G2::add_cnt = 0;
 long long edwards_G2::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> edwards_G2::wnaf_window_table;
-std::vector<size_t> edwards_G2::fixed_base_exp_window_table;
-
-edwards_G2 edwards_G2::G2_zero;
-edwards_G2 edwards_G2::G2_one;
+std::vector<size_t> edwards_G2::wnaf_window_table = { 6, 12, 42, 97 };
+std::vector<size_t> edwards_G2::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.74]
+    1,
+    // window 2 is unbeaten in [4.74, 10.67]
+    5,
+    // window 3 is unbeaten in [10.67, 25.53]
+    11,
+    // window 4 is unbeaten in [25.53, 60.67]
+    26,
+    // window 5 is unbeaten in [60.67, 145.77]
+    61,
+    // window 6 is unbeaten in [145.77, 356.76]
+    146,
+    // window 7 is unbeaten in [356.76, 823.08]
+    357,
+    // window 8 is unbeaten in [823.08, 1589.45]
+    823,
+    // window 9 is unbeaten in [1589.45, 4135.70]
+    1589,
+    // window 10 is unbeaten in [4135.70, 14297.74]
+    4136,
+    // window 11 is unbeaten in [14297.74, 16744.85]
+    14298,
+    // window 12 is unbeaten in [16744.85, 51768.98]
+    16745,
+    // window 13 is unbeaten in [51768.98, 99811.01]
+    51769,
+    // window 14 is unbeaten in [99811.01, 193306.72]
+    99811,
+    // window 15 is unbeaten in [193306.72, 907184.68]
+    193307,
+    // window 16 is never the best
+    0,
+    // window 17 is unbeaten in [907184.68, 1389682.59]
+    907185,
+    // window 18 is unbeaten in [1389682.59, 6752695.74]
+    1389683,
+    // window 19 is never the best
+    0,
+    // window 20 is unbeaten in [6752695.74, 193642894.51]
+    6752696,
+    // window 21 is unbeaten in [193642894.51, 226760202.29]
+    193642895,
+    // window 22 is unbeaten in [226760202.29, inf]
+    226760202
+};
+
+/* ((1, 0, 0), (0, 0, 0), (0, 0, 0)) */
+edwards_G2 edwards_G2::G2_zero = edwards_G2(edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
+/* ((364634864866983740775341816274081071386963546650700569, 3264380230116139014996291397901297105159834497864380415, 3504781284999684163274269077749440837914479176282903747), (4531683359223370252210990718516622098304721701253228128, 5339624155305731263217400504407647531329993548123477368, 3964037981777308726208525982198654699800283729988686552), (5691049030389968571706190994110282579483361724967715073, 4458020907058120138246484975190566548128106781138812173, 5769188596695420613401068680779927948041124405071526515)) */
+edwards_G2 edwards_G2::G2_one = edwards_G2(edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x73165b114f96d4cc), BIGINT_LIMB64(0xa8aa15bbb6d8cb06), BIGINT_LIMB64(0x0020d4c2e7225522)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xf3daa0d56e67725e), BIGINT_LIMB64(0x327ef573012e44ea), BIGINT_LIMB64(0x00403990d98d364d)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x4cb89793daabfb00), BIGINT_LIMB64(0x1ad2e744291ebe70), BIGINT_LIMB64(0x001046b3eb956cd1))), edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xc7f21bd471d82177), BIGINT_LIMB64(0x122302646f374269), BIGINT_LIMB64(0x001d35c759ea5a19)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xf787443d2204a376), BIGINT_LIMB64(0x241c118c26606397), BIGINT_LIMB64(0x0012d4779083b9e0)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x368f75edc6566fdc), BIGINT_LIMB64(0x7a8cf7c4458a8eb9), BIGINT_LIMB64(0x002ae4377676fadf))), edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xe2d965c868721941), BIGINT_LIMB64(0x5f62c1dbfdfad33f), BIGINT_LIMB64(0x0024197cd479e41e)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x720d8aa41ec669d9), BIGINT_LIMB64(0xc4167f65acd7cbbe), BIGINT_LIMB64(0x00236f1880afa081)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x838633b1f2831fa9), BIGINT_LIMB64(0xcbe592b3540adee8), BIGINT_LIMB64(0x0005d0ed18411edd))));
 
 edwards_G2::edwards_G2()
 {
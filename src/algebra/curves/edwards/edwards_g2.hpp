@@ -33,7 +33,7 @@ public:
     edwards_Fq3 X, Y, Z;
     edwards_G2();
 private:
-    edwards_G2(const edwards_Fq3& X, const edwards_Fq3& Y, const edwards_Fq3& Z) : X(X), Y(Y), Z(Z) {};
+    constexpr edwards_G2(const edwards_Fq3& X, const edwards_Fq3& Y, const edwards_Fq3& Z) : X(X), Y(Y), Z(Z) {};
 public:
     static edwards_Fq3 mul_by_a(const edwards_Fq3 &elt);
     static edwards_Fq3 mul_by_d(const edwards_Fq3 &elt);
@@ -11,260 +11,146 @@
 
 namespace libsnark {
 
-bigint<edwards_r_limbs> edwards_modulus_r;
-bigint<edwards_q_limbs> edwards_modulus_q;
-
-edwards_Fq edwards_coeff_a;
-edwards_Fq edwards_coeff_d;
-edwards_Fq3 edwards_twist;
-edwards_Fq3 edwards_twist_coeff_a;
-edwards_Fq3 edwards_twist_coeff_d;
-edwards_Fq edwards_twist_mul_by_a_c0;
-edwards_Fq edwards_twist_mul_by_a_c1;
-edwards_Fq edwards_twist_mul_by_a_c2;
-edwards_Fq edwards_twist_mul_by_d_c0;
-edwards_Fq edwards_twist_mul_by_d_c1;
-edwards_Fq edwards_twist_mul_by_d_c2;
-edwards_Fq edwards_twist_mul_by_q_Y;
-edwards_Fq edwards_twist_mul_by_q_Z;
-
-bigint<edwards_q_limbs> edwards_ate_loop_count;
-bigint<6*edwards_q_limbs> edwards_final_exponent;
-bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_abs_of_w0;
-bool edwards_final_exponent_last_chunk_is_w0_neg;
-bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_w1;
+/* parameters for scalar field Fr */
+
+/* 1552511030102430251236801561344621993261920897571225601 */
+bigint<edwards_r_limbs> edwards_modulus_r = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x1de5532780000001), BIGINT_LIMB64(0xc4e2e493b92e12cc), BIGINT_LIMB64(0x0010357f274a8e56));
+/* 621738487827897760168419760282818735947979812540885779 */
+template<> bigint<edwards_r_limbs> edwards_Fr::Rsquared = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x70518837ba19ab13), BIGINT_LIMB64(0x73fb10e45fef0d1d), BIGINT_LIMB64(0x00067dc2bc868e45));
+/* 899968968216802386013510389846941393831065658679774050 */
+template<> bigint<edwards_r_limbs> edwards_Fr::Rcubed = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xb598a5139b464b62), BIGINT_LIMB64(0x0cc48a73504e02d6), BIGINT_LIMB64(0x00096567c1a3452f));
+template<> mp_limb_t edwards_Fr::inv = (mp_limb_t) 0xdde553277fffffff;
+template<> size_t edwards_Fr::num_bits = 181;
+/* 776255515051215125618400780672310996630960448785612800 */
+template<> bigint<edwards_r_limbs> edwards_Fr::euler = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x0ef2a993c0000000), BIGINT_LIMB64(0x62717249dc970966), BIGINT_LIMB64(0x00081abf93a5472b));
+template<> size_t edwards_Fr::s = 31;
+/* 722944284836962004768104088187507350585386575 */
+template<> bigint<edwards_r_limbs> edwards_Fr::t = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0x725c25983bcaa64f), BIGINT_LIMB64(0x4e951cad89c5c927), BIGINT_LIMB64(0x0000000000206afe));
+/* 361472142418481002384052044093753675292693287 */
+template<> bigint<edwards_r_limbs> edwards_Fr::t_minus_1_over_2 = bigint<edwards_r_limbs>(bigint_limbs, BIGINT_LIMB64(0xb92e12cc1de55327), BIGINT_LIMB64(0x274a8e56c4e2e493), BIGINT_LIMB64(0x000000000010357f));
+/* 19 */
+template<> edwards_Fr edwards_Fr::multiplicative_generator = edwards_Fr(montgomery_limbs, BIGINT_LIMB64(0xeca336e9fffed3ec), BIGINT_LIMB64(0xba6907738a5f5504), BIGINT_LIMB64(0x000ad0058f5f327e));
+/* 695314865466598274460565335217615316274564719601897184 */
+template<> edwards_Fr edwards_Fr::root_of_unity = edwards_Fr(montgomery_limbs, BIGINT_LIMB64(0xd4d7bf66a1423c0d), BIGINT_LIMB64(0xf5bd4f8ce8b9902d), BIGINT_LIMB64(0x000cf97e0daacc2b));
+/* 11 */
+template<> edwards_Fr edwards_Fr::nqr = edwards_Fr(montgomery_limbs, BIGINT_LIMB64(0x304a90a57fff5245), BIGINT_LIMB64(0xd9cb33f398a454b2), BIGINT_LIMB64(0x0001fe90ea596390));
+/* 1326707053668679463752768729767248251415639579872144553 */
+template<> edwards_Fr edwards_Fr::nqr_to_t = edwards_Fr(montgomery_limbs, BIGINT_LIMB64(0x841a170c2a23dddc), BIGINT_LIMB64(0x1fc42f5b5bbba648), BIGINT_LIMB64(0x000500f924a6934f));
+
+/* parameters for base field Fq */
+
+/* 6210044120409721004947206240885978274523751269793792001 */
+bigint<edwards_q_limbs> edwards_modulus_q = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xb6eb690b80000001), BIGINT_LIMB64(0x138b924ed6342d41), BIGINT_LIMB64(0x0040d5fc9d2a395b));
+/* 5943559676554581037560514598978484097352477055348195432 */
+template<> bigint<edwards_q_limbs> edwards_Fq::Rsquared = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xf6d1824a80e54068), BIGINT_LIMB64(0xe0bf35ff926ac105), BIGINT_LIMB64(0x003e0dbc8eec1f76));
+/* 1081560488703514202058739223469726982199727506489234349 */
+template<> bigint<edwards_q_limbs> edwards_Fq::Rcubed = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x3fe112e6248253ad), BIGINT_LIMB64(0x9f20e4d04d704882), BIGINT_LIMB64(0x000b4ac1b77ca0d5));
+template<> mp_limb_t edwards_Fq::inv = (mp_limb_t) 0x76eb690b7fffffff;
+template<> size_t edwards_Fq::num_bits = 183;
+/* 3105022060204860502473603120442989137261875634896896000 */
+template<> bigint<edwards_q_limbs> edwards_Fq::euler = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xdb75b485c0000000), BIGINT_LIMB64(0x89c5c9276b1a16a0), BIGINT_LIMB64(0x00206afe4e951cad));
+template<> size_t edwards_Fq::s = 31;
+/* 2891777139347848019072416350658041552884388375 */
+template<> bigint<edwards_q_limbs> edwards_Fq::t = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xac685a836dd6d217), BIGINT_LIMB64(0x3a5472b62717249d), BIGINT_LIMB64(0x000000000081abf9));
+/* 1445888569673924009536208175329020776442194187 */
+template<> bigint<edwards_q_limbs> edwards_Fq::t_minus_1_over_2 = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xd6342d41b6eb690b), BIGINT_LIMB64(0x9d2a395b138b924e), BIGINT_LIMB64(0x000000000040d5fc));
+/* 61 */
+template<> edwards_Fq edwards_Fq::multiplicative_generator = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x890dc434ffff0f26), BIGINT_LIMB64(0x81fb800cad23da8d), BIGINT_LIMB64(0x002cf38a9445c61e));
+/* 4692813029219384139894873043933463717810008194158530536 */
+template<> edwards_Fq edwards_Fq::root_of_unity = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x5f446c116453b1f7), BIGINT_LIMB64(0x71947afda8e32b4b), BIGINT_LIMB64(0x00137b4e4ce7803d));
+/* 23 */
+template<> edwards_Fq edwards_Fq::nqr = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x9dcc9ba7ffffa530), BIGINT_LIMB64(0x0d2968a39db2204c), BIGINT_LIMB64(0x0017537f75876121));
+/* 2626736066325740702418554487368721595489070118548299138 */
+template<> edwards_Fq edwards_Fq::nqr_to_t = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x2bec3c10b2792b3e), BIGINT_LIMB64(0x3a7ceecfa336b0aa), BIGINT_LIMB64(0x0000c9570dce5a9b));
+
+/* parameters for twist field Fq3 */
+
+/* 119744082713971502962992613191067836698205043373978948903839934564152994858051284658545502971203325031831647424413111161318314144765646525057914792711854057586688000 */
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::euler = bigint<3*edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xf2611d9140000000), BIGINT_LIMB64(0x4ea78ad2c1a16b28), BIGINT_LIMB64(0xec78824575425052), BIGINT_LIMB64(0x65027daa0127ecf4), BIGINT_LIMB64(0x23243b915ef074f5), BIGINT_LIMB64(0xf877968efca129ef), BIGINT_LIMB64(0xdc6307e4ed27faf4), BIGINT_LIMB64(0x421990256a87901d), BIGINT_LIMB64(0x0000000214530cde));
+template<> size_t edwards_Fq3::s = 31;
+/* 111520367408144756185815309352304634357062208814526860512643991563611659089151103662834971185031649686239331424621037357783237607000066456438894190557165125 */
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::t = bigint<3*edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x0685aca3c9847645), BIGINT_LIMB64(0xd50941493a9e2b4b), BIGINT_LIMB64(0x049fb3d3b1e20915), BIGINT_LIMB64(0x7bc1d3d59409f6a8), BIGINT_LIMB64(0xf284a7bc8c90ee45), BIGINT_LIMB64(0xb49febd3e1de5a3b), BIGINT_LIMB64(0xaa1e4077718c1f93), BIGINT_LIMB64(0x514c337908664095), BIGINT_LIMB64(0x0000000000000008));
+/* 55760183704072378092907654676152317178531104407263430256321995781805829544575551831417485592515824843119665712310518678891618803500033228219447095278582562 */
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::t_minus_1_over_2 = bigint<3*edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x8342d651e4c23b22), BIGINT_LIMB64(0xea84a0a49d4f15a5), BIGINT_LIMB64(0x024fd9e9d8f1048a), BIGINT_LIMB64(0xbde0e9eaca04fb54), BIGINT_LIMB64(0xf94253de46487722), BIGINT_LIMB64(0xda4ff5e9f0ef2d1d), BIGINT_LIMB64(0xd50f203bb8c60fc9), BIGINT_LIMB64(0x28a619bc8433204a), BIGINT_LIMB64(0x0000000000000004));
+/* 61 */
+template<> edwards_Fq edwards_Fq3::non_residue = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x890dc434ffff0f26), BIGINT_LIMB64(0x81fb800cad23da8d), BIGINT_LIMB64(0x002cf38a9445c61e));
+/* (23, 0, 0) */
+template<> edwards_Fq3 edwards_Fq3::nqr = edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x9dcc9ba7ffffa530), BIGINT_LIMB64(0x0d2968a39db2204c), BIGINT_LIMB64(0x0017537f75876121)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (104810943629412208121981114244673004633270996333237516, 0, 0) */
+template<> edwards_Fq3 edwards_Fq3::nqr_to_t = edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xfc5aaaa5b38e7fde), BIGINT_LIMB64(0x719ec71d1f0589bd), BIGINT_LIMB64(0x002d330f0b40aca3)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+template<> edwards_Fq edwards_Fq3::Frobenius_coeffs_c1[3] = {
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), /* 1 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x1a64cb845deb00e4), BIGINT_LIMB64(0x7b67026cbe7cb69d), BIGINT_LIMB64(0x00103664df88480d)), /* 1073752683758513276629212192812154536507607213288832061 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x003675f1a2150310), BIGINT_LIMB64(0xc8575d3a07c6312a), BIGINT_LIMB64(0x003db4386b6273fb)) /* 5136291436651207728317994048073823738016144056504959939 */
+};
+template<> edwards_Fq edwards_Fq3::Frobenius_coeffs_c2[3] = {
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), /* 1 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x003675f1a2150310), BIGINT_LIMB64(0xc8575d3a07c6312a), BIGINT_LIMB64(0x003db4386b6273fb)), /* 5136291436651207728317994048073823738016144056504959939 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x1a64cb845deb00e4), BIGINT_LIMB64(0x7b67026cbe7cb69d), BIGINT_LIMB64(0x00103664df88480d)) /* 1073752683758513276629212192812154536507607213288832061 */
+};
+
+/* parameters for Fq6 */
+
+/* 61 */
+template<> edwards_Fq edwards_Fq6::non_residue = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x890dc434ffff0f26), BIGINT_LIMB64(0x81fb800cad23da8d), BIGINT_LIMB64(0x002cf38a9445c61e));
+template<> edwards_Fq edwards_Fq6::Frobenius_coeffs_c1[6] = {
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), /* 1 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb6b4f319ddeafcf1), BIGINT_LIMB64(0x4b343514ce6dfc17), BIGINT_LIMB64(0x000321c431c7c55f)), /* 1073752683758513276629212192812154536507607213288832062 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x1a64cb845deb00e4), BIGINT_LIMB64(0x7b67026cbe7cb69d), BIGINT_LIMB64(0x00103664df88480d)), /* 1073752683758513276629212192812154536507607213288832061 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x63afd86a800003f3), BIGINT_LIMB64(0x3032cd57f00eba85), BIGINT_LIMB64(0x000d14a0adc082ae)), /* 6210044120409721004947206240885978274523751269793792000 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x003675f1a2150310), BIGINT_LIMB64(0xc8575d3a07c6312a), BIGINT_LIMB64(0x003db4386b6273fb)), /* 5136291436651207728317994048073823738016144056504959939 */
+    edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x9c869d872214ff1d), BIGINT_LIMB64(0x98248fe217b776a4), BIGINT_LIMB64(0x00309f97bda1f14d)) /* 5136291436651207728317994048073823738016144056504959940 */
+};
+/* edwards_Fq3::non_residue */
+template<> edwards_Fq Fp2_model<edwards_q_limbs, edwards_modulus_q>::non_residue = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x890dc434ffff0f26), BIGINT_LIMB64(0x81fb800cad23da8d), BIGINT_LIMB64(0x002cf38a9445c61e));
+
+/* choice of Edwards curve and its twist */
+
+/* 1 */
+edwards_Fq edwards_coeff_a = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac));
+/* 600581931845324488256649384912508268813600056237543024 */
+edwards_Fq edwards_coeff_d = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x80c78eb4af839dbb), BIGINT_LIMB64(0x6a7c2e3ac25d94aa), BIGINT_LIMB64(0x002007dad98cc707));
+/* (0, 1, 0) */
+edwards_Fq3 edwards_twist = edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* edwards_coeff_a * edwards_twist */
+edwards_Fq3 edwards_twist_coeff_a = edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* edwards_coeff_d * edwards_twist */
+edwards_Fq3 edwards_twist_coeff_d = edwards_Fq3(edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x80c78eb4af839dbb), BIGINT_LIMB64(0x6a7c2e3ac25d94aa), BIGINT_LIMB64(0x002007dad98cc707)), edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* edwards_coeff_a * edwards_Fq3::non_residue */
+edwards_Fq edwards_twist_mul_by_a_c0 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x890dc434ffff0f26), BIGINT_LIMB64(0x81fb800cad23da8d), BIGINT_LIMB64(0x002cf38a9445c61e));
+/* edwards_coeff_a */
+edwards_Fq edwards_twist_mul_by_a_c1 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac));
+/* edwards_coeff_a */
+edwards_Fq edwards_twist_mul_by_a_c2 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x533b90a0fffffc0e), BIGINT_LIMB64(0xe358c4f6e62572bc), BIGINT_LIMB64(0x0033c15bef69b6ac));
+/* edwards_coeff_d * edwards_Fq3::non_residue */
+edwards_Fq edwards_twist_mul_by_d_c0 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x3ff6b1b4d25c9571), BIGINT_LIMB64(0x153bdec3362f1eed), BIGINT_LIMB64(0x0008cb8b6b98b418));
+/* edwards_coeff_d */
+edwards_Fq edwards_twist_mul_by_d_c1 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x80c78eb4af839dbb), BIGINT_LIMB64(0x6a7c2e3ac25d94aa), BIGINT_LIMB64(0x002007dad98cc707));
+/* edwards_coeff_d */
+edwards_Fq edwards_twist_mul_by_d_c2 = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0x80c78eb4af839dbb), BIGINT_LIMB64(0x6a7c2e3ac25d94aa), BIGINT_LIMB64(0x002007dad98cc707));
+/* 1073752683758513276629212192812154536507607213288832062 */
+edwards_Fq edwards_twist_mul_by_q_Y = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb6b4f319ddeafcf1), BIGINT_LIMB64(0x4b343514ce6dfc17), BIGINT_LIMB64(0x000321c431c7c55f));
+/* 1073752683758513276629212192812154536507607213288832062 */
+edwards_Fq edwards_twist_mul_by_q_Z = edwards_Fq(montgomery_limbs, BIGINT_LIMB64(0xb6b4f319ddeafcf1), BIGINT_LIMB64(0x4b343514ce6dfc17), BIGINT_LIMB64(0x000321c431c7c55f));
+
+/* pairing parameters */
+
+/* 4492509698523932320491110403 */
+bigint<edwards_q_limbs> edwards_ate_loop_count = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xc0a9e39280000003), BIGINT_LIMB64(0x000000000e841dee));
+/* 36943107177961694649618797346446870138748651578611748415128207429491593976636391130175425245705674550269561361208979548749447898941828686017765730419416875539615941651269793928962468899856083169227457503942470721108165443528513330156264699608120624990672333642644221591552000 */
+bigint<6*edwards_q_limbs> edwards_final_exponent = bigint<6*edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x8984764500000000), BIGINT_LIMB64(0xbdc5d67a6176f9a4), BIGINT_LIMB64(0xb4a174e7cd7ca937), BIGINT_LIMB64(0x507e78d8246a4843), BIGINT_LIMB64(0x8db1e4797e330e5d), BIGINT_LIMB64(0xee1aafa109870714), BIGINT_LIMB64(0xcd4e64d7156c2f84), BIGINT_LIMB64(0xda7ecbbcb64cdc0a), BIGINT_LIMB64(0xfde9ee9d0176dbe7), BIGINT_LIMB64(0x30d02292f9f5e784), BIGINT_LIMB64(0x9d33b1aa7ceba860), BIGINT_LIMB64(0x348f971a3ef1053c), BIGINT_LIMB64(0x08dc0e8027077fc9), BIGINT_LIMB64(0xff78ce1ba3ed7bdc), BIGINT_LIMB64(0x0000000000011128));
+/* 17970038794095729281964441603 */
+bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_abs_of_w0 = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x02a78e4a00000003), BIGINT_LIMB64(0x000000003a1077bb));
+bool edwards_final_exponent_last_chunk_is_w0_neg = true;
+/* 4 */
+bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_w1 = bigint<edwards_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x0000000000000004));
 
 void init_edwards_params()
 {
-    typedef bigint<edwards_r_limbs> bigint_r;
-    typedef bigint<edwards_q_limbs> bigint_q;
-
-    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4); // Montgomery assumes this
-
-    /* parameters for scalar field Fr */
-
-    edwards_modulus_r = bigint_r("1552511030102430251236801561344621993261920897571225601");
+    /* all parameters are constant-initialized above; just check that Montgomery arithmetic applies */
+    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4);
     assert(edwards_Fr::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        edwards_Fr::Rsquared = bigint_r("621738487827897760168419760282818735947979812540885779");
-        edwards_Fr::Rcubed = bigint_r("899968968216802386013510389846941393831065658679774050");
-        edwards_Fr::inv = 0xdde553277fffffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        edwards_Fr::Rsquared = bigint_r("621738487827897760168419760282818735947979812540885779");
-        edwards_Fr::Rcubed = bigint_r("899968968216802386013510389846941393831065658679774050");
-        edwards_Fr::inv = 0x7fffffff;
-    }
-    edwards_Fr::num_bits = 181;
-    edwards_Fr::euler = bigint_r("776255515051215125618400780672310996630960448785612800");
-    edwards_Fr::s = 31;
-    edwards_Fr::t = bigint_r("722944284836962004768104088187507350585386575");
-    edwards_Fr::t_minus_1_over_2 = bigint_r("361472142418481002384052044093753675292693287");
-    edwards_Fr::multiplicative_generator = edwards_Fr("19");
-    edwards_Fr::root_of_unity = edwards_Fr("695314865466598274460565335217615316274564719601897184");
-    edwards_Fr::nqr = edwards_Fr("11");
-    edwards_Fr::nqr_to_t = edwards_Fr("1326707053668679463752768729767248251415639579872144553");
-
-    /* parameters for base field Fq */
-
-    edwards_modulus_q = bigint_q("6210044120409721004947206240885978274523751269793792001");
     assert(edwards_Fq::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        edwards_Fq::Rsquared = bigint_q("5943559676554581037560514598978484097352477055348195432");
-        edwards_Fq::Rcubed = bigint_q("1081560488703514202058739223469726982199727506489234349");
-        edwards_Fq::inv = 0x76eb690b7fffffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        edwards_Fq::Rsquared = bigint_q("5943559676554581037560514598978484097352477055348195432");
-        edwards_Fq::Rcubed = bigint_q("1081560488703514202058739223469726982199727506489234349");
-        edwards_Fq::inv = 0x7fffffff;
-    }
-    edwards_Fq::num_bits = 183;
-    edwards_Fq::euler = bigint_q("3105022060204860502473603120442989137261875634896896000");
-    edwards_Fq::s = 31;
-    edwards_Fq::t = bigint_q("2891777139347848019072416350658041552884388375");
-    edwards_Fq::t_minus_1_over_2 = bigint_q("1445888569673924009536208175329020776442194187");
-    edwards_Fq::multiplicative_generator = edwards_Fq("61");
-    edwards_Fq::root_of_unity = edwards_Fq("4692813029219384139894873043933463717810008194158530536");
-    edwards_Fq::nqr = edwards_Fq("23");
-    edwards_Fq::nqr_to_t = edwards_Fq("2626736066325740702418554487368721595489070118548299138");
-
-    /* parameters for twist field Fq3 */
-
-    edwards_Fq3::euler = bigint<3*edwards_q_limbs>("119744082713971502962992613191067836698205043373978948903839934564152994858051284658545502971203325031831647424413111161318314144765646525057914792711854057586688000");
-    edwards_Fq3::s = 31;
-    edwards_Fq3::t = bigint<3*edwards_q_limbs>("111520367408144756185815309352304634357062208814526860512643991563611659089151103662834971185031649686239331424621037357783237607000066456438894190557165125");
-    edwards_Fq3::t_minus_1_over_2 = bigint<3*edwards_q_limbs>("55760183704072378092907654676152317178531104407263430256321995781805829544575551831417485592515824843119665712310518678891618803500033228219447095278582562");
-    edwards_Fq3::non_residue = edwards_Fq("61");
-    edwards_Fq3::nqr = edwards_Fq3(edwards_Fq("23"),edwards_Fq("0"),edwards_Fq("0"));
-    edwards_Fq3::nqr_to_t = edwards_Fq3(edwards_Fq("104810943629412208121981114244673004633270996333237516"),edwards_Fq("0"),edwards_Fq("0"));
-    edwards_Fq3::Frobenius_coeffs_c1[0] = edwards_Fq("1");
-    edwards_Fq3::Frobenius_coeffs_c1[1] = edwards_Fq("1073752683758513276629212192812154536507607213288832061");
-    edwards_Fq3::Frobenius_coeffs_c1[2] = edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq3::Frobenius_coeffs_c2[0] = edwards_Fq("1");
-    edwards_Fq3::Frobenius_coeffs_c2[1] = edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq3::Frobenius_coeffs_c2[2] = edwards_Fq("1073752683758513276629212192812154536507607213288832061");
-
-    /* parameters for Fq6 */
-
-    edwards_Fq6::non_residue = edwards_Fq("61");
-    edwards_Fq6::Frobenius_coeffs_c1[0] = edwards_Fq("1");
-    edwards_Fq6::Frobenius_coeffs_c1[1] = edwards_Fq("1073752683758513276629212192812154536507607213288832062");
-    edwards_Fq6::Frobenius_coeffs_c1[2] = edwards_Fq("1073752683758513276629212192812154536507607213288832061");
-    edwards_Fq6::Frobenius_coeffs_c1[3] = edwards_Fq("6210044120409721004947206240885978274523751269793792000");
-    edwards_Fq6::Frobenius_coeffs_c1[4] = edwards_Fq("5136291436651207728317994048073823738016144056504959939");
-    edwards_Fq6::Frobenius_coeffs_c1[5] = edwards_Fq("5136291436651207728317994048073823738016144056504959940");
-    edwards_Fq6::my_Fp2::non_residue = edwards_Fq3::non_residue;
-
-    /* choice of Edwards curve and its twist */
-
-    edwards_coeff_a = edwards_Fq::one();
-    edwards_coeff_d = edwards_Fq("600581931845324488256649384912508268813600056237543024");
-    edwards_twist = edwards_Fq3(edwards_Fq::zero(), edwards_Fq::one(), edwards_Fq::zero());
-    edwards_twist_coeff_a = edwards_coeff_a * edwards_twist;
-    edwards_twist_coeff_d = edwards_coeff_d * edwards_twist;
-    edwards_twist_mul_by_a_c0 = edwards_coeff_a * edwards_Fq3::non_residue;
-    edwards_twist_mul_by_a_c1 = edwards_coeff_a;
-    edwards_twist_mul_by_a_c2 = edwards_coeff_a;
-    edwards_twist_mul_by_d_c0 = edwards_coeff_d * edwards_Fq3::non_residue;
-    edwards_twist_mul_by_d_c1 = edwards_coeff_d;
-    edwards_twist_mul_by_d_c2 = edwards_coeff_d;
-    edwards_twist_mul_by_q_Y = edwards_Fq("1073752683758513276629212192812154536507607213288832062");
-    edwards_twist_mul_by_q_Z = edwards_Fq("1073752683758513276629212192812154536507607213288832062");
-
-    /* choice of group G1 */
-
-    edwards_G1::G1_zero = edwards_G1(edwards_Fq::zero(),
-                                     edwards_Fq::one());
-    edwards_G1::G1_one = edwards_G1(edwards_Fq("3713709671941291996998665608188072510389821008693530490"),
-                                    edwards_Fq("4869953702976555123067178261685365085639705297852816679"));
-
-    edwards_G1::wnaf_window_table.resize(0);
-    edwards_G1::wnaf_window_table.push_back(9);
-    edwards_G1::wnaf_window_table.push_back(14);
-    edwards_G1::wnaf_window_table.push_back(24);
-    edwards_G1::wnaf_window_table.push_back(117);
-
-    edwards_G1::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.10]
-    edwards_G1::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.10, 9.69]
-    edwards_G1::fixed_base_exp_window_table.push_back(4);
-    // window 3 is unbeaten in [9.69, 25.21]
-    edwards_G1::fixed_base_exp_window_table.push_back(10);
-    // window 4 is unbeaten in [25.21, 60.00]
-    edwards_G1::fixed_base_exp_window_table.push_back(25);
-    // window 5 is unbeaten in [60.00, 149.33]
-    edwards_G1::fixed_base_exp_window_table.push_back(60);
-    // window 6 is unbeaten in [149.33, 369.61]
-    edwards_G1::fixed_base_exp_window_table.push_back(149);
-    // window 7 is unbeaten in [369.61, 849.07]
-    edwards_G1::fixed_base_exp_window_table.push_back(370);
-    // window 8 is unbeaten in [849.07, 1764.94]
-    edwards_G1::fixed_base_exp_window_table.push_back(849);
-    // window 9 is unbeaten in [1764.94, 4429.59]
-    edwards_G1::fixed_base_exp_window_table.push_back(1765);
-    // window 10 is unbeaten in [4429.59, 13388.78]
-    edwards_G1::fixed_base_exp_window_table.push_back(4430);
-    // window 11 is unbeaten in [13388.78, 15368.00]
-    edwards_G1::fixed_base_exp_window_table.push_back(13389);
-    // window 12 is unbeaten in [15368.00, 74912.07]
-    edwards_G1::fixed_base_exp_window_table.push_back(15368);
-    // window 13 is unbeaten in [74912.07, 438107.20]
-    edwards_G1::fixed_base_exp_window_table.push_back(74912);
-    // window 14 is never the best
-    edwards_G1::fixed_base_exp_window_table.push_back(0);
-    // window 15 is unbeaten in [438107.20, 1045626.18]
-    edwards_G1::fixed_base_exp_window_table.push_back(438107);
-    // window 16 is never the best
-    edwards_G1::fixed_base_exp_window_table.push_back(0);
-    // window 17 is unbeaten in [1045626.18, 1577434.48]
-    edwards_G1::fixed_base_exp_window_table.push_back(1045626);
-    // window 18 is unbeaten in [1577434.48, 17350594.23]
-    edwards_G1::fixed_base_exp_window_table.push_back(1577434);
-    // window 19 is never the best
-    edwards_G1::fixed_base_exp_window_table.push_back(0);
-    // window 20 is never the best
-    edwards_G1::fixed_base_exp_window_table.push_back(0);
-    // window 21 is unbeaten in [17350594.23, inf]
-    edwards_G1::fixed_base_exp_window_table.push_back(17350594);
-    // window 22 is never the best
-    edwards_G1::fixed_base_exp_window_table.push_back(0);
-
-    /* choice of group G2 */
-
-    edwards_G2::G2_zero = edwards_G2(edwards_Fq3::zero(),
-                                     edwards_Fq3::one());
-    edwards_G2::G2_one = edwards_G2(edwards_Fq3(edwards_Fq("4531683359223370252210990718516622098304721701253228128"),
-                                                edwards_Fq("5339624155305731263217400504407647531329993548123477368"),
-                                                edwards_Fq("3964037981777308726208525982198654699800283729988686552")),
-                                    edwards_Fq3(edwards_Fq("364634864866983740775341816274081071386963546650700569"),
-                                                edwards_Fq("3264380230116139014996291397901297105159834497864380415"),
-                                                edwards_Fq("3504781284999684163274269077749440837914479176282903747")));
-
-    edwards_G2::wnaf_window_table.resize(0);
-    edwards_G2::wnaf_window_table.push_back(6);
-    edwards_G2::wnaf_window_table.push_back(12);
-    edwards_G2::wnaf_window_table.push_back(42);
-    edwards_G2::wnaf_window_table.push_back(97);
-
-    edwards_G2::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.74]
-    edwards_G2::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.74, 10.67]
-    edwards_G2::fixed_base_exp_window_table.push_back(5);
-    // window 3 is unbeaten in [10.67, 25.53]
-    edwards_G2::fixed_base_exp_window_table.push_back(11);
-    // window 4 is unbeaten in [25.53, 60.67]
-    edwards_G2::fixed_base_exp_window_table.push_back(26);
-    // window 5 is unbeaten in [60.67, 145.77]
-    edwards_G2::fixed_base_exp_window_table.push_back(61);
-    // window 6 is unbeaten in [145.77, 356.76]
-    edwards_G2::fixed_base_exp_window_table.push_back(146);
-    // window 7 is unbeaten in [356.76, 823.08]
-    edwards_G2::fixed_base_exp_window_table.push_back(357);
-    // window 8 is unbeaten in [823.08, 1589.45]
-    edwards_G2::fixed_base_exp_window_table.push_back(823);
-    // window 9 is unbeaten in [1589.45, 4135.70]
-    edwards_G2::fixed_base_exp_window_table.push_back(1589);
-    // window 10 is unbeaten in [4135.70, 14297.74]
-    edwards_G2::fixed_base_exp_window_table.push_back(4136);
-    // window 11 is unbeaten in [14297.74, 16744.85]
-    edwards_G2::fixed_base_exp_window_table.push_back(14298);
-    // window 12 is unbeaten in [16744.85, 51768.98]
-    edwards_G2::fixed_base_exp_window_table.push_back(16745);
-    // window 13 is unbeaten in [51768.98, 99811.01]
-    edwards_G2::fixed_base_exp_window_table.push_back(51769);
-    // window 14 is unbeaten in [99811.01, 193306.72]
-    edwards_G2::fixed_base_exp_window_table.push_back(99811);
-    // window 15 is unbeaten in [193306.72, 907184.68]
-    edwards_G2::fixed_base_exp_window_table.push_back(193307);
-    // window 16 is never the best
-    edwards_G2::fixed_base_exp_window_table.push_back(0);
-    // window 17 is unbeaten in [907184.68, 1389682.59]
-    edwards_G2::fixed_base_exp_window_table.push_back(907185);
-    // window 18 is unbeaten in [1389682.59, 6752695.74]
-    edwards_G2::fixed_base_exp_window_table.push_back(1389683);
-    // window 19 is never the best
-    edwards_G2::fixed_base_exp_window_table.push_back(0);
-    // window 20 is unbeaten in [6752695.74, 193642894.51]
-    edwards_G2::fixed_base_exp_window_table.push_back(6752696);
-    // window 21 is unbeaten in [193642894.51, 226760202.29]
-    edwards_G2::fixed_base_exp_window_table.push_back(193642895);
-    // window 22 is unbeaten in [226760202.29, inf]
-    edwards_G2::fixed_base_exp_window_table.push_back(226760202);
-
-    /* pairing parameters */
-
-    edwards_ate_loop_count = bigint_q("4492509698523932320491110403");
-    edwards_final_exponent = bigint<6*edwards_q_limbs>("36943107177961694649618797346446870138748651578611748415128207429491593976636391130175425245705674550269561361208979548749447898941828686017765730419416875539615941651269793928962468899856083169227457503942470721108165443528513330156264699608120624990672333642644221591552000");
-    edwards_final_exponent_last_chunk_abs_of_w0 = bigint_q("17970038794095729281964441603");
-    edwards_final_exponent_last_chunk_is_w0_neg = true;
-    edwards_final_exponent_last_chunk_w1 = bigint_q("4");
-
 }
+
 } // libsnark
@@ -52,6 +52,48 @@ extern bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_abs_of_w0;
 extern bool edwards_final_exponent_last_chunk_is_w0_neg;
 extern bigint<edwards_q_limbs> edwards_final_exponent_last_chunk_w1;
 
+/*
+ * The parameters of the fields above are constant-initialized in
+ * edwards_init.cpp (as are all other parameters of the curve), so they
+ * can be used without calling init_edwards_params() first.
+ */
+template<> bigint<edwards_r_limbs> edwards_Fr::Rsquared;
+template<> bigint<edwards_r_limbs> edwards_Fr::Rcubed;
+template<> mp_limb_t edwards_Fr::inv;
+template<> size_t edwards_Fr::num_bits;
+template<> bigint<edwards_r_limbs> edwards_Fr::euler;
+template<> size_t edwards_Fr::s;
+template<> bigint<edwards_r_limbs> edwards_Fr::t;
+template<> bigint<edwards_r_limbs> edwards_Fr::t_minus_1_over_2;
+template<> edwards_Fr edwards_Fr::multiplicative_generator;
+template<> edwards_Fr edwards_Fr::root_of_unity;
+template<> edwards_Fr edwards_Fr::nqr;
+template<> edwards_Fr edwards_Fr::nqr_to_t;
+template<> bigint<edwards_q_limbs> edwards_Fq::Rsquared;
+template<> bigint<edwards_q_limbs> edwards_Fq::Rcubed;
+template<> mp_limb_t edwards_Fq::inv;
+template<> size_t edwards_Fq::num_bits;
+template<> bigint<edwards_q_limbs> edwards_Fq::euler;
+template<> size_t edwards_Fq::s;
+template<> bigint<edwards_q_limbs> edwards_Fq::t;
+template<> bigint<edwards_q_limbs> edwards_Fq::t_minus_1_over_2;
+template<> edwards_Fq edwards_Fq::multiplicative_generator;
+template<> edwards_Fq edwards_Fq::root_of_unity;
+template<> edwards_Fq edwards_Fq::nqr;
+template<> edwards_Fq edwards_Fq::nqr_to_t;
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::euler;
+template<> size_t edwards_Fq3::s;
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::t;
+template<> bigint<3*edwards_q_limbs> edwards_Fq3::t_minus_1_over_2;
+template<> edwards_Fq edwards_Fq3::non_residue;
+template<> edwards_Fq3 edwards_Fq3::nqr;
+template<> edwards_Fq3 edwards_Fq3::nqr_to_t;
+template<> edwards_Fq edwards_Fq3::Frobenius_coeffs_c1[3];
+template<> edwards_Fq edwards_Fq3::Frobenius_coeffs_c2[3];
+template<> edwards_Fq edwards_Fq6::non_residue;
+template<> edwards_Fq edwards_Fq6::Frobenius_coeffs_c1[6];
+template<> edwards_Fq Fp2_model<edwards_q_limbs, edwards_modulus_q>::non_residue;
+
 void init_edwards_params();
 
 class edwards_G1;
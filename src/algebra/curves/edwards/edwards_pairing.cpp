@@ -624,10 +624,10 @@ edwards_ate_G2_precomp edwards_ate_precompute_G2(const edwards_G2& Q)
     return result;
 }
 
-edwards_Fq6 edwards_ate_miller_loop(const edwards_ate_G1_precomp &prec_P,
-                                    const edwards_ate_G2_precomp &prec_Q)
+/* the Miller loop without profiling, so that several can run in parallel */
+static edwards_Fq6 edwards_ate_miller_loop_unprofiled(const edwards_ate_G1_precomp &prec_P,
+                                                      const edwards_ate_G2_precomp &prec_Q)
 {
-    enter_block("Call to edwards_ate_miller_loop");
     const bigint<edwards_Fr::num_limbs> &loop_count = edwards_ate_loop_count;
 
     edwards_Fq6 f = edwards_Fq6::one();
@@ -660,6 +660,14 @@ edwards_Fq6 edwards_ate_miller_loop(const edwards_ate_G1_precomp &prec_P,
             f = f * g_RQ_at_P;
         }
     }
+    return f;
+}
+
+edwards_Fq6 edwards_ate_miller_loop(const edwards_ate_G1_precomp &prec_P,
+                                    const edwards_ate_G2_precomp &prec_Q)
+{
+    enter_block("Call to edwards_ate_miller_loop");
+    const edwards_Fq6 f = edwards_ate_miller_loop_unprofiled(prec_P, prec_Q);
     leave_block("Call to edwards_ate_miller_loop");
 
     return f;
@@ -718,6 +726,26 @@ edwards_Fq6 edwards_ate_double_miller_loop(const edwards_ate_G1_precomp &prec_P1
     return f;
 }
 
+std::vector<edwards_Fq6> edwards_ate_batch_miller_loop(const std::vector<edwards_ate_G1_precomp> &prec_P,
+                                                       const std::vector<edwards_ate_G2_precomp> &prec_Q)
+{
+    enter_block("Call to edwards_ate_batch_miller_loop");
+    assert(prec_P.size() == prec_Q.size());
+
+    std::vector<edwards_Fq6> f(prec_P.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < f.size(); ++j)
+    {
+        f[j] = edwards_ate_miller_loop_unprofiled(prec_P[j], prec_Q[j]);
+    }
+
+    leave_block("Call to edwards_ate_batch_miller_loop");
+
+    return f;
+}
+
 edwards_Fq6 edwards_ate_pairing(const edwards_G1& P, const edwards_G2 &Q)
 {
     enter_block("Call to edwards_ate_pairing");
@@ -761,6 +789,12 @@ edwards_Fq6 edwards_double_miller_loop(const edwards_G1_precomp &prec_P1,
     return edwards_ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<edwards_Fq6> edwards_batch_miller_loop(const std::vector<edwards_G1_precomp> &prec_P,
+                                                   const std::vector<edwards_G2_precomp> &prec_Q)
+{
+    return edwards_ate_batch_miller_loop(prec_P, prec_Q);
+}
+
 edwards_Fq6 edwards_pairing(const edwards_G1& P,
                             const edwards_G2 &Q)
 {
@@ -91,6 +91,10 @@ edwards_Fq6 edwards_ate_double_miller_loop(const edwards_ate_G1_precomp &prec_P1
                                            const edwards_ate_G1_precomp &prec_P2,
                                            const edwards_ate_G2_precomp &prec_Q2);
 
+/* Miller loops of the independent pairs (prec_P[i], prec_Q[i]) */
+std::vector<edwards_Fq6> edwards_ate_batch_miller_loop(const std::vector<edwards_ate_G1_precomp> &prec_P,
+                                                       const std::vector<edwards_ate_G2_precomp> &prec_Q);
+
 edwards_Fq6 edwards_ate_pairing(const edwards_G1& P,
                                 const edwards_G2 &Q);
 edwards_GT edwards_ate_reduced_pairing(const edwards_G1 &P,
@@ -112,6 +116,9 @@ edwards_Fq6 edwards_double_miller_loop(const edwards_G1_precomp &prec_P1,
                                        const edwards_G1_precomp &prec_P2,
                                        const edwards_G2_precomp &prec_Q2);
 
+std::vector<edwards_Fq6> edwards_batch_miller_loop(const std::vector<edwards_G1_precomp> &prec_P,
+                                                   const std::vector<edwards_G2_precomp> &prec_Q);
+
 edwards_Fq6 edwards_pairing(const edwards_G1& P,
                             const edwards_G2 &Q);
 
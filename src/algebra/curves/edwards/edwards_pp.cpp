@@ -29,6 +29,11 @@ edwards_G2_precomp edwards_pp::precompute_G2(const edwards_G2 &Q)
     return edwards_precompute_G2(Q);
 }
 
+edwards_G2_precomp edwards_pp::precompute_G2_for_reuse(const edwards_G2 &Q)
+{
+    return edwards_pp::precompute_G2(Q);
+}
+
 edwards_Fq6 edwards_pp::miller_loop(const edwards_G1_precomp &prec_P,
                                     const edwards_G2_precomp &prec_Q)
 {
@@ -43,6 +48,12 @@ edwards_Fq6 edwards_pp::double_miller_loop(const edwards_G1_precomp &prec_P1,
     return edwards_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<edwards_Fq6> edwards_pp::batch_miller_loop(const std::vector<edwards_G1_precomp> &prec_P,
+                                                       const std::vector<edwards_G2_precomp> &prec_Q)
+{
+    return edwards_batch_miller_loop(prec_P, prec_Q);
+}
+
 edwards_Fq6 edwards_pp::pairing(const edwards_G1 &P,
                                 const edwards_G2 &Q)
 {
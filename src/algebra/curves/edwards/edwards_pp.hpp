@@ -10,6 +10,7 @@
 #include "algebra/curves/public_params.hpp"
 #include "algebra/curves/edwards/edwards_init.hpp"
 #include "algebra/curves/edwards/edwards_g1.hpp"
+#include "algebra/curves/edwards/edwards_g1_extended.hpp"
 #include "algebra/curves/edwards/edwards_g2.hpp"
 #include "algebra/curves/edwards/edwards_pairing.hpp"
 
@@ -33,12 +34,15 @@ public:
     static edwards_GT final_exponentiation(const edwards_Fq6 &elt);
     static edwards_G1_precomp precompute_G1(const edwards_G1 &P);
     static edwards_G2_precomp precompute_G2(const edwards_G2 &Q);
+    static edwards_G2_precomp precompute_G2_for_reuse(const edwards_G2 &Q);
     static edwards_Fq6 miller_loop(const edwards_G1_precomp &prec_P,
                                    const edwards_G2_precomp &prec_Q);
     static edwards_Fq6 double_miller_loop(const edwards_G1_precomp &prec_P1,
                                           const edwards_G2_precomp &prec_Q1,
                                           const edwards_G1_precomp &prec_P2,
                                           const edwards_G2_precomp &prec_Q2);
+    static std::vector<edwards_Fq6> batch_miller_loop(const std::vector<edwards_G1_precomp> &prec_P,
+                                                      const std::vector<edwards_G2_precomp> &prec_Q);
     /* the following are used in test files */
     static edwards_Fq6 pairing(const edwards_G1 &P,
                                const edwards_G2 &Q);
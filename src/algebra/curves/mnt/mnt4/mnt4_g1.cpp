@@ -20,12 +20,61 @@ long long mnt4_G1::add_cnt = 0;
 long long mnt4_G1::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> mnt4_G1::wnaf_window_table;
-std::vector<size_t> mnt4_G1::fixed_base_exp_window_table;
-mnt4_G1 mnt4_G1::G1_zero;
-mnt4_G1 mnt4_G1::G1_one;
-mnt4_Fq mnt4_G1::coeff_a;
-mnt4_Fq mnt4_G1::coeff_b;
+std::vector<size_t> mnt4_G1::wnaf_window_table = { 11, 24, 60, 127 };
+std::vector<size_t> mnt4_G1::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 5.09]
+    1,
+    // window 2 is unbeaten in [5.09, 9.64]
+    5,
+    // window 3 is unbeaten in [9.64, 24.79]
+    10,
+    // window 4 is unbeaten in [24.79, 60.29]
+    25,
+    // window 5 is unbeaten in [60.29, 144.37]
+    60,
+    // window 6 is unbeaten in [144.37, 344.90]
+    144,
+    // window 7 is unbeaten in [344.90, 855.00]
+    345,
+    // window 8 is unbeaten in [855.00, 1804.62]
+    855,
+    // window 9 is unbeaten in [1804.62, 3912.30]
+    1805,
+    // window 10 is unbeaten in [3912.30, 11264.50]
+    3912,
+    // window 11 is unbeaten in [11264.50, 27897.51]
+    11265,
+    // window 12 is unbeaten in [27897.51, 57596.79]
+    27898,
+    // window 13 is unbeaten in [57596.79, 145298.71]
+    57597,
+    // window 14 is unbeaten in [145298.71, 157204.59]
+    145299,
+    // window 15 is unbeaten in [157204.59, 601600.62]
+    157205,
+    // window 16 is unbeaten in [601600.62, 1107377.25]
+    601601,
+    // window 17 is unbeaten in [1107377.25, 1789646.95]
+    1107377,
+    // window 18 is unbeaten in [1789646.95, 4392626.92]
+    1789647,
+    // window 19 is unbeaten in [4392626.92, 8221210.60]
+    4392627,
+    // window 20 is unbeaten in [8221210.60, 42363731.19]
+    8221211,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [42363731.19, inf]
+    42363731
+};
+/* (0, 1, 0) */
+mnt4_G1 mnt4_G1::G1_zero = mnt4_G1(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x18c31a7b5863845c), BIGINT_LIMB64(0xe9de7a15e3b68df5), BIGINT_LIMB64(0xc5df858728faab40), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (60760244141852568949126569781626075788424196370144486719385562369396875346601926534016838, 363732850702582978263902770815145784459747722357071843971107674179038674942891694705904306, 1) */
+mnt4_G1 mnt4_G1::G1_one = mnt4_G1(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x53e8c71197d9f8b4), BIGINT_LIMB64(0xd1a0ccc72d575667), BIGINT_LIMB64(0xdaaf7bad5bfe5f43), BIGINT_LIMB64(0x54d91c797e47fb02), BIGINT_LIMB64(0x000002c92de78361)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x7a1a14f4dec3207d), BIGINT_LIMB64(0x87975c3ee01d86d3), BIGINT_LIMB64(0xf599a22085a378e8), BIGINT_LIMB64(0xd3ac75497936f0f8), BIGINT_LIMB64(0x0000037f5ae096e4)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x18c31a7b5863845c), BIGINT_LIMB64(0xe9de7a15e3b68df5), BIGINT_LIMB64(0xc5df858728faab40), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)));
+/* 2 */
+mnt4_Fq mnt4_G1::coeff_a = mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x318634f6b0c708b8), BIGINT_LIMB64(0xd3bcf42bc76d1bea), BIGINT_LIMB64(0x8bbf0b0e51f55681), BIGINT_LIMB64(0x52308130c8f6a32f), BIGINT_LIMB64(0x00000382447a6786));
+/* 423894536526684178289416011533888240029318103673896002803341544124054745019340795360841685 */
+mnt4_Fq mnt4_G1::coeff_b = mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x6cd74067bbddcb31), BIGINT_LIMB64(0x03ffe4a5e33d7477), BIGINT_LIMB64(0x39c29c6219621ca5), BIGINT_LIMB64(0x4c2b62b6cfc1895f), BIGINT_LIMB64(0x00000169b131a14d));
 
 mnt4_G1::mnt4_G1()
 {
@@ -482,6 +531,13 @@ std::istream& operator>>(std::istream& in, std::vector<mnt4_G1> &v)
     return in;
 }
 
+template<>
+bool is_in_subgroup<mnt4_G1>(const mnt4_G1 &P)
+{
+    /* the curve has prime order, so all of its points lie in G1 */
+    return true;
+}
+
 template<>
 void batch_to_special_all_non_zeros<mnt4_G1>(std::vector<mnt4_G1> &vec)
 {
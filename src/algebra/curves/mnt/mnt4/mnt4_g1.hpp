@@ -44,7 +44,7 @@ public:
     // using projective coordinates
     mnt4_G1();
     mnt4_G1(const mnt4_Fq& X, const mnt4_Fq& Y) : X_(X), Y_(Y), Z_(base_field::one()) {}
-    mnt4_G1(const mnt4_Fq& X, const mnt4_Fq& Y, const mnt4_Fq& Z) : X_(X), Y_(Y), Z_(Z) {}
+    constexpr mnt4_G1(const mnt4_Fq& X, const mnt4_Fq& Y, const mnt4_Fq& Z) : X_(X), Y_(Y), Z_(Z) {}
 
     mnt4_Fq X() const { return X_; }
     mnt4_Fq Y() const { return Y_; }
@@ -104,6 +104,9 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<mnt4_G1>(std::vector<mnt4_G1> &vec);
 
+template<>
+bool is_in_subgroup<mnt4_G1>(const mnt4_G1 &P);
+
 } // libsnark
 
 #endif // MNT4_G1_HPP_
@@ -20,13 +20,63 @@ long long mnt4_G2::add_cnt = 0;
 long long mnt4_G2::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> mnt4_G2::wnaf_window_table;
-std::vector<size_t> mnt4_G2::fixed_base_exp_window_table;
-mnt4_Fq2 mnt4_G2::twist;
-mnt4_Fq2 mnt4_G2::coeff_a;
-mnt4_Fq2 mnt4_G2::coeff_b;
-mnt4_G2 mnt4_G2::G2_zero;
-mnt4_G2 mnt4_G2::G2_one;
+std::vector<size_t> mnt4_G2::wnaf_window_table = { 5, 15, 39, 109 };
+std::vector<size_t> mnt4_G2::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.17]
+    1,
+    // window 2 is unbeaten in [4.17, 10.12]
+    4,
+    // window 3 is unbeaten in [10.12, 24.65]
+    10,
+    // window 4 is unbeaten in [24.65, 60.03]
+    25,
+    // window 5 is unbeaten in [60.03, 143.16]
+    60,
+    // window 6 is unbeaten in [143.16, 344.73]
+    143,
+    // window 7 is unbeaten in [344.73, 821.24]
+    345,
+    // window 8 is unbeaten in [821.24, 1793.92]
+    821,
+    // window 9 is unbeaten in [1793.92, 3919.59]
+    1794,
+    // window 10 is unbeaten in [3919.59, 11301.46]
+    3920,
+    // window 11 is unbeaten in [11301.46, 18960.09]
+    11301,
+    // window 12 is unbeaten in [18960.09, 44198.62]
+    18960,
+    // window 13 is unbeaten in [44198.62, 150799.57]
+    44199,
+    // window 14 is never the best
+    0,
+    // window 15 is unbeaten in [150799.57, 548694.81]
+    150800,
+    // window 16 is unbeaten in [548694.81, 1051769.08]
+    548695,
+    // window 17 is unbeaten in [1051769.08, 2023925.59]
+    1051769,
+    // window 18 is unbeaten in [2023925.59, 3787108.68]
+    2023926,
+    // window 19 is unbeaten in [3787108.68, 7107480.30]
+    3787109,
+    // window 20 is unbeaten in [7107480.30, 38760027.14]
+    7107480,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [38760027.14, inf]
+    38760027
+};
+/* mnt4_twist */
+mnt4_Fq2 mnt4_G2::twist = mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x18c31a7b5863845c), BIGINT_LIMB64(0xe9de7a15e3b68df5), BIGINT_LIMB64(0xc5df858728faab40), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)));
+/* mnt4_twist_coeff_a */
+mnt4_Fq2 mnt4_G2::coeff_a = mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x8228f515183d9429), BIGINT_LIMB64(0x3697e4617d5e0773), BIGINT_LIMB64(0x63b1ef20fd2ae0e5), BIGINT_LIMB64(0xf13c6f00850be1ca), BIGINT_LIMB64(0x0000039408106d24)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* mnt4_twist_coeff_b */
+mnt4_Fq2 mnt4_G2::coeff_b = mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x83fe40c4d1567e3b), BIGINT_LIMB64(0xba02dace3054677d), BIGINT_LIMB64(0x1453aa2f8110c177), BIGINT_LIMB64(0x407cb271ddb823fa), BIGINT_LIMB64(0x00000196f5debb6c)));
+/* ((0, 0), (1, 0), (0, 0)) */
+mnt4_G2 mnt4_G2::G2_zero = mnt4_G2(mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x18c31a7b5863845c), BIGINT_LIMB64(0xe9de7a15e3b68df5), BIGINT_LIMB64(0xc5df858728faab40), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
+/* ((438374926219350099854919100077809681842783509163790991847867546339851681564223481322252708, 37620953615500480110935514360923278605464476459712393277679280819942849043649216370485641), (37437409008528968268352521034936931842973546441370663118543015118291998305624025037512482, 424621479598893882672393190337420680597584695892317197646113820787463109735345923009077489), (1, 0)) */
+mnt4_G2 mnt4_G2::G2_one = mnt4_G2(mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x4a56b87bf6e3bbf2), BIGINT_LIMB64(0x2540055a02dbe484), BIGINT_LIMB64(0x40fdc053176b14fe), BIGINT_LIMB64(0x909fe4b201a779ae), BIGINT_LIMB64(0x00000178e1c4e680)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x01d9e9b91f772f70), BIGINT_LIMB64(0xd5a6dac8c5ab51c2), BIGINT_LIMB64(0xfd90c8649f6452a5), BIGINT_LIMB64(0x7e38904fbe0dfae2), BIGINT_LIMB64(0x000002186470a169))), mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0xead181e1ccdfa094), BIGINT_LIMB64(0xd837d925c1014f34), BIGINT_LIMB64(0x3728254a46d08bd6), BIGINT_LIMB64(0x7206e4a3c7ca1455), BIGINT_LIMB64(0x0000026768c82920)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x01063f70c6460c54), BIGINT_LIMB64(0x783caeb87ed305ec), BIGINT_LIMB64(0xa0a5df3e419c22c6), BIGINT_LIMB64(0xf927cfd064735d73), BIGINT_LIMB64(0x000001f8a707e350))), mnt4_Fq2(mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x18c31a7b5863845c), BIGINT_LIMB64(0xe9de7a15e3b68df5), BIGINT_LIMB64(0xc5df858728faab40), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt4_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
 
 mnt4_Fq2 mnt4_G2::mul_by_a(const mnt4_Fq2 &elt)
 {
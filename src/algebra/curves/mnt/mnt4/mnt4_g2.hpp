@@ -45,7 +45,7 @@ public:
 
     // using projective coordinates
     mnt4_G2();
-    mnt4_G2(const mnt4_Fq2& X, const mnt4_Fq2& Y, const mnt4_Fq2& Z) : X_(X), Y_(Y), Z_(Z) {};
+    constexpr mnt4_G2(const mnt4_Fq2& X, const mnt4_Fq2& Y, const mnt4_Fq2& Z) : X_(X), Y_(Y), Z_(Z) {};
 
     mnt4_Fq2 X() const { return X_; }
     mnt4_Fq2 Y() const { return Y_; }
@@ -57,6 +57,23 @@ extern bigint<mnt4_q_limbs> mnt4_final_exponent_last_chunk_abs_of_w0;
 extern bool mnt4_final_exponent_last_chunk_is_w0_neg;
 extern bigint<mnt4_q_limbs> mnt4_final_exponent_last_chunk_w1;
 
+/*
+ * The parameters of the fields above are constant-initialized: those of
+ * mnt4_Fr and mnt4_Fq in mnt46_common.cpp, those of Fq2 and Fq4 in mnt4_init.cpp
+ * (as are all other parameters of the curve). They can thus be used without
+ * calling init_mnt4_params() first.
+ */
+template<> bigint<2*mnt4_q_limbs> mnt4_Fq2::euler;
+template<> size_t mnt4_Fq2::s;
+template<> bigint<2*mnt4_q_limbs> mnt4_Fq2::t;
+template<> bigint<2*mnt4_q_limbs> mnt4_Fq2::t_minus_1_over_2;
+template<> mnt4_Fq mnt4_Fq2::non_residue;
+template<> mnt4_Fq2 mnt4_Fq2::nqr;
+template<> mnt4_Fq2 mnt4_Fq2::nqr_to_t;
+template<> mnt4_Fq mnt4_Fq2::Frobenius_coeffs_c1[2];
+template<> mnt4_Fq mnt4_Fq4::non_residue;
+template<> mnt4_Fq mnt4_Fq4::Frobenius_coeffs_c1[4];
+
 void init_mnt4_params();
 
 class mnt4_G1;
@@ -18,6 +18,7 @@
 #include "algebra/curves/mnt/mnt4/mnt4_init.hpp"
 #include "algebra/curves/mnt/mnt4/mnt4_g1.hpp"
 #include "algebra/curves/mnt/mnt4/mnt4_g2.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/wnaf.hpp"
 #include "common/profiling.hpp"
 
@@ -542,11 +543,10 @@ mnt4_ate_G2_precomp mnt4_ate_precompute_G2(const mnt4_G2& Q)
     return result;
 }
 
-mnt4_Fq4 mnt4_ate_miller_loop(const mnt4_ate_G1_precomp &prec_P,
-                              const mnt4_ate_G2_precomp &prec_Q)
+/* the Miller loop, up to the inversion that a negative loop count requires */
+static mnt4_Fq4 mnt4_ate_miller_loop_uninverted(const mnt4_ate_G1_precomp &prec_P,
+                                               const mnt4_ate_G2_precomp &prec_Q)
 {
-    enter_block("Call to mnt4_ate_miller_loop");
-
     mnt4_Fq2 L1_coeff = mnt4_Fq2(prec_P.PX, mnt4_Fq::zero()) - prec_Q.QX_over_twist;
 
     mnt4_Fq4 f = mnt4_Fq4::one();
@@ -590,7 +590,21 @@ mnt4_Fq4 mnt4_ate_miller_loop(const mnt4_ate_G1_precomp &prec_P,
     	mnt4_ate_add_coeffs ac = prec_Q.add_coeffs[add_idx++];
     	mnt4_Fq4 g_RnegR_at_P = mnt4_Fq4(ac.c_RZ * prec_P.PY_twist,
                                          -(prec_Q.QY_over_twist * ac.c_RZ + L1_coeff * ac.c_L1));
-    	f = (f * g_RnegR_at_P).inverse();
+    	f = f * g_RnegR_at_P;
+    }
+
+    return f;
+}
+
+mnt4_Fq4 mnt4_ate_miller_loop(const mnt4_ate_G1_precomp &prec_P,
+                              const mnt4_ate_G2_precomp &prec_Q)
+{
+    enter_block("Call to mnt4_ate_miller_loop");
+
+    mnt4_Fq4 f = mnt4_ate_miller_loop_uninverted(prec_P, prec_Q);
+    if (mnt4_ate_is_loop_count_neg)
+    {
+        f = f.inverse();
     }
 
     leave_block("Call to mnt4_ate_miller_loop");
@@ -674,6 +688,32 @@ mnt4_Fq4 mnt4_ate_double_miller_loop(const mnt4_ate_G1_precomp &prec_P1,
     return f;
 }
 
+std::vector<mnt4_Fq4> mnt4_ate_batch_miller_loop(const std::vector<mnt4_ate_G1_precomp> &prec_P,
+                                                 const std::vector<mnt4_ate_G2_precomp> &prec_Q)
+{
+    enter_block("Call to mnt4_ate_batch_miller_loop");
+    assert(prec_P.size() == prec_Q.size());
+
+    std::vector<mnt4_Fq4> f(prec_P.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < f.size(); ++j)
+    {
+        f[j] = mnt4_ate_miller_loop_uninverted(prec_P[j], prec_Q[j]);
+    }
+
+    if (mnt4_ate_is_loop_count_neg)
+    {
+        /* one inversion for all pairs */
+        batch_invert(f);
+    }
+
+    leave_block("Call to mnt4_ate_batch_miller_loop");
+
+    return f;
+}
+
 mnt4_Fq4 mnt4_ate_pairing(const mnt4_G1& P, const mnt4_G2 &Q)
 {
     enter_block("Call to mnt4_ate_pairing");
@@ -717,6 +757,12 @@ mnt4_Fq4 mnt4_double_miller_loop(const mnt4_G1_precomp &prec_P1,
     return mnt4_ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<mnt4_Fq4> mnt4_batch_miller_loop(const std::vector<mnt4_G1_precomp> &prec_P,
+                                             const std::vector<mnt4_G2_precomp> &prec_Q)
+{
+    return mnt4_ate_batch_miller_loop(prec_P, prec_Q);
+}
+
 mnt4_Fq4 mnt4_pairing(const mnt4_G1& P,
                       const mnt4_G2 &Q)
 {
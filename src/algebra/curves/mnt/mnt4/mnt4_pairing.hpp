@@ -112,6 +112,10 @@ mnt4_Fq4 mnt4_ate_double_miller_loop(const mnt4_ate_G1_precomp &prec_P1,
                                            const mnt4_ate_G1_precomp &prec_P2,
                                            const mnt4_ate_G2_precomp &prec_Q2);
 
+/* Miller loops of the independent pairs (prec_P[i], prec_Q[i]) */
+std::vector<mnt4_Fq4> mnt4_ate_batch_miller_loop(const std::vector<mnt4_ate_G1_precomp> &prec_P,
+                                                 const std::vector<mnt4_ate_G2_precomp> &prec_Q);
+
 mnt4_Fq4 mnt4_ate_pairing(const mnt4_G1& P,
                           const mnt4_G2 &Q);
 mnt4_GT mnt4_ate_reduced_pairing(const mnt4_G1 &P,
@@ -134,6 +138,9 @@ mnt4_Fq4 mnt4_double_miller_loop(const mnt4_G1_precomp &prec_P1,
                                  const mnt4_G1_precomp &prec_P2,
                                  const mnt4_G2_precomp &prec_Q2);
 
+std::vector<mnt4_Fq4> mnt4_batch_miller_loop(const std::vector<mnt4_G1_precomp> &prec_P,
+                                             const std::vector<mnt4_G2_precomp> &prec_Q);
+
 mnt4_Fq4 mnt4_pairing(const mnt4_G1& P,
                       const mnt4_G2 &Q);
 
@@ -35,6 +35,11 @@ mnt4_G2_precomp mnt4_pp::precompute_G2(const mnt4_G2 &Q)
     return mnt4_precompute_G2(Q);
 }
 
+mnt4_G2_precomp mnt4_pp::precompute_G2_for_reuse(const mnt4_G2 &Q)
+{
+    return mnt4_pp::precompute_G2(Q);
+}
+
 mnt4_Fq4 mnt4_pp::miller_loop(const mnt4_G1_precomp &prec_P,
                               const mnt4_G2_precomp &prec_Q)
 {
@@ -84,6 +89,12 @@ mnt4_Fq4 mnt4_pp::double_miller_loop(const mnt4_G1_precomp &prec_P1,
     return mnt4_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<mnt4_Fq4> mnt4_pp::batch_miller_loop(const std::vector<mnt4_G1_precomp> &prec_P,
+                                                 const std::vector<mnt4_G2_precomp> &prec_Q)
+{
+    return mnt4_batch_miller_loop(prec_P, prec_Q);
+}
+
 mnt4_Fq4 mnt4_pp::pairing(const mnt4_G1 &P,
                           const mnt4_G2 &Q)
 {
@@ -41,6 +41,7 @@ public:
 
     static mnt4_G1_precomp precompute_G1(const mnt4_G1 &P);
     static mnt4_G2_precomp precompute_G2(const mnt4_G2 &Q);
+    static mnt4_G2_precomp precompute_G2_for_reuse(const mnt4_G2 &Q);
 
     static mnt4_Fq4 miller_loop(const mnt4_G1_precomp &prec_P,
                                 const mnt4_G2_precomp &prec_Q);
@@ -65,6 +66,8 @@ public:
                                        const mnt4_G2_precomp &prec_Q1,
                                        const mnt4_G1_precomp &prec_P2,
                                        const mnt4_G2_precomp &prec_Q2);
+    static std::vector<mnt4_Fq4> batch_miller_loop(const std::vector<mnt4_G1_precomp> &prec_P,
+                                                   const std::vector<mnt4_G2_precomp> &prec_Q);
 
     /* the following are used in test files */
     static mnt4_Fq4 pairing(const mnt4_G1 &P,
@@ -15,7 +15,56 @@
 
 namespace libsnark {
 
-bigint<mnt46_A_limbs> mnt46_modulus_A;
-bigint<mnt46_B_limbs> mnt46_modulus_B;
+/* parameters for the field of modulus A (scalar field of MNT4, base field of MNT6) */
+
+/* 475922286169261325753349249653048451545124878552823515553267735739164647307408490559963137 */
+bigint<mnt46_A_limbs> mnt46_modulus_A = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0xbb4334a400000001), BIGINT_LIMB64(0xfb494c07925d6ad3), BIGINT_LIMB64(0xcaeec9635cf44194), BIGINT_LIMB64(0xa266249da7b0548e), BIGINT_LIMB64(0x000003bcf7bcd473));
+/* 163983144722506446826715124368972380525894397127205577781234305496325861831001705438796139 */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::Rsquared = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0x465a743c68e0596b), BIGINT_LIMB64(0x034f9102adb68371), BIGINT_LIMB64(0x4bbd6dcf1e3a8386), BIGINT_LIMB64(0x02ff00dced8e4b6d), BIGINT_LIMB64(0x00000149bb44a342));
+/* 207236281459091063710247635236340312578688659363066707916716212805695955118593239854980171 */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::Rcubed = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0xb6de2f1b99bd9c4b), BIGINT_LIMB64(0xf687b031b7f0b2b9), BIGINT_LIMB64(0xac13907bab5d43c2), BIGINT_LIMB64(0xb440f6a9ed2947ce), BIGINT_LIMB64(0x000001a0b411c083));
+template<> mp_limb_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::inv = (mp_limb_t) 0xbb4334a3ffffffff;
+template<> size_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::num_bits = 298;
+/* 237961143084630662876674624826524225772562439276411757776633867869582323653704245279981568 */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::euler = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0xdda19a5200000000), BIGINT_LIMB64(0x7da4a603c92eb569), BIGINT_LIMB64(0x657764b1ae7a20ca), BIGINT_LIMB64(0xd133124ed3d82a47), BIGINT_LIMB64(0x000001de7bde6a39));
+template<> size_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::s = 34;
+/* 27702323054502562488973446286577291993024111641153199339359284829066871159442729 */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::t = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0xe4975ab4eed0cd29), BIGINT_LIMB64(0xd73d10653ed25301), BIGINT_LIMB64(0x69ec1523b2bbb258), BIGINT_LIMB64(0x3def351ce8998927), BIGINT_LIMB64(0x00000000000000ef));
+/* 13851161527251281244486723143288645996512055820576599669679642414533435579721364 */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::t_minus_1_over_2 = bigint<mnt46_A_limbs>(bigint_limbs, BIGINT_LIMB64(0xf24bad5a77686694), BIGINT_LIMB64(0x6b9e88329f692980), BIGINT_LIMB64(0xb4f60a91d95dd92c), BIGINT_LIMB64(0x9ef79a8e744cc493), BIGINT_LIMB64(0x0000000000000077));
+/* 10 */
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::multiplicative_generator = Fp_model<mnt46_A_limbs, mnt46_modulus_A>(montgomery_limbs, BIGINT_LIMB64(0xb1ddfacffd532b94), BIGINT_LIMB64(0x25e295ff76674008), BIGINT_LIMB64(0x8f00647b48958d36), BIGINT_LIMB64(0x1159f37d4e0fddb2), BIGINT_LIMB64(0x000002977770b3d1));
+/* 120638817826913173458768829485690099845377008030891618010109772937363554409782252579816313 */
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::root_of_unity = Fp_model<mnt46_A_limbs, mnt46_modulus_A>(montgomery_limbs, BIGINT_LIMB64(0x818b361df1af7be4), BIGINT_LIMB64(0x2ae2750d46a53957), BIGINT_LIMB64(0x5784a8fe792c5f8a), BIGINT_LIMB64(0xf9bd39c0cdcf1bb6), BIGINT_LIMB64(0x0000006a24a0f8a8));
+/* 5 */
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::nqr = Fp_model<mnt46_A_limbs, mnt46_modulus_A>(montgomery_limbs, BIGINT_LIMB64(0x58eefd67fea995ca), BIGINT_LIMB64(0x12f14affbb33a004), BIGINT_LIMB64(0x4780323da44ac69b), BIGINT_LIMB64(0x88acf9bea707eed9), BIGINT_LIMB64(0x0000014bbbb859e8));
+/* 406220604243090401056429458730298145937262552508985450684842547562990900634752279902740880 */
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::nqr_to_t = Fp_model<mnt46_A_limbs, mnt46_modulus_A>(montgomery_limbs, BIGINT_LIMB64(0x89521bfda12f07f0), BIGINT_LIMB64(0x91413f08d15b54da), BIGINT_LIMB64(0x30bf7490d1156bcf), BIGINT_LIMB64(0x4b46c5bfd53e80d7), BIGINT_LIMB64(0x00000116674aec66));
+
+/* parameters for the field of modulus B (base field of MNT4, scalar field of MNT6) */
+
+/* 475922286169261325753349249653048451545124879242694725395555128576210262817955800483758081 */
+bigint<mnt46_B_limbs> mnt46_modulus_B = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0xc90cd65a71660001), BIGINT_LIMB64(0x41a9e35e51200e12), BIGINT_LIMB64(0xcaeec9635d1330ea), BIGINT_LIMB64(0xa266249da7b0548e), BIGINT_LIMB64(0x000003bcf7bcd473));
+/* 273000478523237720910981655601160860640083126627235719712980612296263966512828033847775776 */
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::Rsquared = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0x0065acec5613d220), BIGINT_LIMB64(0xa266a1adbf2bc893), BIGINT_LIMB64(0x66bd7673318850e1), BIGINT_LIMB64(0x1f32e014ad38d47b), BIGINT_LIMB64(0x00000224f0918a34));
+/* 427298980065529822574935274648041073124704261331681436071990730954930769758106792920349077 */
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::Rcubed = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0xa3fe093a2c77f995), BIGINT_LIMB64(0x1de648c893ba7447), BIGINT_LIMB64(0x626c4c908a507317), BIGINT_LIMB64(0xdb492b899fb731b0), BIGINT_LIMB64(0x0000035b329c5c21));
+template<> mp_limb_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::inv = (mp_limb_t) 0xb071a1b67165ffff;
+template<> size_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::num_bits = 298;
+/* 237961143084630662876674624826524225772562439621347362697777564288105131408977900241879040 */
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::euler = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0x64866b2d38b30000), BIGINT_LIMB64(0x20d4f1af28900709), BIGINT_LIMB64(0x657764b1ae899875), BIGINT_LIMB64(0xd133124ed3d82a47), BIGINT_LIMB64(0x000001de7bde6a39));
+template<> size_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::s = 17;
+/* 3630998887399759870554727551674258816109656366292531779446068791017229177993437198515 */
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::t = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0x070964866b2d38b3), BIGINT_LIMB64(0x987520d4f1af2890), BIGINT_LIMB64(0x2a47657764b1ae89), BIGINT_LIMB64(0x6a39d133124ed3d8), BIGINT_LIMB64(0x0000000001de7bde));
+/* 1815499443699879935277363775837129408054828183146265889723034395508614588996718599257 */
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::t_minus_1_over_2 = bigint<mnt46_B_limbs>(bigint_limbs, BIGINT_LIMB64(0x0384b24335969c59), BIGINT_LIMB64(0xcc3a906a78d79448), BIGINT_LIMB64(0x1523b2bbb258d744), BIGINT_LIMB64(0x351ce899892769ec), BIGINT_LIMB64(0x0000000000ef3def));
+/* 17 */
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::multiplicative_generator = Fp_model<mnt46_B_limbs, mnt46_modulus_B>(montgomery_limbs, BIGINT_LIMB64(0x259ae5b7c4d1ca15), BIGINT_LIMB64(0xbc20e3dfe73f0ac3), BIGINT_LIMB64(0x97505c422d1f08e7), BIGINT_LIMB64(0x49d149cf165e1b2c), BIGINT_LIMB64(0x000003a87fe6a0cc));
+/* 264706250571800080758069302369654305530125675521263976034054878017580902343339784464690243 */
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::root_of_unity = Fp_model<mnt46_B_limbs, mnt46_modulus_B>(montgomery_limbs, BIGINT_LIMB64(0x884ce85c8d89f2b9), BIGINT_LIMB64(0x8366528dcef9a167), BIGINT_LIMB64(0x8a465859c7d431ff), BIGINT_LIMB64(0xce4c49d76adbcbc5), BIGINT_LIMB64(0x0000039fc98494e1));
+/* 17 */
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::nqr = Fp_model<mnt46_B_limbs, mnt46_modulus_B>(montgomery_limbs, BIGINT_LIMB64(0x259ae5b7c4d1ca15), BIGINT_LIMB64(0xbc20e3dfe73f0ac3), BIGINT_LIMB64(0x97505c422d1f08e7), BIGINT_LIMB64(0x49d149cf165e1b2c), BIGINT_LIMB64(0x000003a87fe6a0cc));
+/* 264706250571800080758069302369654305530125675521263976034054878017580902343339784464690243 */
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::nqr_to_t = Fp_model<mnt46_B_limbs, mnt46_modulus_B>(montgomery_limbs, BIGINT_LIMB64(0x884ce85c8d89f2b9), BIGINT_LIMB64(0x8366528dcef9a167), BIGINT_LIMB64(0x8a465859c7d431ff), BIGINT_LIMB64(0xce4c49d76adbcbc5), BIGINT_LIMB64(0x0000039fc98494e1));
 
 } // libsnark
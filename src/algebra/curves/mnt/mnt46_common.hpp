@@ -13,6 +13,7 @@
 #define MNT46_COMMON_HPP_
 
 #include "algebra/fields/bigint.hpp"
+#include "algebra/fields/fp.hpp"
 
 namespace libsnark {
 
@@ -25,6 +26,38 @@ const mp_size_t mnt46_B_limbs = (mnt46_B_bitcount+GMP_NUMB_BITS-1)/GMP_NUMB_BITS
 extern bigint<mnt46_A_limbs> mnt46_modulus_A;
 extern bigint<mnt46_B_limbs> mnt46_modulus_B;
 
+/*
+ * Fp_model<mnt46_A_limbs, mnt46_modulus_A> is both the scalar field of MNT4
+ * and the base field of MNT6 (and conversely for modulus B), so the
+ * parameters of these two fields are constant-initialized once, in
+ * mnt46_common.cpp .
+ */
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::Rsquared;
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::Rcubed;
+template<> mp_limb_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::inv;
+template<> size_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::num_bits;
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::euler;
+template<> size_t Fp_model<mnt46_A_limbs, mnt46_modulus_A>::s;
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::t;
+template<> bigint<mnt46_A_limbs> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::t_minus_1_over_2;
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::multiplicative_generator;
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::root_of_unity;
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::nqr;
+template<> Fp_model<mnt46_A_limbs, mnt46_modulus_A> Fp_model<mnt46_A_limbs, mnt46_modulus_A>::nqr_to_t;
+
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::Rsquared;
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::Rcubed;
+template<> mp_limb_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::inv;
+template<> size_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::num_bits;
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::euler;
+template<> size_t Fp_model<mnt46_B_limbs, mnt46_modulus_B>::s;
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::t;
+template<> bigint<mnt46_B_limbs> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::t_minus_1_over_2;
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::multiplicative_generator;
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::root_of_unity;
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::nqr;
+template<> Fp_model<mnt46_B_limbs, mnt46_modulus_B> Fp_model<mnt46_B_limbs, mnt46_modulus_B>::nqr_to_t;
+
 } // libsnark
 
 #endif
@@ -20,12 +20,61 @@ long long mnt6_G1::add_cnt = 0;
 long long mnt6_G1::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> mnt6_G1::wnaf_window_table;
-std::vector<size_t> mnt6_G1::fixed_base_exp_window_table;
-mnt6_G1 mnt6_G1::G1_zero;
-mnt6_G1 mnt6_G1::G1_one;
-mnt6_Fq mnt6_G1::coeff_a;
-mnt6_Fq mnt6_G1::coeff_b;
+std::vector<size_t> mnt6_G1::wnaf_window_table = { 11, 24, 60, 127 };
+std::vector<size_t> mnt6_G1::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 3.96]
+    1,
+    // window 2 is unbeaten in [3.96, 9.67]
+    4,
+    // window 3 is unbeaten in [9.67, 25.13]
+    10,
+    // window 4 is unbeaten in [25.13, 60.31]
+    25,
+    // window 5 is unbeaten in [60.31, 146.07]
+    60,
+    // window 6 is unbeaten in [146.07, 350.09]
+    146,
+    // window 7 is unbeaten in [350.09, 844.54]
+    350,
+    // window 8 is unbeaten in [844.54, 1839.64]
+    845,
+    // window 9 is unbeaten in [1839.64, 3904.26]
+    1840,
+    // window 10 is unbeaten in [3904.26, 11309.42]
+    3904,
+    // window 11 is unbeaten in [11309.42, 24015.57]
+    11309,
+    // window 12 is unbeaten in [24015.57, 72288.57]
+    24016,
+    // window 13 is unbeaten in [72288.57, 138413.22]
+    72289,
+    // window 14 is unbeaten in [138413.22, 156390.30]
+    138413,
+    // window 15 is unbeaten in [156390.30, 562560.50]
+    156390,
+    // window 16 is unbeaten in [562560.50, 1036742.02]
+    562560,
+    // window 17 is unbeaten in [1036742.02, 2053818.86]
+    1036742,
+    // window 18 is unbeaten in [2053818.86, 4370223.95]
+    2053819,
+    // window 19 is unbeaten in [4370223.95, 8215703.81]
+    4370224,
+    // window 20 is unbeaten in [8215703.81, 42682375.43]
+    8215704,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [42682375.43, inf]
+    42682375
+};
+/* (0, 1, 0) */
+mnt6_G1 mnt6_G1::G1_zero = mnt6_G1(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (336685752883082228109289846353937104185698209371404178342968838739115829740084426881123453, 402596290139780989709332707716568920777622032073762749862342374583908837063963736098549800, 1) */
+mnt6_G1 mnt6_G1::G1_one = mnt6_G1(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x1a663562f74e1d24), BIGINT_LIMB64(0xc1d1d583fccd1b79), BIGINT_LIMB64(0xda077538a9763df2), BIGINT_LIMB64(0x70c4a4ea36aa01d9), BIGINT_LIMB64(0x00000086537578a8)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x7ad5bfd16dcfffb2), BIGINT_LIMB64(0x88dd739252215070), BIGINT_LIMB64(0x43f137a8b517b339), BIGINT_LIMB64(0x9a7fac709a8c463c), BIGINT_LIMB64(0x000003140fbc3593)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)));
+/* 11 */
+mnt6_Fq mnt6_G1::coeff_a = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xb9b2411bfd0eafef), BIGINT_LIMB64(0xc61a10fadd9fecbd), BIGINT_LIMB64(0x89f128e59811f3fb), BIGINT_LIMB64(0x980c0f780adadabb), BIGINT_LIMB64(0x0000009ba1f11320));
+/* 106700080510851735677967319632585352256454251201367587890185989362936000262606668469523074 */
+mnt6_Fq mnt6_G1::coeff_b = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0a94cb16ed8e733b), BIGINT_LIMB64(0x0e1ed15e8119bae6), BIGINT_LIMB64(0xae927592157c8121), BIGINT_LIMB64(0x990dbcbc6661cf95), BIGINT_LIMB64(0x000000ecff0892ef));
 
 mnt6_G1::mnt6_G1()
 {
@@ -481,6 +530,13 @@ std::istream& operator>>(std::istream& in, std::vector<mnt6_G1> &v)
     return in;
 }
 
+template<>
+bool is_in_subgroup<mnt6_G1>(const mnt6_G1 &P)
+{
+    /* the curve has prime order, so all of its points lie in G1 */
+    return true;
+}
+
 template<>
 void batch_to_special_all_non_zeros<mnt6_G1>(std::vector<mnt6_G1> &vec)
 {
@@ -44,7 +44,7 @@ public:
     // using projective coordinates
     mnt6_G1();
     mnt6_G1(const mnt6_Fq& X, const mnt6_Fq& Y) : X_(X), Y_(Y), Z_(base_field::one()) {}
-    mnt6_G1(const mnt6_Fq& X, const mnt6_Fq& Y, const mnt6_Fq& Z) : X_(X), Y_(Y), Z_(Z) {}
+    constexpr mnt6_G1(const mnt6_Fq& X, const mnt6_Fq& Y, const mnt6_Fq& Z) : X_(X), Y_(Y), Z_(Z) {}
 
     mnt6_Fq X() const { return X_; }
     mnt6_Fq Y() const { return Y_; }
@@ -104,6 +104,9 @@ void batch_to_special_all_non_zeros(std::vector<T> &vec);
 template<>
 void batch_to_special_all_non_zeros<mnt6_G1>(std::vector<mnt6_G1> &vec);
 
+template<>
+bool is_in_subgroup<mnt6_G1>(const mnt6_G1 &P);
+
 } // libsnark
 
 #endif // MNT6_G1_HPP_
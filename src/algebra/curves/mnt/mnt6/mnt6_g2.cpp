@@ -20,13 +20,63 @@ long long mnt6_G2::add_cnt = 0;
 long long mnt6_G2::dbl_cnt = 0;
 #endif
 
-std::vector<size_t> mnt6_G2::wnaf_window_table;
-std::vector<size_t> mnt6_G2::fixed_base_exp_window_table;
-mnt6_Fq3 mnt6_G2::twist;
-mnt6_Fq3 mnt6_G2::coeff_a;
-mnt6_Fq3 mnt6_G2::coeff_b;
-mnt6_G2 mnt6_G2::G2_zero;
-mnt6_G2 mnt6_G2::G2_one;
+std::vector<size_t> mnt6_G2::wnaf_window_table = { 5, 15, 39, 109 };
+std::vector<size_t> mnt6_G2::fixed_base_exp_window_table = {
+    // window 1 is unbeaten in [-inf, 4.25]
+    1,
+    // window 2 is unbeaten in [4.25, 10.22]
+    4,
+    // window 3 is unbeaten in [10.22, 24.85]
+    10,
+    // window 4 is unbeaten in [24.85, 60.06]
+    25,
+    // window 5 is unbeaten in [60.06, 143.61]
+    60,
+    // window 6 is unbeaten in [143.61, 345.66]
+    144,
+    // window 7 is unbeaten in [345.66, 818.56]
+    346,
+    // window 8 is unbeaten in [818.56, 1782.06]
+    819,
+    // window 9 is unbeaten in [1782.06, 4002.45]
+    1782,
+    // window 10 is unbeaten in [4002.45, 10870.18]
+    4002,
+    // window 11 is unbeaten in [10870.18, 18022.51]
+    10870,
+    // window 12 is unbeaten in [18022.51, 43160.74]
+    18023,
+    // window 13 is unbeaten in [43160.74, 149743.32]
+    43161,
+    // window 14 is never the best
+    0,
+    // window 15 is unbeaten in [149743.32, 551844.13]
+    149743,
+    // window 16 is unbeaten in [551844.13, 1041827.91]
+    551844,
+    // window 17 is unbeaten in [1041827.91, 1977371.53]
+    1041828,
+    // window 18 is unbeaten in [1977371.53, 3703619.51]
+    1977372,
+    // window 19 is unbeaten in [3703619.51, 7057236.87]
+    3703620,
+    // window 20 is unbeaten in [7057236.87, 38554491.67]
+    7057237,
+    // window 21 is never the best
+    0,
+    // window 22 is unbeaten in [38554491.67, inf]
+    38554492
+};
+/* mnt6_twist */
+mnt6_Fq3 mnt6_G2::twist = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* mnt6_twist_coeff_a */
+mnt6_Fq3 mnt6_G2::coeff_a = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xb9b2411bfd0eafef), BIGINT_LIMB64(0xc61a10fadd9fecbd), BIGINT_LIMB64(0x89f128e59811f3fb), BIGINT_LIMB64(0x980c0f780adadabb), BIGINT_LIMB64(0x0000009ba1f11320)));
+/* mnt6_twist_coeff_b */
+mnt6_Fq3 mnt6_G2::coeff_b = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x79a4c2cea3c84026), BIGINT_LIMB64(0x4b50cad0f3233baa), BIGINT_LIMB64(0x9ded82770e7a4410), BIGINT_LIMB64(0x5ade8b105838b95d), BIGINT_LIMB64(0x000000e4036e0a3a)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* ((0, 0, 0), (1, 0, 0), (0, 0, 0)) */
+mnt6_G2 mnt6_G2::G2_zero = mnt6_G2(mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))), mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
+/* ((421456435772811846256826561593908322288509115489119907560382401870203318738334702321297427, 103072927438548502463527009961344915021167584706439945404959058962657261178393635706405114, 143029172143731852627002926324735183809768363301149009204849580478324784395590388826052558), (464673596668689463130099227575639512541218133445388869383893594087634649237515554342751377, 100642907501977375184575075967118071807821117960152743335603284583254620685343989304941678, 123019855502969896026940545715841181300275180157288044663051565390506010149881373807142903), (1, 0, 0)) */
+mnt6_G2 mnt6_G2::G2_one = mnt6_G2(mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x15ca12fc5d551ea7), BIGINT_LIMB64(0x9e0b2b2b2bb8b979), BIGINT_LIMB64(0xe6e66283ad5a786a), BIGINT_LIMB64(0x46ba0aedcc383c07), BIGINT_LIMB64(0x00000243853463ed)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x2c0e3dd7be176130), BIGINT_LIMB64(0x27a15d879495904b), BIGINT_LIMB64(0x6f1f0d2dd1502a82), BIGINT_LIMB64(0x09782ee3c70834da), BIGINT_LIMB64(0x000002c28bb71862)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xf3e5f4eb9631e1f1), BIGINT_LIMB64(0x0657801e80c50778), BIGINT_LIMB64(0x2d2abb128fee90f3), BIGINT_LIMB64(0x72e58e4c3aa3598c), BIGINT_LIMB64(0x00000100b8026b9d))), mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xb1cddd6c64a67c5f), BIGINT_LIMB64(0xa01e90d89aa5d2ba), BIGINT_LIMB64(0x039e9a733be49ed1), BIGINT_LIMB64(0x9438f46f63d3264f), BIGINT_LIMB64(0x0000012cc928ef10)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xa1529b7265ad4be7), BIGINT_LIMB64(0x21c5e827cf309306), BIGINT_LIMB64(0x9b3d647bd8c70b22), BIGINT_LIMB64(0x42835bf373e4b213), BIGINT_LIMB64(0x000000d3c77c9ff9)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x610557ec4b58b8df), BIGINT_LIMB64(0x51a23865b52045f1), BIGINT_LIMB64(0x9dcfd915a09da608), BIGINT_LIMB64(0x6d65c95f69adb700), BIGINT_LIMB64(0x000002d3c3d195a1))), mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000))));
 
 mnt6_G2::mnt6_G2()
 {
@@ -20,258 +20,91 @@ namespace libsnark {
 //bigint<mnt6_r_limbs> mnt6_modulus_r = mnt46_modulus_B;
 //bigint<mnt6_q_limbs> mnt6_modulus_q = mnt46_modulus_A;
 
-mnt6_Fq3 mnt6_twist;
-mnt6_Fq3 mnt6_twist_coeff_a;
-mnt6_Fq3 mnt6_twist_coeff_b;
-mnt6_Fq mnt6_twist_mul_by_a_c0;
-mnt6_Fq mnt6_twist_mul_by_a_c1;
-mnt6_Fq mnt6_twist_mul_by_a_c2;
-mnt6_Fq mnt6_twist_mul_by_b_c0;
-mnt6_Fq mnt6_twist_mul_by_b_c1;
-mnt6_Fq mnt6_twist_mul_by_b_c2;
-mnt6_Fq mnt6_twist_mul_by_q_X;
-mnt6_Fq mnt6_twist_mul_by_q_Y;
-
-bigint<mnt6_q_limbs> mnt6_ate_loop_count;
-bool mnt6_ate_is_loop_count_neg;
-bigint<6*mnt6_q_limbs> mnt6_final_exponent;
-bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_abs_of_w0;
-bool mnt6_final_exponent_last_chunk_is_w0_neg;
-bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_w1;
+/* parameters for twist field Fq3 */
+
+/* 53898680178554951715397245154796036139463891589001478629193136369124915637741423690184935056189295242736833704290747216410090671804540908400210778934462129625646263095398323485795557551284190224166851571615834194321908328559167529729507439069424158411618728014749106176 */
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::euler = bigint<3*mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x98e4cef600000000), BIGINT_LIMB64(0x3f003b81a48cadd5), BIGINT_LIMB64(0xf8dbdc80329943bf), BIGINT_LIMB64(0xbe6f3df9df28e58f), BIGINT_LIMB64(0xc23e7cc3932d198c), BIGINT_LIMB64(0xcbc0b60fbd44114f), BIGINT_LIMB64(0x619822ae7756e3f1), BIGINT_LIMB64(0xa5f25e91fe3405fb), BIGINT_LIMB64(0xae5a65bfac8866cd), BIGINT_LIMB64(0x14fab1f72198e11a), BIGINT_LIMB64(0xc82f4f320cf354c8), BIGINT_LIMB64(0x1ad661cc756dcf7e), BIGINT_LIMB64(0xf7f10b59bd7db698), BIGINT_LIMB64(0x1a1e3d618ba643d0));
+template<> size_t mnt6_Fq3::s = 34;
+/* 6274632199033507112809136178669989590936327770934612330653836993631547740397674926811006741620285348354004521888069251599964996777072188956687550402067383940523288107407084140669968625447269322370045302856694231080113482726640944570478452261237446033817102203 */
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::t = bigint<3*mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0xd24656eacc72677b), BIGINT_LIMB64(0x194ca1df9f801dc0), BIGINT_LIMB64(0xef9472c7fc6dee40), BIGINT_LIMB64(0xc9968cc65f379efc), BIGINT_LIMB64(0xdea208a7e11f3e61), BIGINT_LIMB64(0x3bab71f8e5e05b07), BIGINT_LIMB64(0xff1a02fdb0cc1157), BIGINT_LIMB64(0xd6443366d2f92f48), BIGINT_LIMB64(0x90cc708d572d32df), BIGINT_LIMB64(0x0679aa640a7d58fb), BIGINT_LIMB64(0x3ab6e7bf6417a799), BIGINT_LIMB64(0xdebedb4c0d6b30e6), BIGINT_LIMB64(0xc5d321e87bf885ac), BIGINT_LIMB64(0x000000000d0f1eb0));
+/* 3137316099516753556404568089334994795468163885467306165326918496815773870198837463405503370810142674177002260944034625799982498388536094478343775201033691970261644053703542070334984312723634661185022651428347115540056741363320472285239226130618723016908551101 */
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::t_minus_1_over_2 = bigint<3*mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x69232b75663933bd), BIGINT_LIMB64(0x0ca650efcfc00ee0), BIGINT_LIMB64(0x77ca3963fe36f720), BIGINT_LIMB64(0xe4cb46632f9bcf7e), BIGINT_LIMB64(0xef510453f08f9f30), BIGINT_LIMB64(0x9dd5b8fc72f02d83), BIGINT_LIMB64(0x7f8d017ed86608ab), BIGINT_LIMB64(0xeb2219b3697c97a4), BIGINT_LIMB64(0xc8663846ab96996f), BIGINT_LIMB64(0x833cd532053eac7d), BIGINT_LIMB64(0x1d5b73dfb20bd3cc), BIGINT_LIMB64(0x6f5f6da606b59873), BIGINT_LIMB64(0x62e990f43dfc42d6), BIGINT_LIMB64(0x0000000006878f58));
+/* 5 */
+template<> mnt6_Fq mnt6_Fq3::non_residue = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x58eefd67fea995ca), BIGINT_LIMB64(0x12f14affbb33a004), BIGINT_LIMB64(0x4780323da44ac69b), BIGINT_LIMB64(0x88acf9bea707eed9), BIGINT_LIMB64(0x0000014bbbb859e8));
+/* (5, 0, 0) */
+template<> mnt6_Fq3 mnt6_Fq3::nqr = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x58eefd67fea995ca), BIGINT_LIMB64(0x12f14affbb33a004), BIGINT_LIMB64(0x4780323da44ac69b), BIGINT_LIMB64(0x88acf9bea707eed9), BIGINT_LIMB64(0x0000014bbbb859e8)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* (154361449678783505076984156275977937654331103361174469632346230549735979552469642799720052, 0, 0) */
+template<> mnt6_Fq3 mnt6_Fq3::nqr_to_t = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x44a4178610a3a4e6), BIGINT_LIMB64(0x49321e4d00f35073), BIGINT_LIMB64(0xbbc01b9c400c07a1), BIGINT_LIMB64(0xd0127c4589095738), BIGINT_LIMB64(0x000003730de2a45d)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+template<> mnt6_Fq mnt6_Fq3::Frobenius_coeffs_c1[3] = {
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), /* 1 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x1c17bb7477085b6a), BIGINT_LIMB64(0x2621629c22e83dbb), BIGINT_LIMB64(0x21c062106d949dd8), BIGINT_LIMB64(0x09d5b981062164ba), BIGINT_LIMB64(0x00000084ad703207)), /* 471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xdc13fe3f893c203b), BIGINT_LIMB64(0x39a7226875df158f), BIGINT_LIMB64(0xe34ed98542eefb62), BIGINT_LIMB64(0x6f782a843d139e3c), BIGINT_LIMB64(0x00000177280f6ea9)) /* 4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180 */
+};
+template<> mnt6_Fq mnt6_Fq3::Frobenius_coeffs_c2[3] = {
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), /* 1 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xdc13fe3f893c203b), BIGINT_LIMB64(0x39a7226875df158f), BIGINT_LIMB64(0xe34ed98542eefb62), BIGINT_LIMB64(0x6f782a843d139e3c), BIGINT_LIMB64(0x00000177280f6ea9)), /* 4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x1c17bb7477085b6a), BIGINT_LIMB64(0x2621629c22e83dbb), BIGINT_LIMB64(0x21c062106d949dd8), BIGINT_LIMB64(0x09d5b981062164ba), BIGINT_LIMB64(0x00000084ad703207)) /* 471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956 */
+};
+
+/* parameters for Fq6 */
+
+/* 5 */
+template<> mnt6_Fq mnt6_Fq6::non_residue = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x58eefd67fea995ca), BIGINT_LIMB64(0x12f14affbb33a004), BIGINT_LIMB64(0x4780323da44ac69b), BIGINT_LIMB64(0x88acf9bea707eed9), BIGINT_LIMB64(0x0000014bbbb859e8));
+template<> mnt6_Fq mnt6_Fq6::Frobenius_coeffs_c1[6] = {
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), /* 1 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xdf2f366476c3dfc6), BIGINT_LIMB64(0xc1a2299f1c7e5543), BIGINT_LIMB64(0xe79fefde1a054632), BIGINT_LIMB64(0x32edfa196a9cb651), BIGINT_LIMB64(0x00000245cfad65ca)), /* 471738898967521029133040851318449165997304108729558973770077319830005517129946578866686957 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x1c17bb7477085b6a), BIGINT_LIMB64(0x2621629c22e83dbb), BIGINT_LIMB64(0x21c062106d949dd8), BIGINT_LIMB64(0x09d5b981062164ba), BIGINT_LIMB64(0x00000084ad703207)), /* 471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xf82bb9b400447ba5), BIGINT_LIMB64(0x5fc8850498c7534a), BIGINT_LIMB64(0x050f3b95b083993a), BIGINT_LIMB64(0x794de405433502f7), BIGINT_LIMB64(0x000001fbd57fa0b0)), /* 475922286169261325753349249653048451545124878552823515553267735739164647307408490559963136 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xdc13fe3f893c203b), BIGINT_LIMB64(0x39a7226875df158f), BIGINT_LIMB64(0xe34ed98542eefb62), BIGINT_LIMB64(0x6f782a843d139e3c), BIGINT_LIMB64(0x00000177280f6ea9)), /* 4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180 */
+    mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x9f2b792f88f7a497), BIGINT_LIMB64(0xd527e96b6f752d18), BIGINT_LIMB64(0xa92e6752ef5fa3bc), BIGINT_LIMB64(0x98906b1ca18eefd4), BIGINT_LIMB64(0x000003384a4ca26c)) /* 4183387201740296620308398334599285547820769823264541783190415909159130177461911693276181 */
+};
+/* mnt6_Fq3::non_residue */
+template<> mnt6_Fq Fp2_model<mnt6_q_limbs, mnt6_modulus_q>::non_residue = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x58eefd67fea995ca), BIGINT_LIMB64(0x12f14affbb33a004), BIGINT_LIMB64(0x4780323da44ac69b), BIGINT_LIMB64(0x88acf9bea707eed9), BIGINT_LIMB64(0x0000014bbbb859e8));
+
+/* choice of short Weierstrass curve and its twist */
+
+/* (0, 1, 0) */
+mnt6_Fq3 mnt6_twist = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xc3177aefffbb845c), BIGINT_LIMB64(0x9b80c702f9961788), BIGINT_LIMB64(0xc5df8dcdac70a85a), BIGINT_LIMB64(0x29184098647b5197), BIGINT_LIMB64(0x000001c1223d33c3)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* mnt6_Fq3(mnt6_Fq::zero(), mnt6_Fq::zero(), mnt6_G1::coeff_a) */
+mnt6_Fq3 mnt6_twist_coeff_a = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xb9b2411bfd0eafef), BIGINT_LIMB64(0xc61a10fadd9fecbd), BIGINT_LIMB64(0x89f128e59811f3fb), BIGINT_LIMB64(0x980c0f780adadabb), BIGINT_LIMB64(0x0000009ba1f11320)));
+/* mnt6_Fq3(mnt6_G1::coeff_b * mnt6_Fq3::non_residue, mnt6_Fq::zero(), mnt6_Fq::zero()) */
+mnt6_Fq3 mnt6_twist_coeff_b = mnt6_Fq3(mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x79a4c2cea3c84026), BIGINT_LIMB64(0x4b50cad0f3233baa), BIGINT_LIMB64(0x9ded82770e7a4410), BIGINT_LIMB64(0x5ade8b105838b95d), BIGINT_LIMB64(0x000000e4036e0a3a)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)), mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x0000000000000000)));
+/* mnt6_G1::coeff_a * mnt6_Fq3::non_residue */
+mnt6_Fq mnt6_twist_mul_by_a_c0 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xa07b458bf1496fab), BIGINT_LIMB64(0xde8254e6541f9fb4), BIGINT_LIMB64(0xb1b5cc7bf859c3ea), BIGINT_LIMB64(0xf83c4d58364645a9), BIGINT_LIMB64(0x0000030a29b55fa2));
+/* mnt6_G1::coeff_a * mnt6_Fq3::non_residue */
+mnt6_Fq mnt6_twist_mul_by_a_c1 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xa07b458bf1496fab), BIGINT_LIMB64(0xde8254e6541f9fb4), BIGINT_LIMB64(0xb1b5cc7bf859c3ea), BIGINT_LIMB64(0xf83c4d58364645a9), BIGINT_LIMB64(0x0000030a29b55fa2));
+/* mnt6_G1::coeff_a */
+mnt6_Fq mnt6_twist_mul_by_a_c2 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xb9b2411bfd0eafef), BIGINT_LIMB64(0xc61a10fadd9fecbd), BIGINT_LIMB64(0x89f128e59811f3fb), BIGINT_LIMB64(0x980c0f780adadabb), BIGINT_LIMB64(0x0000009ba1f11320));
+/* mnt6_G1::coeff_b * mnt6_Fq3::non_residue */
+mnt6_Fq mnt6_twist_mul_by_b_c0 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x79a4c2cea3c84026), BIGINT_LIMB64(0x4b50cad0f3233baa), BIGINT_LIMB64(0x9ded82770e7a4410), BIGINT_LIMB64(0x5ade8b105838b95d), BIGINT_LIMB64(0x000000e4036e0a3a));
+/* mnt6_G1::coeff_b * mnt6_Fq3::non_residue */
+mnt6_Fq mnt6_twist_mul_by_b_c1 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x79a4c2cea3c84026), BIGINT_LIMB64(0x4b50cad0f3233baa), BIGINT_LIMB64(0x9ded82770e7a4410), BIGINT_LIMB64(0x5ade8b105838b95d), BIGINT_LIMB64(0x000000e4036e0a3a));
+/* mnt6_G1::coeff_b * mnt6_Fq3::non_residue */
+mnt6_Fq mnt6_twist_mul_by_b_c2 = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0x79a4c2cea3c84026), BIGINT_LIMB64(0x4b50cad0f3233baa), BIGINT_LIMB64(0x9ded82770e7a4410), BIGINT_LIMB64(0x5ade8b105838b95d), BIGINT_LIMB64(0x000000e4036e0a3a));
+/* 4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180 */
+mnt6_Fq mnt6_twist_mul_by_q_X = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xdc13fe3f893c203b), BIGINT_LIMB64(0x39a7226875df158f), BIGINT_LIMB64(0xe34ed98542eefb62), BIGINT_LIMB64(0x6f782a843d139e3c), BIGINT_LIMB64(0x00000177280f6ea9));
+/* 475922286169261325753349249653048451545124878552823515553267735739164647307408490559963136 */
+mnt6_Fq mnt6_twist_mul_by_q_Y = mnt6_Fq(montgomery_limbs, BIGINT_LIMB64(0xf82bb9b400447ba5), BIGINT_LIMB64(0x5fc8850498c7534a), BIGINT_LIMB64(0x050f3b95b083993a), BIGINT_LIMB64(0x794de405433502f7), BIGINT_LIMB64(0x000001fbd57fa0b0));
+
+/* pairing parameters */
+
+/* 689871209842287392837045615510547309923794944 */
+bigint<mnt6_q_limbs> mnt6_ate_loop_count = bigint<mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x0dc9a1b671660000), BIGINT_LIMB64(0x46609756bec2a33f), BIGINT_LIMB64(0x00000000001eef55));
+bool mnt6_ate_is_loop_count_neg = true;
+/* 24416320138090509697890595414313438768353977489862543935904010715439066975957855922532159264213056712140358746422742237328406558352706591021642230618060502855451264045397444793186876199015256781648746888625527075466063075011307800862173764236311342105211681121426931616843635215852236649271569251468773714424208521977615548771268520882870120900360322044218806712027729351845307690474985502587527753847200130592058098363641559341826790559426614919168 */
+bigint<6*mnt6_q_limbs> mnt6_final_exponent = bigint<6*mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x33833bd800000000), BIGINT_LIMB64(0x841dbf82bccefb42), BIGINT_LIMB64(0x91a1c18d55db868e), BIGINT_LIMB64(0x4046ecbdd3b014ff), BIGINT_LIMB64(0x5071b3087765f945), BIGINT_LIMB64(0xdffe17a286c150ef), BIGINT_LIMB64(0xe27e3e90bb29db12), BIGINT_LIMB64(0x3b3b40537720c84f), BIGINT_LIMB64(0xf7d91474b3981d3a), BIGINT_LIMB64(0x42f74c66e7a13921), BIGINT_LIMB64(0x7c2aaa83936d8bc8), BIGINT_LIMB64(0x81813bb668b6fedc), BIGINT_LIMB64(0xac5e87c26c03b1f4), BIGINT_LIMB64(0x54d8c7ce3d5daed1), BIGINT_LIMB64(0x69a7198c17873f7f), BIGINT_LIMB64(0x2f0627f9264724e0), BIGINT_LIMB64(0xff6405359561dd2f), BIGINT_LIMB64(0x0818f2dd5b39038c), BIGINT_LIMB64(0x42575093726d5e36), BIGINT_LIMB64(0x038b1b0b4d7ea28c), BIGINT_LIMB64(0xba7e8f16bb1cb498), BIGINT_LIMB64(0x2cb0ee7cf1d27f98), BIGINT_LIMB64(0x68e10293574745c6), BIGINT_LIMB64(0x000000000002d9f0));
+/* 689871209842287392837045615510547309923794944 */
+bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_abs_of_w0 = bigint<mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x0dc9a1b671660000), BIGINT_LIMB64(0x46609756bec2a33f), BIGINT_LIMB64(0x00000000001eef55));
+bool mnt6_final_exponent_last_chunk_is_w0_neg = true;
+/* 1 */
+bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_w1 = bigint<mnt6_q_limbs>(bigint_limbs, BIGINT_LIMB64(0x0000000000000001));
 
 void init_mnt6_params()
 {
-    typedef bigint<mnt6_r_limbs> bigint_r;
-    typedef bigint<mnt6_q_limbs> bigint_q;
-
-    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4); // Montgomery assumes this
-
-    /* parameters for scalar field Fr */
-    mnt6_modulus_r = bigint_r("475922286169261325753349249653048451545124879242694725395555128576210262817955800483758081");
+    /* all parameters are constant-initialized above; just check that Montgomery arithmetic applies */
+    assert(sizeof(mp_limb_t) == 8 || sizeof(mp_limb_t) == 4);
     assert(mnt6_Fr::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        mnt6_Fr::Rsquared = bigint_r("273000478523237720910981655601160860640083126627235719712980612296263966512828033847775776");
-        mnt6_Fr::Rcubed = bigint_r("427298980065529822574935274648041073124704261331681436071990730954930769758106792920349077");
-        mnt6_Fr::inv = 0xb071a1b67165ffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        mnt6_Fr::Rsquared = bigint_r("273000478523237720910981655601160860640083126627235719712980612296263966512828033847775776");
-        mnt6_Fr::Rcubed = bigint_r("427298980065529822574935274648041073124704261331681436071990730954930769758106792920349077");
-        mnt6_Fr::inv = 0x7165ffff;
-    }
-    mnt6_Fr::num_bits = 298;
-    mnt6_Fr::euler = bigint_r("237961143084630662876674624826524225772562439621347362697777564288105131408977900241879040");
-    mnt6_Fr::s = 17;
-    mnt6_Fr::t = bigint_r("3630998887399759870554727551674258816109656366292531779446068791017229177993437198515");
-    mnt6_Fr::t_minus_1_over_2 = bigint_r("1815499443699879935277363775837129408054828183146265889723034395508614588996718599257");
-    mnt6_Fr::multiplicative_generator = mnt6_Fr("17");
-    mnt6_Fr::root_of_unity = mnt6_Fr("264706250571800080758069302369654305530125675521263976034054878017580902343339784464690243");
-    mnt6_Fr::nqr = mnt6_Fr("17");
-    mnt6_Fr::nqr_to_t = mnt6_Fr("264706250571800080758069302369654305530125675521263976034054878017580902343339784464690243");
-
-    /* parameters for base field Fq */
-    mnt6_modulus_q = bigint_q("475922286169261325753349249653048451545124878552823515553267735739164647307408490559963137");
     assert(mnt6_Fq::modulus_is_valid());
-    if (sizeof(mp_limb_t) == 8)
-    {
-        mnt6_Fq::Rsquared = bigint_q("163983144722506446826715124368972380525894397127205577781234305496325861831001705438796139");
-        mnt6_Fq::Rcubed = bigint_q("207236281459091063710247635236340312578688659363066707916716212805695955118593239854980171");
-        mnt6_Fq::inv = 0xbb4334a3ffffffff;
-    }
-    if (sizeof(mp_limb_t) == 4)
-    {
-        mnt6_Fq::Rsquared = bigint_q("163983144722506446826715124368972380525894397127205577781234305496325861831001705438796139");
-        mnt6_Fq::Rcubed = bigint_q("207236281459091063710247635236340312578688659363066707916716212805695955118593239854980171");
-        mnt6_Fq::inv = 0xffffffff;
-    }
-    mnt6_Fq::num_bits = 298;
-    mnt6_Fq::euler = bigint_q("237961143084630662876674624826524225772562439276411757776633867869582323653704245279981568");
-    mnt6_Fq::s = 34;
-    mnt6_Fq::t = bigint_q("27702323054502562488973446286577291993024111641153199339359284829066871159442729");
-    mnt6_Fq::t_minus_1_over_2 = bigint_q("13851161527251281244486723143288645996512055820576599669679642414533435579721364");
-    mnt6_Fq::multiplicative_generator = mnt6_Fq("10");
-    mnt6_Fq::root_of_unity = mnt6_Fq("120638817826913173458768829485690099845377008030891618010109772937363554409782252579816313");
-    mnt6_Fq::nqr = mnt6_Fq("5");
-    mnt6_Fq::nqr_to_t = mnt6_Fq("406220604243090401056429458730298145937262552508985450684842547562990900634752279902740880");
-
-    /* parameters for twist field Fq3 */
-    mnt6_Fq3::euler = bigint<3*mnt6_q_limbs>("53898680178554951715397245154796036139463891589001478629193136369124915637741423690184935056189295242736833704290747216410090671804540908400210778934462129625646263095398323485795557551284190224166851571615834194321908328559167529729507439069424158411618728014749106176");
-    mnt6_Fq3::s = 34;
-    mnt6_Fq3::t = bigint<3*mnt6_q_limbs>("6274632199033507112809136178669989590936327770934612330653836993631547740397674926811006741620285348354004521888069251599964996777072188956687550402067383940523288107407084140669968625447269322370045302856694231080113482726640944570478452261237446033817102203");
-    mnt6_Fq3::t_minus_1_over_2 = bigint<3*mnt6_q_limbs>("3137316099516753556404568089334994795468163885467306165326918496815773870198837463405503370810142674177002260944034625799982498388536094478343775201033691970261644053703542070334984312723634661185022651428347115540056741363320472285239226130618723016908551101");
-    mnt6_Fq3::non_residue = mnt6_Fq("5");
-    mnt6_Fq3::nqr = mnt6_Fq3(mnt6_Fq("5"),mnt6_Fq("0"),mnt6_Fq("0"));
-    mnt6_Fq3::nqr_to_t = mnt6_Fq3(mnt6_Fq("154361449678783505076984156275977937654331103361174469632346230549735979552469642799720052"),mnt6_Fq("0"),mnt6_Fq("0"));
-    mnt6_Fq3::Frobenius_coeffs_c1[0] = mnt6_Fq("1");
-    mnt6_Fq3::Frobenius_coeffs_c1[1] = mnt6_Fq("471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956");
-    mnt6_Fq3::Frobenius_coeffs_c1[2] = mnt6_Fq("4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180");
-    mnt6_Fq3::Frobenius_coeffs_c2[0] = mnt6_Fq("1");
-    mnt6_Fq3::Frobenius_coeffs_c2[1] = mnt6_Fq("4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180");
-    mnt6_Fq3::Frobenius_coeffs_c2[2] = mnt6_Fq("471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956");
-
-    /* parameters for Fq6 */
-    mnt6_Fq6::non_residue = mnt6_Fq("5");
-    mnt6_Fq6::Frobenius_coeffs_c1[0] = mnt6_Fq("1");
-    mnt6_Fq6::Frobenius_coeffs_c1[1] = mnt6_Fq("471738898967521029133040851318449165997304108729558973770077319830005517129946578866686957");
-    mnt6_Fq6::Frobenius_coeffs_c1[2] = mnt6_Fq("471738898967521029133040851318449165997304108729558973770077319830005517129946578866686956");
-    mnt6_Fq6::Frobenius_coeffs_c1[3] = mnt6_Fq("475922286169261325753349249653048451545124878552823515553267735739164647307408490559963136");
-    mnt6_Fq6::Frobenius_coeffs_c1[4] = mnt6_Fq("4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180");
-    mnt6_Fq6::Frobenius_coeffs_c1[5] = mnt6_Fq("4183387201740296620308398334599285547820769823264541783190415909159130177461911693276181");
-    mnt6_Fq6::my_Fp2::non_residue = mnt6_Fq3::non_residue;
-
-    /* choice of short Weierstrass curve and its twist */
-    mnt6_G1::coeff_a = mnt6_Fq("11");
-    mnt6_G1::coeff_b = mnt6_Fq("106700080510851735677967319632585352256454251201367587890185989362936000262606668469523074");
-    mnt6_twist = mnt6_Fq3(mnt6_Fq::zero(), mnt6_Fq::one(), mnt6_Fq::zero());
-    mnt6_twist_coeff_a = mnt6_Fq3(mnt6_Fq::zero(), mnt6_Fq::zero(),
-                                  mnt6_G1::coeff_a);
-    mnt6_twist_coeff_b = mnt6_Fq3(mnt6_G1::coeff_b * mnt6_Fq3::non_residue,
-                                  mnt6_Fq::zero(), mnt6_Fq::zero());
-    mnt6_G2::twist = mnt6_twist;
-    mnt6_G2::coeff_a = mnt6_twist_coeff_a;
-    mnt6_G2::coeff_b = mnt6_twist_coeff_b;
-    mnt6_twist_mul_by_a_c0 = mnt6_G1::coeff_a * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_a_c1 = mnt6_G1::coeff_a * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_a_c2 = mnt6_G1::coeff_a;
-    mnt6_twist_mul_by_b_c0 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_b_c1 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_b_c2 = mnt6_G1::coeff_b * mnt6_Fq3::non_residue;
-    mnt6_twist_mul_by_q_X = mnt6_Fq("4183387201740296620308398334599285547820769823264541783190415909159130177461911693276180");
-    mnt6_twist_mul_by_q_Y = mnt6_Fq("475922286169261325753349249653048451545124878552823515553267735739164647307408490559963136");
-
-    /* choice of group G1 */
-    mnt6_G1::G1_zero = mnt6_G1(mnt6_Fq::zero(),
-                               mnt6_Fq::one(),
-                               mnt6_Fq::zero());
-    mnt6_G1::G1_one = mnt6_G1(mnt6_Fq("336685752883082228109289846353937104185698209371404178342968838739115829740084426881123453"),
-                              mnt6_Fq("402596290139780989709332707716568920777622032073762749862342374583908837063963736098549800"),
-                              mnt6_Fq::one());
-
-    mnt6_G1::wnaf_window_table.resize(0);
-    mnt6_G1::wnaf_window_table.push_back(11);
-    mnt6_G1::wnaf_window_table.push_back(24);
-    mnt6_G1::wnaf_window_table.push_back(60);
-    mnt6_G1::wnaf_window_table.push_back(127);
-
-    mnt6_G1::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 3.96]
-    mnt6_G1::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [3.96, 9.67]
-    mnt6_G1::fixed_base_exp_window_table.push_back(4);
-    // window 3 is unbeaten in [9.67, 25.13]
-    mnt6_G1::fixed_base_exp_window_table.push_back(10);
-    // window 4 is unbeaten in [25.13, 60.31]
-    mnt6_G1::fixed_base_exp_window_table.push_back(25);
-    // window 5 is unbeaten in [60.31, 146.07]
-    mnt6_G1::fixed_base_exp_window_table.push_back(60);
-    // window 6 is unbeaten in [146.07, 350.09]
-    mnt6_G1::fixed_base_exp_window_table.push_back(146);
-    // window 7 is unbeaten in [350.09, 844.54]
-    mnt6_G1::fixed_base_exp_window_table.push_back(350);
-    // window 8 is unbeaten in [844.54, 1839.64]
-    mnt6_G1::fixed_base_exp_window_table.push_back(845);
-    // window 9 is unbeaten in [1839.64, 3904.26]
-    mnt6_G1::fixed_base_exp_window_table.push_back(1840);
-    // window 10 is unbeaten in [3904.26, 11309.42]
-    mnt6_G1::fixed_base_exp_window_table.push_back(3904);
-    // window 11 is unbeaten in [11309.42, 24015.57]
-    mnt6_G1::fixed_base_exp_window_table.push_back(11309);
-    // window 12 is unbeaten in [24015.57, 72288.57]
-    mnt6_G1::fixed_base_exp_window_table.push_back(24016);
-    // window 13 is unbeaten in [72288.57, 138413.22]
-    mnt6_G1::fixed_base_exp_window_table.push_back(72289);
-    // window 14 is unbeaten in [138413.22, 156390.30]
-    mnt6_G1::fixed_base_exp_window_table.push_back(138413);
-    // window 15 is unbeaten in [156390.30, 562560.50]
-    mnt6_G1::fixed_base_exp_window_table.push_back(156390);
-    // window 16 is unbeaten in [562560.50, 1036742.02]
-    mnt6_G1::fixed_base_exp_window_table.push_back(562560);
-    // window 17 is unbeaten in [1036742.02, 2053818.86]
-    mnt6_G1::fixed_base_exp_window_table.push_back(1036742);
-    // window 18 is unbeaten in [2053818.86, 4370223.95]
-    mnt6_G1::fixed_base_exp_window_table.push_back(2053819);
-    // window 19 is unbeaten in [4370223.95, 8215703.81]
-    mnt6_G1::fixed_base_exp_window_table.push_back(4370224);
-    // window 20 is unbeaten in [8215703.81, 42682375.43]
-    mnt6_G1::fixed_base_exp_window_table.push_back(8215704);
-    // window 21 is never the best
-    mnt6_G1::fixed_base_exp_window_table.push_back(0);
-    // window 22 is unbeaten in [42682375.43, inf]
-    mnt6_G1::fixed_base_exp_window_table.push_back(42682375);
-
-    /* choice of group G2 */
-    mnt6_G2::G2_zero = mnt6_G2(mnt6_Fq3::zero(),
-                               mnt6_Fq3::one(),
-                               mnt6_Fq3::zero());
-    mnt6_G2::G2_one = mnt6_G2(mnt6_Fq3(mnt6_Fq("421456435772811846256826561593908322288509115489119907560382401870203318738334702321297427"),
-                                       mnt6_Fq("103072927438548502463527009961344915021167584706439945404959058962657261178393635706405114"),
-                                       mnt6_Fq("143029172143731852627002926324735183809768363301149009204849580478324784395590388826052558")),
-                              mnt6_Fq3(mnt6_Fq("464673596668689463130099227575639512541218133445388869383893594087634649237515554342751377"),
-                                       mnt6_Fq("100642907501977375184575075967118071807821117960152743335603284583254620685343989304941678"),
-                                       mnt6_Fq("123019855502969896026940545715841181300275180157288044663051565390506010149881373807142903")),
-                              mnt6_Fq3::one());
-
-    mnt6_G2::wnaf_window_table.resize(0);
-    mnt6_G2::wnaf_window_table.push_back(5);
-    mnt6_G2::wnaf_window_table.push_back(15);
-    mnt6_G2::wnaf_window_table.push_back(39);
-    mnt6_G2::wnaf_window_table.push_back(109);
-
-    mnt6_G2::fixed_base_exp_window_table.resize(0);
-    // window 1 is unbeaten in [-inf, 4.25]
-    mnt6_G2::fixed_base_exp_window_table.push_back(1);
-    // window 2 is unbeaten in [4.25, 10.22]
-    mnt6_G2::fixed_base_exp_window_table.push_back(4);
-    // window 3 is unbeaten in [10.22, 24.85]
-    mnt6_G2::fixed_base_exp_window_table.push_back(10);
-    // window 4 is unbeaten in [24.85, 60.06]
-    mnt6_G2::fixed_base_exp_window_table.push_back(25);
-    // window 5 is unbeaten in [60.06, 143.61]
-    mnt6_G2::fixed_base_exp_window_table.push_back(60);
-    // window 6 is unbeaten in [143.61, 345.66]
-    mnt6_G2::fixed_base_exp_window_table.push_back(144);
-    // window 7 is unbeaten in [345.66, 818.56]
-    mnt6_G2::fixed_base_exp_window_table.push_back(346);
-    // window 8 is unbeaten in [818.56, 1782.06]
-    mnt6_G2::fixed_base_exp_window_table.push_back(819);
-    // window 9 is unbeaten in [1782.06, 4002.45]
-    mnt6_G2::fixed_base_exp_window_table.push_back(1782);
-    // window 10 is unbeaten in [4002.45, 10870.18]
-    mnt6_G2::fixed_base_exp_window_table.push_back(4002);
-    // window 11 is unbeaten in [10870.18, 18022.51]
-    mnt6_G2::fixed_base_exp_window_table.push_back(10870);
-    // window 12 is unbeaten in [18022.51, 43160.74]
-    mnt6_G2::fixed_base_exp_window_table.push_back(18023);
-    // window 13 is unbeaten in [43160.74, 149743.32]
-    mnt6_G2::fixed_base_exp_window_table.push_back(43161);
-    // window 14 is never the best
-    mnt6_G2::fixed_base_exp_window_table.push_back(0);
-    // window 15 is unbeaten in [149743.32, 551844.13]
-    mnt6_G2::fixed_base_exp_window_table.push_back(149743);
-    // window 16 is unbeaten in [551844.13, 1041827.91]
-    mnt6_G2::fixed_base_exp_window_table.push_back(551844);
-    // window 17 is unbeaten in [1041827.91, 1977371.53]
-    mnt6_G2::fixed_base_exp_window_table.push_back(1041828);
-    // window 18 is unbeaten in [1977371.53, 3703619.51]
-    mnt6_G2::fixed_base_exp_window_table.push_back(1977372);
-    // window 19 is unbeaten in [3703619.51, 7057236.87]
-    mnt6_G2::fixed_base_exp_window_table.push_back(3703620);
-    // window 20 is unbeaten in [7057236.87, 38554491.67]
-    mnt6_G2::fixed_base_exp_window_table.push_back(7057237);
-    // window 21 is never the best
-    mnt6_G2::fixed_base_exp_window_table.push_back(0);
-    // window 22 is unbeaten in [38554491.67, inf]
-    mnt6_G2::fixed_base_exp_window_table.push_back(38554492);
-
-    /* pairing parameters */
-    mnt6_ate_loop_count = bigint_q("689871209842287392837045615510547309923794944");
-    mnt6_ate_is_loop_count_neg = true;
-    mnt6_final_exponent = bigint<6*mnt6_q_limbs>("24416320138090509697890595414313438768353977489862543935904010715439066975957855922532159264213056712140358746422742237328406558352706591021642230618060502855451264045397444793186876199015256781648746888625527075466063075011307800862173764236311342105211681121426931616843635215852236649271569251468773714424208521977615548771268520882870120900360322044218806712027729351845307690474985502587527753847200130592058098363641559341826790559426614919168");
-    mnt6_final_exponent_last_chunk_abs_of_w0 = bigint_q("689871209842287392837045615510547309923794944");
-    mnt6_final_exponent_last_chunk_is_w0_neg = true;
-    mnt6_final_exponent_last_chunk_w1 = bigint_q("1");
 }
 
 } // libsnark
@@ -59,6 +59,25 @@ extern bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_abs_of_w0;
 extern bool mnt6_final_exponent_last_chunk_is_w0_neg;
 extern bigint<mnt6_q_limbs> mnt6_final_exponent_last_chunk_w1;
 
+/*
+ * The parameters of the fields above are constant-initialized: those of
+ * mnt6_Fr and mnt6_Fq in mnt46_common.cpp, those of Fq3 and Fq6 in mnt6_init.cpp
+ * (as are all other parameters of the curve). They can thus be used without
+ * calling init_mnt6_params() first.
+ */
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::euler;
+template<> size_t mnt6_Fq3::s;
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::t;
+template<> bigint<3*mnt6_q_limbs> mnt6_Fq3::t_minus_1_over_2;
+template<> mnt6_Fq mnt6_Fq3::non_residue;
+template<> mnt6_Fq3 mnt6_Fq3::nqr;
+template<> mnt6_Fq3 mnt6_Fq3::nqr_to_t;
+template<> mnt6_Fq mnt6_Fq3::Frobenius_coeffs_c1[3];
+template<> mnt6_Fq mnt6_Fq3::Frobenius_coeffs_c2[3];
+template<> mnt6_Fq mnt6_Fq6::non_residue;
+template<> mnt6_Fq mnt6_Fq6::Frobenius_coeffs_c1[6];
+template<> mnt6_Fq Fp2_model<mnt6_q_limbs, mnt6_modulus_q>::non_residue;
+
 void init_mnt6_params();
 
 class mnt6_G1;
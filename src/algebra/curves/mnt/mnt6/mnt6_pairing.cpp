@@ -17,6 +17,7 @@
 #include "algebra/curves/mnt/mnt6/mnt6_init.hpp"
 #include "algebra/curves/mnt/mnt6/mnt6_g1.hpp"
 #include "algebra/curves/mnt/mnt6/mnt6_g2.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/wnaf.hpp"
 #include "common/profiling.hpp"
 
@@ -550,11 +551,10 @@ mnt6_ate_G2_precomp mnt6_ate_precompute_G2(const mnt6_G2& Q)
     return result;
 }
 
-mnt6_Fq6 mnt6_ate_miller_loop(const mnt6_ate_G1_precomp &prec_P,
-                              const mnt6_ate_G2_precomp &prec_Q)
+/* the Miller loop, up to the inversion that a negative loop count requires */
+static mnt6_Fq6 mnt6_ate_miller_loop_uninverted(const mnt6_ate_G1_precomp &prec_P,
+                                               const mnt6_ate_G2_precomp &prec_Q)
 {
-    enter_block("Call to mnt6_ate_miller_loop");
-
     mnt6_Fq3 L1_coeff = mnt6_Fq3(prec_P.PX, mnt6_Fq::zero(), mnt6_Fq::zero()) - prec_Q.QX_over_twist;
 
     mnt6_Fq6 f = mnt6_Fq6::one();
@@ -600,7 +600,21 @@ mnt6_Fq6 mnt6_ate_miller_loop(const mnt6_ate_G1_precomp &prec_P,
     	mnt6_ate_add_coeffs ac = prec_Q.add_coeffs[add_idx++];
     	mnt6_Fq6 g_RnegR_at_P = mnt6_Fq6(ac.c_RZ * prec_P.PY_twist,
                                          -(prec_Q.QY_over_twist * ac.c_RZ + L1_coeff * ac.c_L1));
-    	f = (f * g_RnegR_at_P).inverse();
+    	f = f * g_RnegR_at_P;
+    }
+
+    return f;
+}
+
+mnt6_Fq6 mnt6_ate_miller_loop(const mnt6_ate_G1_precomp &prec_P,
+                              const mnt6_ate_G2_precomp &prec_Q)
+{
+    enter_block("Call to mnt6_ate_miller_loop");
+
+    mnt6_Fq6 f = mnt6_ate_miller_loop_uninverted(prec_P, prec_Q);
+    if (mnt6_ate_is_loop_count_neg)
+    {
+        f = f.inverse();
     }
 
     leave_block("Call to mnt6_ate_miller_loop");
@@ -685,6 +699,32 @@ mnt6_Fq6 mnt6_ate_double_miller_loop(const mnt6_ate_G1_precomp &prec_P1,
     return f;
 }
 
+std::vector<mnt6_Fq6> mnt6_ate_batch_miller_loop(const std::vector<mnt6_ate_G1_precomp> &prec_P,
+                                                 const std::vector<mnt6_ate_G2_precomp> &prec_Q)
+{
+    enter_block("Call to mnt6_ate_batch_miller_loop");
+    assert(prec_P.size() == prec_Q.size());
+
+    std::vector<mnt6_Fq6> f(prec_P.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < f.size(); ++j)
+    {
+        f[j] = mnt6_ate_miller_loop_uninverted(prec_P[j], prec_Q[j]);
+    }
+
+    if (mnt6_ate_is_loop_count_neg)
+    {
+        /* one inversion for all pairs */
+        batch_invert(f);
+    }
+
+    leave_block("Call to mnt6_ate_batch_miller_loop");
+
+    return f;
+}
+
 mnt6_Fq6 mnt6_ate_pairing(const mnt6_G1& P, const mnt6_G2 &Q)
 {
     enter_block("Call to mnt6_ate_pairing");
@@ -728,6 +768,12 @@ mnt6_Fq6 mnt6_double_miller_loop(const mnt6_G1_precomp &prec_P1,
     return mnt6_ate_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<mnt6_Fq6> mnt6_batch_miller_loop(const std::vector<mnt6_G1_precomp> &prec_P,
+                                             const std::vector<mnt6_G2_precomp> &prec_Q)
+{
+    return mnt6_ate_batch_miller_loop(prec_P, prec_Q);
+}
+
 mnt6_Fq6 mnt6_pairing(const mnt6_G1& P,
                       const mnt6_G2 &Q)
 {
@@ -112,6 +112,10 @@ mnt6_Fq6 mnt6_ate_double_miller_loop(const mnt6_ate_G1_precomp &prec_P1,
                                      const mnt6_ate_G1_precomp &prec_P2,
                                      const mnt6_ate_G2_precomp &prec_Q2);
 
+/* Miller loops of the independent pairs (prec_P[i], prec_Q[i]) */
+std::vector<mnt6_Fq6> mnt6_ate_batch_miller_loop(const std::vector<mnt6_ate_G1_precomp> &prec_P,
+                                                 const std::vector<mnt6_ate_G2_precomp> &prec_Q);
+
 mnt6_Fq6 mnt6_ate_pairing(const mnt6_G1& P,
                           const mnt6_G2 &Q);
 mnt6_GT mnt6_ate_reduced_pairing(const mnt6_G1 &P,
@@ -134,6 +138,9 @@ mnt6_Fq6 mnt6_double_miller_loop(const mnt6_G1_precomp &prec_P1,
                                  const mnt6_G1_precomp &prec_P2,
                                  const mnt6_G2_precomp &prec_Q2);
 
+std::vector<mnt6_Fq6> mnt6_batch_miller_loop(const std::vector<mnt6_G1_precomp> &prec_P,
+                                             const std::vector<mnt6_G2_precomp> &prec_Q);
+
 mnt6_Fq6 mnt6_pairing(const mnt6_G1& P,
                       const mnt6_G2 &Q);
 
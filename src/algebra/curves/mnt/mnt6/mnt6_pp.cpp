@@ -35,6 +35,11 @@ mnt6_G2_precomp mnt6_pp::precompute_G2(const mnt6_G2 &Q)
     return mnt6_precompute_G2(Q);
 }
 
+mnt6_G2_precomp mnt6_pp::precompute_G2_for_reuse(const mnt6_G2 &Q)
+{
+    return mnt6_pp::precompute_G2(Q);
+}
+
 
 mnt6_Fq6 mnt6_pp::miller_loop(const mnt6_G1_precomp &prec_P,
                               const mnt6_G2_precomp &prec_Q)
@@ -66,6 +71,12 @@ mnt6_Fq6 mnt6_pp::double_miller_loop(const mnt6_G1_precomp &prec_P1,
     return mnt6_double_miller_loop(prec_P1, prec_Q1, prec_P2, prec_Q2);
 }
 
+std::vector<mnt6_Fq6> mnt6_pp::batch_miller_loop(const std::vector<mnt6_G1_precomp> &prec_P,
+                                                 const std::vector<mnt6_G2_precomp> &prec_Q)
+{
+    return mnt6_batch_miller_loop(prec_P, prec_Q);
+}
+
 mnt6_Fq6 mnt6_pp::affine_ate_e_over_e_miller_loop(const mnt6_affine_ate_G1_precomputation &prec_P1,
                                                   const mnt6_affine_ate_G2_precomputation &prec_Q1,
                                                   const mnt6_affine_ate_G1_precomputation &prec_P2,
@@ -40,6 +40,7 @@ public:
     static mnt6_GT final_exponentiation(const mnt6_Fq6 &elt);
     static mnt6_G1_precomp precompute_G1(const mnt6_G1 &P);
     static mnt6_G2_precomp precompute_G2(const mnt6_G2 &Q);
+    static mnt6_G2_precomp precompute_G2_for_reuse(const mnt6_G2 &Q);
     static mnt6_Fq6 miller_loop(const mnt6_G1_precomp &prec_P,
                                 const mnt6_G2_precomp &prec_Q);
     static mnt6_affine_ate_G1_precomputation affine_ate_precompute_G1(const mnt6_G1 &P);
@@ -60,6 +61,8 @@ public:
                                        const mnt6_G2_precomp &prec_Q1,
                                        const mnt6_G1_precomp &prec_P2,
                                        const mnt6_G2_precomp &prec_Q2);
+    static std::vector<mnt6_Fq6> batch_miller_loop(const std::vector<mnt6_G1_precomp> &prec_P,
+                                                   const std::vector<mnt6_G2_precomp> &prec_Q);
 
     /* the following are used in test files */
     static mnt6_Fq6 pairing(const mnt6_G1 &P,
@@ -0,0 +1,114 @@
+/** @file
+ *****************************************************************************
+
+ Compares G1 of the edwards curve in inverted coordinates (edwards_G1) and in
+ extended coordinates (edwards_G1_extended): the cost of additions, mixed
+ additions and doublings, and the time of multi-exponentiations.
+
+ Field operation counts are only collected when built with
+ PROFILE_OP_COUNTS=1.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+#include "algebra/curves/edwards/edwards_pp.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
+#include "common/profiling.hpp"
+
+using namespace libsnark;
+
+template<typename GroupT>
+void profile_group_ops(const std::string &name, const size_t reps)
+{
+    GroupT P = GroupT::random_element();
+    GroupT Q = GroupT::random_element();
+    GroupT Q_special = Q;
+    Q_special.to_special();
+
+    const std::string ops[] = { "add", "mixed_add", "dbl" };
+    for (const std::string &op : ops)
+    {
+#ifdef PROFILE_OP_COUNTS
+        const long long mul_before = edwards_Fq::mul_cnt;
+        const long long sqr_before = edwards_Fq::sqr_cnt;
+#endif
+        const long long time_before = get_nsec_time();
+        for (size_t i = 0; i < reps; ++i)
+        {
+            if (op == "add")
+            {
+                P = P.add(Q);
+            }
+            else if (op == "mixed_add")
+            {
+                P = P.mixed_add(Q_special);
+            }
+            else
+            {
+                P = P.dbl();
+            }
+        }
+        const long long time_after = get_nsec_time();
+
+        printf("%-20s %-10s: %8.3f us", name.c_str(), op.c_str(), (time_after - time_before) * 1e-3 / reps);
+#ifdef PROFILE_OP_COUNTS
+        printf(", %5.2f M + %5.2f S",
+               1. * (edwards_Fq::mul_cnt - mul_before) / reps,
+               1. * (edwards_Fq::sqr_cnt - sqr_before) / reps);
+#endif
+        printf("\n");
+    }
+    assert(P.is_well_formed());
+}
+
+template<typename GroupT>
+GroupT profile_multi_exp(const std::string &name,
+                         const std::vector<GroupT> &bases,
+                         const std::vector<edwards_Fr> &scalars)
+{
+    const long long time_before = get_nsec_time();
+    const GroupT result = multi_exp<GroupT, edwards_Fr>(bases.begin(), bases.end(),
+                                                        scalars.begin(), scalars.end(),
+                                                        1, true);
+    const long long time_after = get_nsec_time();
+
+    printf("%-20s multi_exp of size %7zu: %10.3f ms\n", name.c_str(), bases.size(), (time_after - time_before) * 1e-6);
+    return result;
+}
+
+int main(void)
+{
+    start_profiling();
+    inhibit_profiling_info = true;
+    edwards_pp::init_public_params();
+
+    profile_group_ops<edwards_G1>("edwards_G1", 100000);
+    profile_group_ops<edwards_G1_extended>("edwards_G1_extended", 100000);
+
+#ifdef EDWARDS_EXTENDED_COORDINATES
+    printf("(built with EDWARDS_EXTENDED_COORDINATES: multi_exp on edwards_G1 also runs in extended coordinates)\n");
+#endif
+    for (size_t n = 1000; n <= 100000; n *= 10)
+    {
+        std::vector<edwards_G1> bases;
+        std::vector<edwards_G1_extended> ext_bases;
+        std::vector<edwards_Fr> scalars;
+        for (size_t i = 0; i < n; ++i)
+        {
+            bases.emplace_back(edwards_G1::random_element());
+            ext_bases.emplace_back(edwards_G1_extended(bases.back()));
+            scalars.emplace_back(edwards_Fr::random_element());
+        }
+
+        const edwards_G1 result = profile_multi_exp<edwards_G1>("edwards_G1", bases, scalars);
+        const edwards_G1_extended ext_result = profile_multi_exp<edwards_G1_extended>("edwards_G1_extended", ext_bases, scalars);
+        assert(ext_result.to_edwards_G1() == result);
+    }
+}
@@ -35,6 +35,10 @@ namespace libsnark {
 
   G1_precomp<EC_ppT> precompute_G1(const G1<EC_ppT> &P);
   G2_precomp<EC_ppT> precompute_G2(const G2<EC_ppT> &Q);
+  G2_precomp<EC_ppT> precompute_G2_for_reuse(const G2<EC_ppT> &Q);
+
+  (the latter is for elements used in many Miller loops, e.g. those of a
+  verification key; it may precompute more to make each Miller loop faster)
 
   Fqk<EC_ppT> miller_loop(const G1_precomp<EC_ppT> &prec_P,
                           const G2_precomp<EC_ppT> &prec_Q);
@@ -59,6 +63,12 @@ namespace libsnark {
                                  const G2_precomp<EC_ppT> &prec_Q1,
                                  const G1_precomp<EC_ppT> &prec_P2,
                                  const G2_precomp<EC_ppT> &prec_Q2);
+  std::vector<Fqk<EC_ppT> > batch_miller_loop(const std::vector<G1_precomp<EC_ppT> > &prec_P,
+                                              const std::vector<G2_precomp<EC_ppT> > &prec_Q);
+
+  (the latter returns the Miller loops of the independent pairs
+  (prec_P[i], prec_Q[i]); the pairs may be evaluated in parallel, and
+  per-pair work such as a final inversion may be shared between them)
 
   Fqk<EC_ppT> pairing(const G1<EC_ppT> &P,
                       const G2<EC_ppT> &Q);
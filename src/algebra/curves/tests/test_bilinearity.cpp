@@ -4,12 +4,15 @@
  *             and contributors (see AUTHORS).
  * @copyright  MIT license (see LICENSE file)
  *****************************************************************************/
+#include <sstream>
+
 #include "common/profiling.hpp"
 #include "algebra/curves/edwards/edwards_pp.hpp"
 #include "algebra/curves/bn128/bn128_pp.hpp"
 #include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
 #include "algebra/curves/mnt/mnt4/mnt4_pp.hpp"
 #include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
 
 using namespace libsnark;
 
@@ -71,6 +74,27 @@ void double_miller_loop_test()
     assert(ans_1 * ans_2 == ans_12);
 }
 
+template<typename ppT>
+void batch_miller_loop_test()
+{
+    const size_t n = 5;
+    std::vector<G1_precomp<ppT> > prec_P;
+    std::vector<G2_precomp<ppT> > prec_Q;
+    for (size_t i = 0; i < n; ++i)
+    {
+        prec_P.emplace_back(ppT::precompute_G1((Fr<ppT>::random_element()) * G1<ppT>::one()));
+        prec_Q.emplace_back(ppT::precompute_G2((Fr<ppT>::random_element()) * G2<ppT>::one()));
+    }
+
+    const std::vector<Fqk<ppT> > ans = ppT::batch_miller_loop(prec_P, prec_Q);
+    assert(ans.size() == n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        assert(ans[i] == ppT::miller_loop(prec_P[i], prec_Q[i]));
+    }
+    assert(ppT::batch_miller_loop(std::vector<G1_precomp<ppT> >(), std::vector<G2_precomp<ppT> >()).empty());
+}
+
 template<typename ppT>
 void affine_pairing_test()
 {
@@ -105,28 +129,91 @@ void affine_pairing_test()
     printf("\n\n");
 }
 
+void alt_bn128_affine_lines_test()
+{
+    const alt_bn128_G1 P = (alt_bn128_Fr::random_element()) * alt_bn128_G1::one();
+    const alt_bn128_G2 Q = (alt_bn128_Fr::random_element()) * alt_bn128_G2::one();
+
+    const alt_bn128_ate_G1_precomp prec_P = alt_bn128_ate_precompute_G1(P);
+    const alt_bn128_ate_G2_precomp prec_Q = alt_bn128_ate_precompute_G2(Q);
+    const alt_bn128_ate_G2_precomp prec_Q_affine = alt_bn128_ate_precompute_G2(Q, true);
+    assert(prec_Q.num_lines() == prec_Q_affine.num_lines());
+    assert(3 * prec_Q_affine.ell_coeffs.size() == 2 * prec_Q.ell_coeffs.size());
+
+    /* affine lines differ from projective ones by factors in Fq2, which the final exponentiation removes */
+    const alt_bn128_GT ans = alt_bn128_final_exponentiation(alt_bn128_ate_miller_loop(prec_P, prec_Q));
+    const alt_bn128_GT ans_affine = alt_bn128_final_exponentiation(alt_bn128_ate_miller_loop(prec_P, prec_Q_affine));
+    const alt_bn128_GT ans_mixed = alt_bn128_final_exponentiation(alt_bn128_ate_double_miller_loop(prec_P, prec_Q, prec_P, prec_Q_affine));
+    assert(ans == ans_affine);
+    assert(ans_mixed == ans * ans);
+
+    std::stringstream ss;
+    ss << prec_Q_affine;
+    alt_bn128_ate_G2_precomp prec_Q_affine2;
+    ss >> prec_Q_affine2;
+    assert(prec_Q_affine == prec_Q_affine2);
+}
+
+template<typename ppT>
+void gt_multi_exp_test()
+{
+    const size_t n = 10;
+    std::vector<GT<ppT> > bases;
+    std::vector<Fr<ppT> > scalars;
+    GT<ppT> expected = GT<ppT>::one();
+    for (size_t i = 0; i < n; ++i)
+    {
+        bases.emplace_back(ppT::reduced_pairing(G1<ppT>::random_element(), G2<ppT>::random_element()));
+        scalars.emplace_back(i == n/2 ? Fr<ppT>::zero() : Fr<ppT>::random_element());
+        expected = expected * (bases[i]^scalars[i]);
+    }
+
+    const GT<ppT> result = cyclotomic_multi_exp<GT<ppT>, Fr<ppT> >(bases.begin(), bases.end(), scalars.begin(), scalars.end());
+    assert(result == expected);
+
+    const GT<ppT> empty_result = cyclotomic_multi_exp<GT<ppT>, Fr<ppT> >(bases.begin(), bases.begin(), scalars.begin(), scalars.begin());
+    assert(empty_result == GT<ppT>::one());
+
+    const GT<ppT> single_result = cyclotomic_multi_exp<GT<ppT>, Fr<ppT> >(bases.begin(), bases.begin() + 1, scalars.begin(), scalars.begin() + 1);
+    assert(single_result == (bases[0]^scalars[0]));
+
+    const GT<ppT> zero_result = cyclotomic_multi_exp<GT<ppT>, Fr<ppT> >(bases.begin(), bases.begin() + 1, scalars.begin() + n/2, scalars.begin() + n/2 + 1);
+    assert(zero_result == GT<ppT>::one());
+}
+
 int main(void)
 {
     start_profiling();
     edwards_pp::init_public_params();
     pairing_test<edwards_pp>();
     double_miller_loop_test<edwards_pp>();
+    batch_miller_loop_test<edwards_pp>();
+    gt_multi_exp_test<edwards_pp>();
 
     mnt6_pp::init_public_params();
     pairing_test<mnt6_pp>();
     double_miller_loop_test<mnt6_pp>();
+    batch_miller_loop_test<mnt6_pp>();
+    gt_multi_exp_test<mnt6_pp>();
     affine_pairing_test<mnt6_pp>();
 
     mnt4_pp::init_public_params();
     pairing_test<mnt4_pp>();
     double_miller_loop_test<mnt4_pp>();
+    batch_miller_loop_test<mnt4_pp>();
+    gt_multi_exp_test<mnt4_pp>();
     affine_pairing_test<mnt4_pp>();
 
     alt_bn128_pp::init_public_params();
     pairing_test<alt_bn128_pp>();
     double_miller_loop_test<alt_bn128_pp>();
+    batch_miller_loop_test<alt_bn128_pp>();
+    gt_multi_exp_test<alt_bn128_pp>();
+    alt_bn128_affine_lines_test();
 
     bn128_pp::init_public_params();
     pairing_test<bn128_pp>();
     double_miller_loop_test<bn128_pp>();
+    batch_miller_loop_test<bn128_pp>();
+    gt_multi_exp_test<bn128_pp>();
 }
@@ -0,0 +1,55 @@
+/**
+ *****************************************************************************
+ Test program for the EDWARDS_EXTENDED_COORDINATES configuration, in which
+ multi_exp<edwards_G1, edwards_Fr> runs in extended coordinates. The Makefile
+ compiles this program and edwards_g1_extended.cpp with the flag, whether or
+ not the rest of the library is.
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef EDWARDS_EXTENDED_COORDINATES
+#error "test_edwards_extended_coordinates must be compiled with EDWARDS_EXTENDED_COORDINATES"
+#endif
+
+#include <cassert>
+#include <cstdio>
+
+#include "common/profiling.hpp"
+#include "algebra/curves/edwards/edwards_pp.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
+
+using namespace libsnark;
+
+void test_multi_exp(const size_t n, const bool use_multiexp)
+{
+    std::vector<edwards_G1> bases;
+    std::vector<edwards_Fr> scalars;
+    edwards_G1 expected = edwards_G1::zero();
+    for (size_t i = 0; i < n; ++i)
+    {
+        bases.emplace_back(i % 3 == 0 ? edwards_G1::zero() : edwards_G1::random_element());
+        scalars.emplace_back(i % 5 == 0 ? edwards_Fr::zero() : edwards_Fr::random_element());
+        expected = expected + scalars[i] * bases[i];
+    }
+
+    for (const size_t chunks : { 1, 3 })
+    {
+        const edwards_G1 result = multi_exp<edwards_G1, edwards_Fr>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), chunks, use_multiexp);
+        assert(result == expected);
+    }
+}
+
+int main(void)
+{
+    start_profiling();
+    edwards_pp::init_public_params();
+
+    test_multi_exp(0, true);
+    test_multi_exp(1, true);
+    test_multi_exp(100, true);
+    test_multi_exp(100, false);
+
+    printf("All extended coordinates tests passed\n");
+}
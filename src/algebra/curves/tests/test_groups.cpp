@@ -10,6 +10,7 @@
 #include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
 #include "algebra/curves/bn128/bn128_pp.hpp"
 #include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
 #include <sstream>
 
 using namespace libsnark;
@@ -116,6 +117,34 @@ void test_mul_by_q()
     assert((GroupT::base_field_char()*a) == a.mul_by_q());
 }
 
+template<typename GroupT>
+void test_subgroup_check()
+{
+    std::vector<GroupT> v = { GroupT::zero(), GroupT::one(), GroupT::random_element() };
+    assert(is_in_subgroup<GroupT>(v.back()));
+    assert(batch_is_valid<GroupT>(v));
+}
+
+template<typename GroupT, typename FieldT>
+void test_subgroup_check_on_twist(const FieldT &coeff_a, const FieldT &coeff_b)
+{
+    test_subgroup_check<GroupT>();
+
+    // a random point of y^2 = x^3 + a*x + b lies (with overwhelming probability) outside the subgroup
+    FieldT x, y;
+    do
+    {
+        x = FieldT::random_element();
+        const FieldT y2 = x.squared() * x + coeff_a * x + coeff_b;
+        y = y2.sqrt();
+    } while (y.squared() != x.squared() * x + coeff_a * x + coeff_b);
+
+    const GroupT P(x, y, FieldT::one());
+    assert(P.is_well_formed());
+    assert(!is_in_subgroup<GroupT>(P));
+    assert(!batch_is_valid<GroupT>({ GroupT::one(), P }));
+}
+
 template<typename GroupT>
 void test_output()
 {
@@ -133,6 +162,98 @@ void test_output()
     }
 }
 
+template<typename GroupT>
+void test_multi_exp_with_small_scalars()
+{
+    typedef typename GroupT::scalar_field FieldT;
+
+    std::vector<GroupT> bases;
+    std::vector<FieldT> scalars;
+    GroupT expected = GroupT::zero();
+    for (size_t i = 0; i < 200; ++i)
+    {
+        bases.emplace_back(GroupT::random_element());
+        const size_t kind = i % 4;
+        scalars.emplace_back(kind == 0 ? FieldT::zero() :
+                             kind == 1 ? FieldT::one() :
+                             kind == 2 ? FieldT(std::rand() % (1 << 16)) :
+                             FieldT::random_element());
+        expected = expected + scalars.back() * bases.back();
+    }
+    batch_to_special<GroupT>(bases);
+
+    for (size_t chunks = 1; chunks <= 3; ++chunks)
+    {
+        const GroupT result = multi_exp_with_mixed_addition<GroupT, FieldT>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), chunks, true);
+        assert(result == expected);
+    }
+}
+
+template<typename GroupT>
+void test_multi_exp_multi_scalar()
+{
+    typedef typename GroupT::scalar_field FieldT;
+
+    const size_t num_bases = 100, num_vectors = 3;
+    std::vector<GroupT> bases;
+    for (size_t i = 0; i < num_bases; ++i)
+    {
+        bases.emplace_back(GroupT::random_element());
+    }
+    batch_to_special<GroupT>(bases);
+
+    std::vector<std::vector<FieldT> > scalars(num_vectors);
+    std::vector<typename std::vector<FieldT>::const_iterator> scalar_starts;
+    for (size_t k = 0; k < num_vectors; ++k)
+    {
+        for (size_t i = 0; i < num_bases; ++i)
+        {
+            scalars[k].emplace_back(i % 5 == k ? FieldT::zero() : FieldT::random_element());
+        }
+        scalar_starts.emplace_back(scalars[k].begin());
+    }
+
+    for (size_t chunks = 1; chunks <= 3; ++chunks)
+    {
+        const std::vector<GroupT> results = multi_exp_multi_scalar<GroupT, FieldT>(bases.begin(), bases.end(), scalar_starts, chunks);
+        assert(results.size() == num_vectors);
+        for (size_t k = 0; k < num_vectors; ++k)
+        {
+            const GroupT expected = multi_exp<GroupT, FieldT>(bases.begin(), bases.end(), scalars[k].begin(), scalars[k].end(), 1, true);
+            assert(results[k] == expected);
+        }
+    }
+}
+
+void test_edwards_G1_extended()
+{
+    assert(edwards_G1_extended(edwards_G1::zero()).is_zero());
+    assert(edwards_G1_extended(edwards_G1::one()) == edwards_G1_extended::one());
+    assert(edwards_G1_extended::zero().to_edwards_G1() == edwards_G1::zero());
+    assert(edwards_G1_extended::one().to_edwards_G1() == edwards_G1::one());
+
+    std::vector<edwards_G1> bases;
+    std::vector<edwards_G1_extended> ext_bases;
+    std::vector<edwards_Fr> scalars;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        bases.emplace_back(edwards_G1::random_element());
+        ext_bases.emplace_back(edwards_G1_extended(bases.back()));
+        scalars.emplace_back(edwards_Fr::random_element());
+        assert(ext_bases.back().is_well_formed());
+        assert(ext_bases.back().to_edwards_G1() == bases.back());
+        if (i > 0)
+        {
+            assert(edwards_G1_extended(bases[i] + bases[i-1]) == ext_bases[i] + ext_bases[i-1]);
+            assert(edwards_G1_extended(bases[i].dbl()) == ext_bases[i].dbl());
+        }
+    }
+
+    const edwards_G1 result = multi_exp<edwards_G1, edwards_Fr>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), 1, true);
+    const edwards_G1_extended ext_result = multi_exp<edwards_G1_extended, edwards_Fr>(ext_bases.begin(), ext_bases.end(), scalars.begin(), scalars.end(), 1, true);
+    assert(ext_result.to_edwards_G1() == result);
+}
+
 int main(void)
 {
     edwards_pp::init_public_params();
@@ -141,6 +262,13 @@ int main(void)
     test_group<G2<edwards_pp> >();
     test_output<G2<edwards_pp> >();
     test_mul_by_q<G2<edwards_pp> >();
+    test_subgroup_check<G1<edwards_pp> >();
+    test_subgroup_check<G2<edwards_pp> >();
+    test_group<edwards_G1_extended>();
+    test_output<edwards_G1_extended>();
+    test_edwards_G1_extended();
+    test_multi_exp_with_small_scalars<G1<edwards_pp> >();
+    test_multi_exp_multi_scalar<G1<edwards_pp> >();
 
     mnt4_pp::init_public_params();
     test_group<G1<mnt4_pp> >();
@@ -148,6 +276,8 @@ int main(void)
     test_group<G2<mnt4_pp> >();
     test_output<G2<mnt4_pp> >();
     test_mul_by_q<G2<mnt4_pp> >();
+    test_subgroup_check<G1<mnt4_pp> >();
+    test_subgroup_check_on_twist<G2<mnt4_pp> >(mnt4_twist_coeff_a, mnt4_twist_coeff_b);
 
     mnt6_pp::init_public_params();
     test_group<G1<mnt6_pp> >();
@@ -155,6 +285,8 @@ int main(void)
     test_group<G2<mnt6_pp> >();
     test_output<G2<mnt6_pp> >();
     test_mul_by_q<G2<mnt6_pp> >();
+    test_subgroup_check<G1<mnt6_pp> >();
+    test_subgroup_check_on_twist<G2<mnt6_pp> >(mnt6_twist_coeff_a, mnt6_twist_coeff_b);
 
     alt_bn128_pp::init_public_params();
     test_group<G1<alt_bn128_pp> >();
@@ -162,10 +294,16 @@ int main(void)
     test_group<G2<alt_bn128_pp> >();
     test_output<G2<alt_bn128_pp> >();
     test_mul_by_q<G2<alt_bn128_pp> >();
+    test_subgroup_check<G1<alt_bn128_pp> >();
+    test_subgroup_check_on_twist<G2<alt_bn128_pp> >(alt_bn128_Fq2::zero(), alt_bn128_twist_coeff_b);
+    test_multi_exp_with_small_scalars<G1<alt_bn128_pp> >();
+    test_multi_exp_multi_scalar<G1<alt_bn128_pp> >();
 
     bn128_pp::init_public_params();
     test_group<G1<bn128_pp> >();
     test_output<G1<bn128_pp> >();
     test_group<G2<bn128_pp> >();
     test_output<G2<bn128_pp> >();
+    test_subgroup_check<G1<bn128_pp> >();
+    test_subgroup_check<G2<bn128_pp> >();
 }
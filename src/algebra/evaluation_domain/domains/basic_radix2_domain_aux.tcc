@@ -19,7 +19,9 @@
 #include <omp.h>
 #endif
 #include "algebra/fields/field_utils.hpp"
+#include "common/huge_page_allocator.hpp"
 #include "common/profiling.hpp"
+#include "common/prover_config.hpp"
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -90,7 +92,7 @@ void _basic_parallel_radix2_FFT_inner(std::vector<FieldT> &a, const FieldT &omeg
     std::vector<std::vector<FieldT> > tmp(num_cpus);
     for (size_t j = 0; j < num_cpus; ++j)
     {
-        tmp[j].resize(1ul<<(log_m-log_cpus), FieldT::zero());
+        tmp[j] = make_vector_on_huge_pages(1ul<<(log_m-log_cpus), FieldT::zero());
     }
 
 #ifdef MULTICORE
@@ -147,18 +149,15 @@ void _basic_parallel_radix2_FFT_inner(std::vector<FieldT> &a, const FieldT &omeg
 template<typename FieldT>
 void _basic_parallel_radix2_FFT(std::vector<FieldT> &a, const FieldT &omega)
 {
-#ifdef MULTICORE
-    const size_t num_cpus = omp_get_max_threads();
-#else
-    const size_t num_cpus = 1;
-#endif
+    const size_t num_cpus = active_prover_config.effective_num_threads();
     const size_t log_cpus = ((num_cpus & (num_cpus - 1)) == 0 ? log2(num_cpus) : log2(num_cpus) - 1);
 
 #ifdef DEBUG
-    print_indent(); printf("* Invoking parallel FFT on 2^%zu CPUs (omp_get_max_threads = %zu)\n", log_cpus, num_cpus);
+    print_indent(); printf("* Invoking parallel FFT on 2^%zu CPUs (thread budget = %zu)\n", log_cpus, num_cpus);
 #endif
 
-    if (log_cpus == 0)
+    /* the parallel FFT needs a scratch copy of a, so fall back to the in-place serial one if that exceeds the budget */
+    if (log_cpus == 0 || !active_prover_config.fits_scratch_budget(a.size() * sizeof(FieldT)))
     {
         _basic_serial_radix2_FFT(a, omega);
     }
@@ -219,17 +218,42 @@ std::vector<FieldT> _basic_radix2_lagrange_coeffs(const size_t m, const FieldT &
      where:
      - Z_{S}(t) = \prod_{j} (t-\omega^j) = (t^m-1), and
      - v_{i} = 1 / \prod_{j \neq i} (\omega^i-\omega^j).
-     Below we use the fact that v_{0} = 1/m and v_{i+1} = \omega * v_{i}.
+     Below we use the fact that v_{0} = 1/m and v_{i+1} = \omega * v_{i},
+     so that L_{i,S}(t) = (Z_{S}(t)/m) * \omega^i / (t-\omega^i). The
+     inversions are batched within each thread's chunk of indices.
      */
 
     const FieldT Z = (t^m)-FieldT::one();
-    FieldT l = Z * FieldT(m).inverse();
-    FieldT r = FieldT::one();
-    for (size_t i = 0; i < m; ++i)
+    const FieldT l = Z * FieldT(m).inverse();
+    const std::vector<FieldT> omega_powers = get_powers(omega, m);
+
+#ifdef MULTICORE
+    const size_t num_chunks = omp_get_max_threads();
+#else
+    const size_t num_chunks = 1;
+#endif
+    const size_t chunk_size = (m + num_chunks - 1) / num_chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk)
     {
-        u[i] = l * (t - r).inverse();
-        l *= omega;
-        r *= omega;
+        const size_t chunk_begin = std::min(m, chunk * chunk_size);
+        const size_t chunk_end = std::min(m, chunk_begin + chunk_size);
+
+        std::vector<FieldT> denominators;
+        denominators.reserve(chunk_end - chunk_begin);
+        for (size_t i = chunk_begin; i < chunk_end; ++i)
+        {
+            denominators.emplace_back(t - omega_powers[i]);
+        }
+        batch_invert(denominators);
+
+        for (size_t i = chunk_begin; i < chunk_end; ++i)
+        {
+            u[i] = l * omega_powers[i] * denominators[i - chunk_begin];
+        }
     }
 
     return u;
@@ -16,6 +16,21 @@
 
 namespace libsnark {
 
+/**
+ * Tag for the constexpr constructor of bigint from its limbs, and a
+ * macro that writes a 64-bit constant as one or two limbs (least
+ * significant first), so the same limb list works for 64-bit and 32-bit
+ * mp_limb_t. Together they let curve parameters be constant-initialized.
+ */
+struct bigint_limbs_t {};
+const bigint_limbs_t bigint_limbs = {};
+
+#if GMP_NUMB_BITS == 64
+#define BIGINT_LIMB64(x) ((mp_limb_t) (x))
+#else
+#define BIGINT_LIMB64(x) ((mp_limb_t) ((x) & 0xffffffffull)), ((mp_limb_t) ((x) >> 32))
+#endif
+
 template<mp_size_t n> class bigint;
 template<mp_size_t n> std::ostream& operator<<(std::ostream &, const bigint<n>&);
 template<mp_size_t n> std::istream& operator>>(std::istream &, bigint<n>&);
@@ -36,6 +51,8 @@ public:
     bigint(const unsigned long x); /// Initalize from a small integer
     bigint(const char* s); /// Initialize from a string containing an integer in decimal notation
     bigint(const mpz_t r); /// Initialize from MPZ element
+    template<typename... Limbs>
+    constexpr bigint(const bigint_limbs_t, const Limbs... limbs) : data{limbs...} {} /// Initialize from limbs, least significant first
 
     void print() const;
     void print_hex() const;
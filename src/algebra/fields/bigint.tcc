@@ -11,6 +11,7 @@
 #define BIGINT_TCC_
 #include <cassert>
 #include <cstring>
+#include "common/utils.hpp"
 
 namespace libsnark {
 
@@ -166,10 +167,7 @@ template<mp_size_t n>
 bigint<n>& bigint<n>::randomize()
 {
     assert(GMP_NUMB_BITS == sizeof(mp_limb_t) * 8);
-    FILE *fp = fopen("/dev/urandom", "r");  //TODO Remove hard-coded use of /dev/urandom.
-    size_t bytes_read = fread(this->data, 1, sizeof(mp_limb_t) * n, fp);
-    assert(bytes_read == sizeof(mp_limb_t) * n);
-    fclose(fp);
+    read_random_bytes(this->data, sizeof(mp_limb_t) * n);
 
     return (*this);
 }
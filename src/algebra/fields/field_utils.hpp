@@ -10,6 +10,7 @@
 #include <cstdint>
 
 #include "common/utils.hpp"
+#include "common/data_structures/packed_bit_vector.hpp"
 #include "algebra/fields/bigint.hpp"
 
 namespace libsnark {
@@ -42,9 +43,34 @@ bit_vector convert_field_element_to_bit_vector(const FieldT &el, const size_t bi
 template<typename FieldT>
 FieldT convert_bit_vector_to_field_element(const bit_vector &v);
 
+// word-level counterparts of the above, for packed_bit_vector
+template<mp_size_t n>
+bigint<n> convert_packed_bit_vector_to_bigint(const packed_bit_vector &v, const size_t offset, const size_t length);
+
+template<mp_size_t n>
+void append_bigint_to_packed_bit_vector(packed_bit_vector &v, const bigint<n> &b, const size_t num_bits);
+
+template<typename FieldT>
+std::vector<FieldT> pack_bit_vector_into_field_element_vector(const packed_bit_vector &v, const size_t chunk_bits);
+
+template<typename FieldT>
+std::vector<FieldT> pack_bit_vector_into_field_element_vector(const packed_bit_vector &v);
+
+template<typename FieldT>
+packed_bit_vector convert_field_element_vector_to_packed_bit_vector(const std::vector<FieldT> &v);
+
 template<typename FieldT>
 void batch_invert(std::vector<FieldT> &vec);
 
+// returns count uniformly random elements of a prime field, drawn from a single read of the system randomness
+// (FieldT::random_element reads it once per element)
+template<typename FieldT>
+std::vector<FieldT> random_field_elements(const size_t count);
+
+// returns (1, t, t^2, ..., t^{n-1}); with MULTICORE, each thread computes a contiguous chunk of the powers
+template<typename FieldT>
+std::vector<FieldT> get_powers(const FieldT &t, const size_t n);
+
 } // libsnark
 #include "algebra/fields/field_utils.tcc"
 
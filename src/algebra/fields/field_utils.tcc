@@ -10,6 +10,11 @@
 #ifndef FIELD_UTILS_TCC_
 #define FIELD_UTILS_TCC_
 
+#include <algorithm>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -94,9 +99,11 @@ std::vector<FieldT> convert_bit_vector_to_field_element_vector(const bit_vector
     std::vector<FieldT> result;
     result.reserve(v.size());
 
+    const FieldT one = FieldT::one();
+    const FieldT zero = FieldT::zero();
     for (const bool b : v)
     {
-        result.emplace_back(b ? FieldT::one() : FieldT::zero());
+        result.emplace_back(b ? one : zero);
     }
 
     return result;
@@ -119,12 +126,18 @@ bit_vector convert_field_element_vector_to_bit_vector(const std::vector<FieldT>
 template<typename FieldT>
 bit_vector convert_field_element_to_bit_vector(const FieldT &el)
 {
-    bit_vector result;
+    const size_t num_bits = FieldT::size_in_bits();
+    bit_vector result(num_bits);
 
-    bigint<FieldT::num_limbs> b = el.as_bigint();
-    for (size_t i = 0; i < FieldT::size_in_bits(); ++i)
+    const bigint<FieldT::num_limbs> b = el.as_bigint();
+    for (size_t w = 0; w * GMP_NUMB_BITS < num_bits; ++w)
     {
-        result.push_back(b.test_bit(i));
+        mp_limb_t word = b.data[w];
+        const size_t end = std::min<size_t>((w+1) * GMP_NUMB_BITS, num_bits);
+        for (size_t i = w * GMP_NUMB_BITS; i < end; ++i, word >>= 1)
+        {
+            result[i] = (word & 1);
+        }
     }
 
     return result;
@@ -144,14 +157,77 @@ FieldT convert_bit_vector_to_field_element(const bit_vector &v)
 {
     assert(v.size() <= FieldT::size_in_bits());
 
-    FieldT res = FieldT::zero();
-    FieldT c = FieldT::one();
-    for (bool b : v)
+    /* assemble the limbs directly and convert to Montgomery form once */
+    bigint<FieldT::num_limbs> b;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        b.data[i / GMP_NUMB_BITS] |= ((mp_limb_t)v[i]) << (i % GMP_NUMB_BITS);
+    }
+    return FieldT(b);
+}
+
+template<mp_size_t n>
+bigint<n> convert_packed_bit_vector_to_bigint(const packed_bit_vector &v, const size_t offset, const size_t length)
+{
+    assert(length <= n * GMP_NUMB_BITS);
+    assert(offset + length <= v.size());
+
+    bigint<n> b;
+    for (size_t l = 0; l * GMP_NUMB_BITS < length; ++l)
+    {
+        const size_t width = std::min<size_t>(GMP_NUMB_BITS, length - l * GMP_NUMB_BITS);
+        b.data[l] = v.get_word(offset + l * GMP_NUMB_BITS, width);
+    }
+
+    return b;
+}
+
+template<mp_size_t n>
+void append_bigint_to_packed_bit_vector(packed_bit_vector &v, const bigint<n> &b, const size_t num_bits)
+{
+    assert(num_bits <= n * GMP_NUMB_BITS);
+
+    for (size_t l = 0; l * GMP_NUMB_BITS < num_bits; ++l)
+    {
+        v.append_word(b.data[l], std::min<size_t>(GMP_NUMB_BITS, num_bits - l * GMP_NUMB_BITS));
+    }
+}
+
+template<typename FieldT>
+std::vector<FieldT> pack_bit_vector_into_field_element_vector(const packed_bit_vector &v, const size_t chunk_bits)
+{
+    assert(chunk_bits <= FieldT::capacity());
+
+    const size_t repacked_size = div_ceil(v.size(), chunk_bits);
+    std::vector<FieldT> result;
+    result.reserve(repacked_size);
+
+    for (size_t i = 0; i < repacked_size; ++i)
     {
-        res += b ? c : FieldT::zero();
-        c += c;
+        const size_t length = std::min(chunk_bits, v.size() - i * chunk_bits);
+        result.emplace_back(FieldT(convert_packed_bit_vector_to_bigint<FieldT::num_limbs>(v, i * chunk_bits, length)));
     }
-    return res;
+
+    return result;
+}
+
+template<typename FieldT>
+std::vector<FieldT> pack_bit_vector_into_field_element_vector(const packed_bit_vector &v)
+{
+    return pack_bit_vector_into_field_element_vector<FieldT>(v, FieldT::capacity());
+}
+
+template<typename FieldT>
+packed_bit_vector convert_field_element_vector_to_packed_bit_vector(const std::vector<FieldT> &v)
+{
+    packed_bit_vector result;
+
+    for (const FieldT &el : v)
+    {
+        append_bigint_to_packed_bit_vector<FieldT::num_limbs>(result, el.as_bigint(), FieldT::size_in_bits());
+    }
+
+    return result;
 }
 
 template<typename FieldT>
@@ -179,5 +255,74 @@ void batch_invert(std::vector<FieldT> &vec)
     }
 }
 
+template<typename FieldT>
+std::vector<FieldT> random_field_elements(const size_t count)
+{
+    assert(GMP_NUMB_BITS == sizeof(mp_limb_t) * 8);
+
+    /* mask that clears all bits of the most significant limb higher than MSB of modulus */
+    const size_t top_limb_bits = FieldT::mod.num_bits() - GMP_NUMB_BITS * (FieldT::num_limbs - 1);
+    const mp_limb_t top_limb_mask = (top_limb_bits == GMP_NUMB_BITS ? ~mp_limb_t(0) : (mp_limb_t(1) << top_limb_bits) - 1);
+
+    std::vector<FieldT> result(count);
+    std::vector<mp_limb_t> buffer;
+
+    size_t num_sampled = 0;
+    while (num_sampled < count)
+    {
+        /* read enough randomness for all remaining elements; only rejected candidates cause another read */
+        const size_t num_candidates = count - num_sampled;
+        buffer.resize(num_candidates * FieldT::num_limbs);
+        read_random_bytes(buffer.data(), sizeof(mp_limb_t) * buffer.size());
+
+        for (size_t i = 0; i < num_candidates; ++i)
+        {
+            /* as in FieldT::random_element, sampling the Montgomery representation is as good as sampling the element */
+            bigint<FieldT::num_limbs> &rval = result[num_sampled].mont_repr;
+            std::copy(buffer.begin() + i * FieldT::num_limbs, buffer.begin() + (i+1) * FieldT::num_limbs, rval.data);
+            rval.data[FieldT::num_limbs - 1] &= top_limb_mask;
+
+            if (mpn_cmp(rval.data, FieldT::mod.data, FieldT::num_limbs) < 0)
+            {
+                ++num_sampled;
+            }
+        }
+    }
+
+    return result;
+}
+
+template<typename FieldT>
+std::vector<FieldT> get_powers(const FieldT &t, const size_t n)
+{
+    std::vector<FieldT> result(n);
+
+#ifdef MULTICORE
+    const size_t num_chunks = omp_get_max_threads();
+#else
+    const size_t num_chunks = 1;
+#endif
+    const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        const size_t chunk_begin = std::min(n, chunk * chunk_size);
+        const size_t chunk_end = std::min(n, chunk_begin + chunk_size);
+
+        /* each chunk starts from its own t^{chunk_begin}, and continues with a running product */
+        FieldT ti = t ^ bigint<1>(chunk_begin);
+        for (size_t i = chunk_begin; i < chunk_end; ++i)
+        {
+            result[i] = ti;
+            ti *= t;
+        }
+    }
+
+    return result;
+}
+
 } // libsnark
 #endif // FIELD_UTILS_TCC_
@@ -18,6 +18,13 @@ namespace libsnark {
 template<mp_size_t n, const bigint<n>& modulus>
 class Fp_model;
 
+/**
+ * Tag for the constexpr constructor of Fp_model from the limbs of its
+ * Montgomery representation (see BIGINT_LIMB64 in bigint.hpp).
+ */
+struct montgomery_limbs_t {};
+const montgomery_limbs_t montgomery_limbs = {};
+
 template<mp_size_t n, const bigint<n>& modulus>
 std::ostream& operator<<(std::ostream &, const Fp_model<n, modulus>&);
 
@@ -68,6 +75,8 @@ public:
     Fp_model() {};
     Fp_model(const bigint<n> &b);
     Fp_model(const long x, const bool is_unsigned=false);
+    template<typename... Limbs>
+    constexpr Fp_model(const montgomery_limbs_t, const Limbs... limbs) : mont_repr(bigint_limbs, limbs...) {}
 
     void set_ulong(const unsigned long x);
 
@@ -105,7 +114,7 @@ public:
     Fp_model squared() const;
     Fp_model& invert();
     Fp_model inverse() const;
-    Fp_model sqrt() const; // HAS TO BE A SQUARE (else does not terminate)
+    Fp_model sqrt() const; // if not a square, returns a non-root (check by squaring)
 
     Fp_model operator^(const unsigned long pow) const;
     template<mp_size_t m>
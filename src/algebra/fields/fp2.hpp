@@ -47,7 +47,7 @@ public:
 
     my_Fp c0, c1;
     Fp2_model() {};
-    Fp2_model(const my_Fp& c0, const my_Fp& c1) : c0(c0), c1(c1) {};
+    constexpr Fp2_model(const my_Fp& c0, const my_Fp& c1) : c0(c0), c1(c1) {};
 
     void clear() { c0.clear(); c1.clear(); }
     void print() const { printf("c0/c1:\n"); c0.print(); c1.print(); }
@@ -67,7 +67,7 @@ public:
     Fp2_model squared() const; // default is squared_complex
     Fp2_model inverse() const;
     Fp2_model Frobenius_map(unsigned long power) const;
-    Fp2_model sqrt() const; // HAS TO BE A SQUARE (else does not terminate)
+    Fp2_model sqrt() const; // if not a square, returns a non-root (check by squaring)
     Fp2_model squared_karatsuba() const;
     Fp2_model squared_complex() const;
 
@@ -153,33 +153,25 @@ Fp2_model<n,modulus> Fp2_model<n,modulus>::sqrt() const
     Fp2_model<n,modulus> x = (*this) * w;
     Fp2_model<n,modulus> b = x * w; // b = (*this)^t
 
-#if DEBUG
-    // check if square with euler's criterion
-    Fp2_model<n,modulus> check = b;
-    for (size_t i = 0; i < v-1; ++i)
-    {
-        check = check.squared();
-    }
-    if (check != one)
-    {
-        assert(0);
-    }
-#endif
-
     // compute square root with Tonelli--Shanks
-    // (does not terminate if not a square!)
 
     while (b != one)
     {
         size_t m = 0;
         Fp2_model<n,modulus> b2m = b;
-        while (b2m != one)
+        while (b2m != one && m < v)
         {
             /* invariant: b2m = b^(2^m) after entering this loop */
             b2m = b2m.squared();
             m += 1;
         }
 
+        if (m == v)
+        {
+            /* b has order 2^v (or is zero): this is zero, and so is x, or not a square */
+            break;
+        }
+
         int j = v-m-1;
         w = z;
         while (j > 0)
@@ -48,7 +48,7 @@ public:
 
     my_Fp c0, c1, c2;
     Fp3_model() {};
-    Fp3_model(const my_Fp& c0, const my_Fp& c1, const my_Fp& c2) : c0(c0), c1(c1), c2(c2) {};
+    constexpr Fp3_model(const my_Fp& c0, const my_Fp& c1, const my_Fp& c2) : c0(c0), c1(c1), c2(c2) {};
 
     void clear() { c0.clear(); c1.clear(); c2.clear(); }
     void print() const { printf("c0/c1/c2:\n"); c0.print(); c1.print(); c2.print(); }
@@ -68,7 +68,7 @@ public:
     Fp3_model squared() const;
     Fp3_model inverse() const;
     Fp3_model Frobenius_map(unsigned long power) const;
-    Fp3_model sqrt() const; // HAS TO BE A SQUARE (else does not terminate)
+    Fp3_model sqrt() const; // if not a square, returns a non-root (check by squaring)
 
     template<mp_size_t m>
     Fp3_model operator^(const bigint<m> &other) const;
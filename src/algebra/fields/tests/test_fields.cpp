@@ -12,6 +12,8 @@
 #include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
 #include "algebra/fields/fp6_3over2.hpp"
 #include "algebra/fields/fp12_2over3over2.hpp"
+#include "common/rng.hpp"
+#include "common/data_structures/packed_bit_vector.hpp"
 
 using namespace libsnark;
 
@@ -57,7 +59,73 @@ void test_sqrt()
         FieldT a = FieldT::random_element();
         FieldT asq = a.squared();
         assert(asq.sqrt() == a || asq.sqrt() == -a);
+
+        // sqrt terminates on non-squares, without returning a root
+        FieldT nsq = FieldT::nqr * asq;
+        assert(nsq.sqrt().squared() != nsq);
+    }
+    assert(FieldT::zero().sqrt() == FieldT::zero());
+}
+
+template<typename FieldT>
+void test_SHA512_rng_bulk()
+{
+    const std::vector<FieldT> compat = SHA512_rng_bulk<FieldT>(100, 50, SHA512_rng_compat);
+    for (size_t i = 0; i < compat.size(); ++i)
+    {
+        assert(compat[i] == SHA512_rng<FieldT>(100 + i));
+    }
+
+    // counter mode is deterministic, and shorter outputs are prefixes of longer ones
+    const std::vector<FieldT> counter = SHA512_rng_bulk<FieldT>(7, 2500, SHA512_rng_counter);
+    const std::vector<FieldT> counter_prefix = SHA512_rng_bulk<FieldT>(7, 1500, SHA512_rng_counter);
+    assert(std::equal(counter_prefix.begin(), counter_prefix.end(), counter.begin()));
+    assert(counter[0] != counter[1]);
+    assert(counter[0] != SHA512_rng_bulk<FieldT>(8, 1, SHA512_rng_counter)[0]);
+    assert(SHA512_rng_bulk<FieldT>(7, 0, SHA512_rng_counter).empty());
+}
+
+template<typename FieldT>
+void test_bulk_sampling_and_powers()
+{
+    const std::vector<FieldT> v = random_field_elements<FieldT>(100);
+    assert(v[0] != v[1]);
+    assert(random_field_elements<FieldT>(0).empty());
+
+    const std::vector<FieldT> powers = get_powers(v[0], 1000);
+    FieldT ti = FieldT::one();
+    for (size_t i = 0; i < powers.size(); ++i)
+    {
+        assert(powers[i] == ti);
+        ti *= v[0];
     }
+    assert(get_powers(v[0], 0).empty());
+}
+
+template<typename FieldT>
+void test_packed_bit_vector()
+{
+    bit_vector bits(3 * FieldT::capacity() + 17);
+    for (size_t i = 0; i < bits.size(); ++i)
+    {
+        bits[i] = (std::rand() % 2);
+    }
+
+    const packed_bit_vector packed(bits);
+    assert(packed.to_bit_vector() == bits);
+    assert(packed.popcount() == (size_t)std::count(bits.begin(), bits.end(), true));
+    assert(pack_bit_vector_into_field_element_vector<FieldT>(packed) == pack_bit_vector_into_field_element_vector<FieldT>(bits));
+    assert(pack_bit_vector_into_field_element_vector<FieldT>(packed, 77) == pack_bit_vector_into_field_element_vector<FieldT>(bits, 77));
+
+    // unaligned slices and concatenations
+    const packed_bit_vector head = packed.slice(0, 71), tail = packed.slice(71, packed.size() - 71);
+    assert(tail.to_bit_vector() == bit_vector(bits.begin() + 71, bits.end()));
+    packed_bit_vector joined = head;
+    joined.append(tail);
+    assert(joined == packed);
+
+    const std::vector<FieldT> elems = { FieldT::random_element(), -FieldT::one(), FieldT::zero() };
+    assert(convert_field_element_vector_to_packed_bit_vector<FieldT>(elems).to_bit_vector() == convert_field_element_vector_to_bit_vector<FieldT>(elems));
 }
 
 template<typename FieldT>
@@ -132,9 +200,95 @@ void test_cyclotomic_squaring<Fqk<mnt6_pp> >()
     assert(beta.cyclotomic_squared() == beta.squared());
 }
 
+/* recompute the sizes and Montgomery constants of a prime field, which are given as precomputed limbs, from its modulus */
+template<typename FieldT>
+void test_field_params()
+{
+    const mp_size_t n = FieldT::num_limbs;
+    mpz_t p, p_minus_1, x, W;
+    mpz_inits(p, p_minus_1, x, W, NULL);
+    FieldT::mod.to_mpz(p);
+    mpz_sub_ui(p_minus_1, p, 1);
+    assert(mpz_sizeinbase(p, 2) == FieldT::num_bits);
+
+    /* R = W^n mod p, where W = 2^GMP_NUMB_BITS */
+    mpz_t R;
+    mpz_init_set_ui(R, 1);
+    mpz_mul_2exp(R, R, GMP_NUMB_BITS * n);
+    mpz_mod(R, R, p);
+    mpz_mul(x, R, R);
+    mpz_mod(x, x, p);
+    assert(bigint<n>(x) == FieldT::Rsquared);
+    mpz_mul(x, x, R);
+    mpz_mod(x, x, p);
+    assert(bigint<n>(x) == FieldT::Rcubed);
+
+    /* inv = -p^(-1) mod W */
+    mpz_set_ui(W, 1);
+    mpz_mul_2exp(W, W, GMP_NUMB_BITS);
+    mpz_invert(x, p, W);
+    mpz_sub(x, W, x);
+    assert(mpz_get_ui(x) == FieldT::inv);
+
+    mpz_fdiv_q_2exp(x, p_minus_1, 1);
+    assert(bigint<n>(x) == FieldT::euler);
+    const size_t s = mpz_scan1(p_minus_1, 0);
+    assert(s == FieldT::s);
+    mpz_fdiv_q_2exp(x, p_minus_1, s);
+    assert(bigint<n>(x) == FieldT::t);
+    mpz_fdiv_q_2exp(x, x, 1);
+    assert(bigint<n>(x) == FieldT::t_minus_1_over_2);
+
+    /* a generator, like nqr, is a quadratic non-residue, and root_of_unity has order exactly 2^s */
+    const FieldT minus_one = -FieldT::one();
+    assert((FieldT::multiplicative_generator ^ FieldT::euler) == minus_one);
+    assert((FieldT::nqr ^ FieldT::euler) == minus_one);
+    assert(FieldT::nqr_to_t == (FieldT::nqr ^ FieldT::t));
+    FieldT root = FieldT::root_of_unity;
+    for (size_t i = 1; i < s; ++i)
+    {
+        root = root.squared();
+    }
+    assert(root == minus_one);
+
+    mpz_clears(p, p_minus_1, x, W, R, NULL);
+}
+
+/* the same for the quadratic non-residue and the 2-adic decomposition of an Fp2 or Fp3 */
+template<typename FieldT>
+void test_extension_field_params()
+{
+    typedef decltype(FieldT::t) bigint_type;
+    const size_t degree = FieldT::size_in_bits() / FieldT::my_Fp::size_in_bits();
+
+    mpz_t q_minus_1, p, x;
+    mpz_inits(q_minus_1, p, x, NULL);
+    FieldT::my_Fp::mod.to_mpz(p);
+    mpz_pow_ui(q_minus_1, p, degree);
+    mpz_sub_ui(q_minus_1, q_minus_1, 1);
+
+    mpz_fdiv_q_2exp(x, q_minus_1, 1);
+    assert(bigint_type(x) == FieldT::euler);
+    const size_t s = mpz_scan1(q_minus_1, 0);
+    assert(s == FieldT::s);
+    mpz_fdiv_q_2exp(x, q_minus_1, s);
+    assert(bigint_type(x) == FieldT::t);
+    mpz_fdiv_q_2exp(x, x, 1);
+    assert(bigint_type(x) == FieldT::t_minus_1_over_2);
+
+    assert((FieldT::nqr ^ FieldT::euler) == -FieldT::one());
+    assert(FieldT::nqr_to_t == (FieldT::nqr ^ FieldT::t));
+
+    mpz_clears(q_minus_1, p, x, NULL);
+}
+
 template<typename ppT>
 void test_all_fields()
 {
+    test_field_params<Fr<ppT> >();
+    test_field_params<Fq<ppT> >();
+    test_extension_field_params<Fqe<ppT> >();
+
     test_field<Fr<ppT> >();
     test_field<Fq<ppT> >();
     test_field<Fqe<ppT> >();
@@ -144,6 +298,11 @@ void test_all_fields()
     test_sqrt<Fq<ppT> >();
     test_sqrt<Fqe<ppT> >();
 
+    test_SHA512_rng_bulk<Fr<ppT> >();
+    test_SHA512_rng_bulk<Fq<ppT> >();
+    test_bulk_sampling_and_powers<Fr<ppT> >();
+    test_packed_bit_vector<Fr<ppT> >();
+
     test_Frobenius<Fqe<ppT> >();
     test_Frobenius<Fqk<ppT> >();
 
@@ -236,6 +395,8 @@ int main(void)
     test_all_fields<alt_bn128_pp>();
 
     bn128_pp::init_public_params();
+    test_field_params<Fr<bn128_pp> >();
+    test_field_params<Fq<bn128_pp> >();
     test_field<Fr<bn128_pp> >();
     test_field<Fq<bn128_pp> >();
 }
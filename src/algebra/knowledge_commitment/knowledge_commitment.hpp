@@ -44,6 +44,8 @@ struct knowledge_commitment {
     knowledge_commitment<T1,T2>& operator=(const knowledge_commitment<T1,T2> &other) = default;
     knowledge_commitment<T1,T2>& operator=(knowledge_commitment<T1,T2> &&other) = default;
     knowledge_commitment<T1,T2> operator+(const knowledge_commitment<T1, T2> &other) const;
+    knowledge_commitment<T1,T2> operator-() const;
+    knowledge_commitment<T1,T2> dbl() const;
 
     bool operator==(const knowledge_commitment<T1,T2> &other) const;
 
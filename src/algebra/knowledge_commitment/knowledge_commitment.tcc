@@ -43,6 +43,20 @@ knowledge_commitment<T1,T2> knowledge_commitment<T1,T2>::operator+(const knowled
                                        this->h + other.h);
 }
 
+template<typename T1, typename T2>
+knowledge_commitment<T1,T2> knowledge_commitment<T1,T2>::operator-() const
+{
+    return knowledge_commitment<T1,T2>(-this->g,
+                                       -this->h);
+}
+
+template<typename T1, typename T2>
+knowledge_commitment<T1,T2> knowledge_commitment<T1,T2>::dbl() const
+{
+    return knowledge_commitment<T1,T2>(this->g.dbl(),
+                                       this->h.dbl());
+}
+
 template<typename T1, typename T2>
 bool knowledge_commitment<T1,T2>::operator==(const knowledge_commitment<T1,T2> &other) const
 {
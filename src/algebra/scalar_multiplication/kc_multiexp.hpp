@@ -34,6 +34,21 @@ knowledge_commitment<T1, T2> kc_multi_exp_with_mixed_addition(const knowledge_co
                                                                 const size_t chunks,
                                                                 const bool use_multiexp=false);
 
+/**
+ * Evaluates the knowledge-commitment query vec, restricted to the indices
+ * [min_idx, max_idx), against several scalar vectors at once: for every k,
+ * the result is the one kc_multi_exp_with_mixed_addition would return for
+ * the scalars starting at scalar_starts[k] (which are indexed from min_idx).
+ * The query is read once for all scalar vectors, so proving several
+ * witnesses for the same key does not re-stream the key for each proof.
+ */
+template<typename T1, typename T2, typename FieldT>
+std::vector<knowledge_commitment<T1, T2> > kc_multi_exp_multi_scalar(const knowledge_commitment_vector<T1, T2> &vec,
+                                                                     const size_t min_idx,
+                                                                     const size_t max_idx,
+                                                                     const std::vector<typename std::vector<FieldT>::const_iterator> &scalar_starts,
+                                                                     const size_t chunks);
+
 template<typename T1, typename T2>
 void kc_batch_to_special(std::vector<knowledge_commitment<T1, T2> > &vec);
 
@@ -28,60 +28,69 @@ knowledge_commitment<T1, T2> kc_multi_exp_with_mixed_addition(const knowledge_co
                                                                 const bool use_multiexp)
 {
     enter_block("Process scalar vector");
-    auto index_it = std::lower_bound(vec.indices.begin(), vec.indices.end(), min_idx);
-    const size_t offset = index_it - vec.indices.begin();
-
-    auto value_it = vec.values.begin() + offset;
-
-    const FieldT zero = FieldT::zero();
-    const FieldT one = FieldT::one();
+    const size_t offset = std::lower_bound(vec.indices.begin(), vec.indices.end(), min_idx) - vec.indices.begin();
+    const size_t end_offset = std::lower_bound(vec.indices.begin() + offset, vec.indices.end(), max_idx) - vec.indices.begin();
 
     std::vector<FieldT> p;
     std::vector<knowledge_commitment<T1, T2> > g;
 
-    knowledge_commitment<T1, T2> acc = knowledge_commitment<T1, T2>::zero();
+    const auto add_base = [](const knowledge_commitment<T1, T2> &sum, const knowledge_commitment<T1, T2> &base) {
+#ifdef USE_MIXED_ADDITION
+        return knowledge_commitment<T1, T2>(sum.g.mixed_add(base.g), sum.h.mixed_add(base.h));
+#else
+        return sum + base;
+#endif
+    };
+
+    std::vector<size_t> small_p;
+    std::vector<knowledge_commitment<T1, T2> > small_g;
+    split_scalar_statistics stats;
+    const knowledge_commitment<T1, T2> acc =
+        split_scalar_vector<knowledge_commitment<T1, T2>, FieldT>(end_offset - offset,
+                                                                  [&vec, offset](const size_t j) -> const knowledge_commitment<T1, T2>& { return vec.values[offset + j]; },
+                                                                  [&vec, offset, min_idx, scalar_start](const size_t j) -> const FieldT& { return *(scalar_start + (vec.indices[offset + j] - min_idx)); },
+                                                                  add_base, g, p, small_g, small_p,
+                                                                  use_multiexp ? multi_exp_small_scalar_bits : 0, chunks, stats);
+    stats.print();
+    leave_block("Process scalar vector");
 
-    size_t num_skip = 0;
-    size_t num_add = 0;
-    size_t num_other = 0;
+    return acc + small_scalar_multi_exp<knowledge_commitment<T1, T2> >(small_g, small_p, stats.max_small_bit_length(), chunks, add_base) +
+        multi_exp<knowledge_commitment<T1, T2>, FieldT>(g.begin(), g.end(), p.begin(), p.end(), chunks, use_multiexp);
+}
 
-    while (index_it != vec.indices.end() && *index_it < max_idx)
-    {
-        const FieldT scalar = *(scalar_start + ((*index_it) - min_idx));
+template<typename T1, typename T2, typename FieldT>
+std::vector<knowledge_commitment<T1, T2> > kc_multi_exp_multi_scalar(const knowledge_commitment_vector<T1, T2> &vec,
+                                                                     const size_t min_idx,
+                                                                     const size_t max_idx,
+                                                                     const std::vector<typename std::vector<FieldT>::const_iterator> &scalar_starts,
+                                                                     const size_t chunks)
+{
+    const size_t offset = std::lower_bound(vec.indices.begin(), vec.indices.end(), min_idx) - vec.indices.begin();
+    const size_t end_offset = std::lower_bound(vec.indices.begin() + offset, vec.indices.end(), max_idx) - vec.indices.begin();
+    const size_t num_bases = end_offset - offset;
 
-        if (scalar == zero)
-        {
-            // do nothing
-            ++num_skip;
-        }
-        else if (scalar == one)
-        {
-#ifdef USE_MIXED_ADDITION
-            acc.g = acc.g.mixed_add(value_it->g);
-            acc.h = acc.h.mixed_add(value_it->h);
-#else
-            acc.g = acc.g + value_it->g;
-            acc.h = acc.h + value_it->h;
+    std::vector<std::vector<bigint<FieldT::num_limbs> > > exponents(scalar_starts.size(), std::vector<bigint<FieldT::num_limbs> >(num_bases));
+    for (size_t i = 0; i < scalar_starts.size(); ++i)
+    {
+#ifdef MULTICORE
+#pragma omp parallel for
 #endif
-            ++num_add;
-        }
-        else
+        for (size_t j = 0; j < num_bases; ++j)
         {
-            p.emplace_back(scalar);
-            g.emplace_back(*value_it);
-            ++num_other;
+            exponents[i][j] = (scalar_starts[i] + (vec.indices[offset + j] - min_idx))->as_bigint();
         }
-
-        ++index_it;
-        ++value_it;
     }
 
-    print_indent(); printf("* Elements of w skipped: %zu (%0.2f%%)\n", num_skip, 100.*num_skip/(num_skip+num_add+num_other));
-    print_indent(); printf("* Elements of w processed with special addition: %zu (%0.2f%%)\n", num_add, 100.*num_add/(num_skip+num_add+num_other));
-    print_indent(); printf("* Elements of w remaining: %zu (%0.2f%%)\n", num_other, 100.*num_other/(num_skip+num_add+num_other));
-    leave_block("Process scalar vector");
-
-    return acc + multi_exp<knowledge_commitment<T1, T2>, FieldT>(g.begin(), g.end(), p.begin(), p.end(), chunks, use_multiexp);
+    return multi_scalar_bucket_exp<knowledge_commitment<T1, T2> >(num_bases,
+                                                                  [&vec, offset](const size_t j) -> const knowledge_commitment<T1, T2>& { return vec.values[offset + j]; },
+                                                                  exponents, FieldT::size_in_bits(), chunks,
+                                                                  [](const knowledge_commitment<T1, T2> &sum, const knowledge_commitment<T1, T2> &base) {
+#ifdef USE_MIXED_ADDITION
+                                                                      return knowledge_commitment<T1, T2>(sum.g.mixed_add(base.g), sum.h.mixed_add(base.h));
+#else
+                                                                      return sum + base;
+#endif
+                                                                  });
 }
 
 template<typename T1, typename T2>
@@ -197,6 +206,7 @@ knowledge_commitment_vector<T1, T2> kc_batch_exp(const size_t scalar_size,
                                                  const size_t suggested_num_chunks)
 {
     knowledge_commitment_vector<T1, T2> res;
+    assert(v.size() <= res.max_domain_size());
     res.domain_size_ = v.size();
 
     size_t nonzero = 0;
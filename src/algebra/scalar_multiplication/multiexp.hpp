@@ -12,6 +12,10 @@
 #ifndef MULTIEXP_HPP_
 #define MULTIEXP_HPP_
 
+#include <vector>
+
+#include "common/huge_page_allocator.hpp"
+
 namespace libsnark {
 
 /**
@@ -46,6 +50,130 @@ T multi_exp(typename std::vector<T>::const_iterator vec_start,
             const bool use_multiexp=false);
 
 
+/**
+ * Returns the sum of the given terms, added pairwise along a balanced binary
+ * tree; the additions of each level of the tree are done in parallel.
+ */
+template<typename T>
+T tree_sum(std::vector<T> terms);
+
+/**
+ * Scalars below 2^multi_exp_small_scalar_bits (other than 0 and 1) are
+ * handled by small_scalar_multi_exp, rather than by a full-length multi_exp,
+ * when use_multiexp is set; otherwise all of them go to the naive path.
+ */
+const size_t multi_exp_small_scalar_bits = 16;
+
+/**
+ * The distribution of a scalar vector, as split by split_scalar_vector.
+ */
+struct split_scalar_statistics {
+    size_t num_skip;  /* scalar 0 */
+    size_t num_add;   /* scalar 1 */
+    size_t num_small; /* 1 < scalar < 2^small_scalar_bits */
+    size_t num_other;
+    std::vector<size_t> small_bit_lengths; /* small_bit_lengths[b] = number of small scalars of exactly b bits */
+
+    split_scalar_statistics() : num_skip(0), num_add(0), num_small(0), num_other(0) {};
+    size_t max_small_bit_length() const;
+    void print() const;
+};
+
+/**
+ * Splits n pairs (base_at(j), scalar_at(j)) according to their scalar: pairs
+ * with scalar 0 are skipped, the bases of pairs with scalar 1 are summed with
+ * add_base and their sum is returned, pairs with a scalar of at most
+ * small_scalar_bits bits are written, in order, to small_bases and
+ * small_scalars, and the other pairs to bases and scalars.
+ *
+ * The pairs are cut into num_blocks blocks, which are scanned in parallel
+ * twice: the first pass classifies, sums and counts, a prefix sum over the
+ * counts gives every block its output offsets, and the second pass writes
+ * the pairs there. Finally, bases and small_bases are placed on NUMA nodes
+ * according to the active prover configuration (see common/numa_placement.hpp),
+ * so that under numa_partition every chunk of multi_exp and of
+ * small_scalar_multi_exp is local to the worker thread that processes it.
+ */
+template<typename T, typename FieldT, typename BaseAt, typename ScalarAt, typename AddBase>
+T split_scalar_vector(const size_t n,
+                      BaseAt base_at,
+                      ScalarAt scalar_at,
+                      AddBase add_base,
+                      std::vector<T> &bases,
+                      std::vector<FieldT> &scalars,
+                      std::vector<T> &small_bases,
+                      std::vector<size_t> &small_scalars,
+                      const size_t small_scalar_bits,
+                      const size_t num_blocks,
+                      split_scalar_statistics &stats);
+
+/**
+ * Computes sum_i scalars[i] * bases[i] for scalars of at most scalar_bits
+ * bits, with the bucket method: each window of c bits costs one addition per
+ * base and 2^(c+1) additions to combine the buckets, and c is chosen to
+ * minimize the total. The bases are split into chunks ranges, processed in
+ * parallel, and added into the buckets with add_base.
+ */
+template<typename T, typename AddBase>
+T small_scalar_multi_exp(const std::vector<T> &bases,
+                         const std::vector<size_t> &scalars,
+                         const size_t scalar_bits,
+                         const size_t chunks,
+                         AddBase add_base);
+
+/**
+ * Returns the window size c that minimizes the number of additions of the
+ * bucket method, ceil(num_bits/c) * (num_terms + 2^(c+1)), for windows of at
+ * most max_window bits.
+ */
+const size_t bucket_max_window_size = 16;
+inline size_t bucket_window_size(const size_t num_bits, const size_t num_terms, const size_t max_window);
+
+/**
+ * Returns the largest window size c (at most bucket_max_window_size, and at
+ * least 1) such that 2^c buckets of bucket_bytes bytes each fit the scratch
+ * budget of the active prover configuration.
+ */
+inline size_t max_bucket_window_size(const size_t bucket_bytes);
+
+/**
+ * Computes, for every k, sum_j exponents[k][j] * base_at(j) over the
+ * num_bases bases, with the bucket method. All k sums share each pass over
+ * the bases: every base is read once per window and added (with add_base)
+ * to one bucket of each exponent vector. The bases are split into chunks
+ * ranges, processed in parallel.
+ */
+template<typename T, mp_size_t n, typename BaseAt, typename AddBase>
+std::vector<T> multi_scalar_bucket_exp(const size_t num_bases,
+                                       BaseAt base_at,
+                                       const std::vector<std::vector<bigint<n> > > &exponents,
+                                       const size_t num_bits,
+                                       const size_t chunks,
+                                       AddBase add_base);
+
+/**
+ * Multi-exponentiation of one vector of bases by several scalar vectors:
+ * returns, for every k, the multi-exponentiation of [vec_start, vec_end) by
+ * the scalars starting at scalar_starts[k]. It reads the bases once for all
+ * scalar vectors (see multi_scalar_bucket_exp), which is cheaper than k
+ * separate multi_exp's when they are bound by memory bandwidth. Uses
+ * mixed_add if built with USE_MIXED_ADDITION (the bases must then be special).
+ */
+template<typename T, typename FieldT>
+std::vector<T> multi_exp_multi_scalar(typename std::vector<T>::const_iterator vec_start,
+                                      typename std::vector<T>::const_iterator vec_end,
+                                      const std::vector<typename std::vector<FieldT>::const_iterator> &scalar_starts,
+                                      const size_t chunks);
+
+/**
+ * Returns the scratch memory (in bytes) multi_exp uses for num_terms terms.
+ * The Bos-Coster method copies the bases and the exponents; if that exceeds
+ * the scratch budget of the active prover configuration, multi_exp uses the
+ * bucket method instead, which only copies the exponents.
+ */
+template<typename T, typename FieldT>
+size_t multi_exp_scratch_size_in_bytes(const size_t num_terms);
+
 /**
  * A variant of multi_exp that takes advantage of the method mixed_add (instead of the operator '+').
  */
@@ -57,11 +185,26 @@ T multi_exp_with_mixed_addition(typename std::vector<T>::const_iterator vec_star
                                   const size_t chunks,
                                   const bool use_multiexp);
 
+/**
+ * A multi-exponentiation for (multiplicatively written) elements of a cyclotomic
+ * subgroup, such as GT: computes the product of the bases raised to the scalars.
+ *
+ * The wNAF expansions of all scalars are interleaved (Straus), so all bases share
+ * a single chain of cyclotomic squarings, and negative digits use the unitary
+ * inverse, which is free in the cyclotomic subgroup.
+ */
+template<typename T, typename FieldT>
+T cyclotomic_multi_exp(typename std::vector<T>::const_iterator vec_start,
+                       typename std::vector<T>::const_iterator vec_end,
+                       typename std::vector<FieldT>::const_iterator scalar_start,
+                       typename std::vector<FieldT>::const_iterator scalar_end);
+
 /**
  * A window table stores window sizes for different instance sizes for fixed-base multi-scalar multiplications.
+ * Its rows are looked up at random offsets, so they are backed by huge pages if the prover configuration asks for them.
  */
 template<typename T>
-using window_table = std::vector<std::vector<T> >;
+using window_table = std::vector<huge_page_vector<T> >;
 
 /**
  * Compute window size for the given number of scalars.
@@ -69,6 +212,19 @@ using window_table = std::vector<std::vector<T> >;
 template<typename T>
 size_t get_exp_window_size(const size_t num_scalars);
 
+/**
+ * Returns the size in bytes of the table built by get_window_table.
+ */
+template<typename T>
+size_t window_table_size_in_bytes(const size_t scalar_size, const size_t window);
+
+/**
+ * Returns the largest window size, at most window, whose table takes at
+ * most max_table_bytes (or 1 if there is none).
+ */
+template<typename T>
+size_t fit_window_size(const size_t scalar_size, const size_t window, const size_t max_table_bytes);
+
 /**
  * Compute table of window sizes.
  */
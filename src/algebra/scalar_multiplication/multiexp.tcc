@@ -20,7 +20,9 @@
 #include <cassert>
 #include <type_traits>
 
+#include "common/numa_placement.hpp"
 #include "common/profiling.hpp"
+#include "common/prover_config.hpp"
 #include "common/utils.hpp"
 #include "algebra/scalar_multiplication/wnaf.hpp"
 
@@ -168,11 +170,12 @@ T multi_exp_inner(typename std::vector<T>::const_iterator vec_start,
         return (*scalar_start)*(*vec_start);
     }
 
-    std::vector<ordered_exponent<n> > opt_q;
+    /* both are accessed at random offsets, so they may be backed by huge pages */
+    huge_page_vector<ordered_exponent<n> > opt_q;
     const size_t vec_len = scalar_end - scalar_start;
     const size_t odd_vec_len = (vec_len % 2 == 1 ? vec_len : vec_len + 1);
     opt_q.reserve(odd_vec_len);
-    std::vector<T> g;
+    huge_page_vector<T> g;
     g.reserve(odd_vec_len);
 
     typename std::vector<T>::const_iterator vec_it;
@@ -280,6 +283,24 @@ T multi_exp(typename std::vector<T>::const_iterator vec_start,
         return naive_exp<T, FieldT>(vec_start, vec_end, scalar_start, scalar_end);
     }
 
+    if (use_multiexp && !active_prover_config.fits_scratch_budget(total * (sizeof(T) + sizeof(ordered_exponent<FieldT::num_limbs>))))
+    {
+        /* Bos-Coster would exceed the scratch budget, so use the bucket method, which does not copy the bases */
+        std::vector<std::vector<bigint<FieldT::num_limbs> > > exponents(1, std::vector<bigint<FieldT::num_limbs> >(total));
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t j = 0; j < total; ++j)
+        {
+            exponents[0][j] = (scalar_start + j)->as_bigint();
+        }
+
+        return multi_scalar_bucket_exp<T>(total,
+                                          [vec_start](const size_t j) -> const T& { return *(vec_start + j); },
+                                          exponents, FieldT::size_in_bits(), chunks,
+                                          [](const T &sum, const T &base) { return sum + base; })[0];
+    }
+
     const size_t one = total/chunks;
 
     std::vector<T> partial(chunks, T::zero());
@@ -287,7 +308,7 @@ T multi_exp(typename std::vector<T>::const_iterator vec_start,
     if (use_multiexp)
     {
 #ifdef MULTICORE
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
         for (size_t i = 0; i < chunks; ++i)
         {
@@ -300,7 +321,7 @@ T multi_exp(typename std::vector<T>::const_iterator vec_start,
     else
     {
 #ifdef MULTICORE
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
         for (size_t i = 0; i < chunks; ++i)
         {
@@ -311,14 +332,446 @@ T multi_exp(typename std::vector<T>::const_iterator vec_start,
         }
     }
 
-    T final = T::zero();
+    return tree_sum<T>(std::move(partial));
+}
+
+template<typename T, typename FieldT>
+size_t multi_exp_scratch_size_in_bytes(const size_t num_terms)
+{
+    const size_t bos_coster_bytes = num_terms * (sizeof(T) + sizeof(ordered_exponent<FieldT::num_limbs>));
+    if (active_prover_config.fits_scratch_budget(bos_coster_bytes))
+    {
+        return bos_coster_bytes;
+    }
+
+    const size_t chunks = active_prover_config.multiexp_chunks();
+    const size_t c = max_bucket_window_size(div_ceil(chunks * sizeof(T), 2));
+    return num_terms * sizeof(bigint<FieldT::num_limbs>) + chunks * ((1ul << (c - 1)) + 1) * sizeof(T);
+}
+
+template<typename T>
+T tree_sum(std::vector<T> terms)
+{
+    const size_t n = terms.size();
+    for (size_t stride = 1; stride < n; stride *= 2)
+    {
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t i = 0; i < n - stride; i += 2 * stride)
+        {
+            terms[i] = terms[i] + terms[i + stride];
+        }
+    }
+
+    return (n == 0 ? T::zero() : terms[0]);
+}
+
+inline size_t split_scalar_statistics::max_small_bit_length() const
+{
+    size_t result = small_bit_lengths.size();
+    while (result > 0 && small_bit_lengths[result - 1] == 0)
+    {
+        --result;
+    }
+    return (result == 0 ? 0 : result - 1);
+}
+
+inline void split_scalar_statistics::print() const
+{
+    const size_t total = num_skip + num_add + num_small + num_other;
+    print_indent(); printf("* Elements of w skipped: %zu (%0.2f%%)\n", num_skip, 100.*num_skip/total);
+    print_indent(); printf("* Elements of w processed with special addition: %zu (%0.2f%%)\n", num_add, 100.*num_add/total);
+    print_indent(); printf("* Elements of w with small scalars: %zu (%0.2f%%)\n", num_small, 100.*num_small/total);
+    if (num_small > 0)
+    {
+        print_indent(); printf("  (bit lengths:");
+        for (size_t b = 0; b < small_bit_lengths.size(); ++b)
+        {
+            if (small_bit_lengths[b] > 0)
+            {
+                printf(" %zu: %0.2f%%", b, 100.*small_bit_lengths[b]/num_small);
+            }
+        }
+        printf(")\n");
+    }
+    print_indent(); printf("* Elements of w remaining: %zu (%0.2f%%)\n", num_other, 100.*num_other/total);
+}
+
+template<typename T, typename FieldT, typename BaseAt, typename ScalarAt, typename AddBase>
+T split_scalar_vector(const size_t n,
+                      BaseAt base_at,
+                      ScalarAt scalar_at,
+                      AddBase add_base,
+                      std::vector<T> &bases,
+                      std::vector<FieldT> &scalars,
+                      std::vector<T> &small_bases,
+                      std::vector<size_t> &small_scalars,
+                      const size_t small_scalar_bits,
+                      const size_t num_blocks,
+                      split_scalar_statistics &stats)
+{
+    assert(small_scalar_bits < 8 * sizeof(size_t));
+
+    enum { kind_skip, kind_add, kind_small, kind_other };
+
+    const FieldT zero = FieldT::zero();
+    const FieldT one = FieldT::one();
+
+    const size_t blocks = std::max<size_t>(1, std::min(num_blocks, n));
+    std::vector<unsigned char> kind(n);
+    std::vector<T> block_acc(blocks, T::zero());
+    std::vector<split_scalar_statistics> block_stats(blocks);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        const size_t begin = b * n / blocks, end = (b + 1) * n / blocks;
+        split_scalar_statistics &st = block_stats[b];
+        st.small_bit_lengths.resize(small_scalar_bits + 1, 0);
+
+        T acc = T::zero();
+        for (size_t j = begin; j < end; ++j)
+        {
+            const FieldT &scalar = scalar_at(j);
+            if (scalar == zero)
+            {
+                kind[j] = kind_skip;
+                ++st.num_skip;
+            }
+            else if (scalar == one)
+            {
+                kind[j] = kind_add;
+                acc = add_base(acc, base_at(j));
+                ++st.num_add;
+            }
+            else
+            {
+                const size_t bits = scalar.as_bigint().num_bits();
+                if (bits <= small_scalar_bits)
+                {
+                    kind[j] = kind_small;
+                    ++st.num_small;
+                    ++st.small_bit_lengths[bits];
+                }
+                else
+                {
+                    kind[j] = kind_other;
+                    ++st.num_other;
+                }
+            }
+        }
+        block_acc[b] = acc;
+    }
+
+    /* block_offset[b] and block_small_offset[b] are where block b writes its pairs */
+    std::vector<size_t> block_offset(blocks + 1, 0);
+    std::vector<size_t> block_small_offset(blocks + 1, 0);
+    stats = split_scalar_statistics();
+    stats.small_bit_lengths.resize(small_scalar_bits + 1, 0);
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        const split_scalar_statistics &st = block_stats[b];
+        stats.num_skip += st.num_skip;
+        stats.num_add += st.num_add;
+        stats.num_small += st.num_small;
+        stats.num_other += st.num_other;
+        for (size_t i = 0; i <= small_scalar_bits; ++i)
+        {
+            stats.small_bit_lengths[i] += st.small_bit_lengths[i];
+        }
 
-    for (size_t i = 0; i < chunks; ++i)
+        block_offset[b + 1] = block_offset[b] + st.num_other;
+        block_small_offset[b + 1] = block_small_offset[b] + st.num_small;
+    }
+
+    bases.resize(stats.num_other);
+    scalars.resize(stats.num_other);
+    small_bases.resize(stats.num_small);
+    small_scalars.resize(stats.num_small);
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t b = 0; b < blocks; ++b)
     {
-        final = final + partial[i];
+        const size_t begin = b * n / blocks, end = (b + 1) * n / blocks;
+        size_t pos = block_offset[b];
+        size_t small_pos = block_small_offset[b];
+        for (size_t j = begin; j < end; ++j)
+        {
+            if (kind[j] == kind_other)
+            {
+                bases[pos] = base_at(j);
+                scalars[pos] = scalar_at(j);
+                ++pos;
+            }
+            else if (kind[j] == kind_small)
+            {
+                small_bases[small_pos] = base_at(j);
+                small_scalars[small_pos] = scalar_at(j).as_bigint().as_ulong();
+                ++small_pos;
+            }
+        }
+    }
+
+    /* resize value-initialized the copies on the calling thread, which also placed all their pages */
+    numa_place_vector(bases);
+    numa_place_vector(small_bases);
+
+    return tree_sum<T>(std::move(block_acc));
+}
+
+template<typename T, typename AddBase>
+T small_scalar_multi_exp(const std::vector<T> &bases,
+                         const std::vector<size_t> &scalars,
+                         const size_t scalar_bits,
+                         const size_t chunks,
+                         AddBase add_base)
+{
+    assert(bases.size() == scalars.size());
+
+    const size_t n = bases.size();
+    if (n == 0 || scalar_bits == 0)
+    {
+        return T::zero();
+    }
+
+    const size_t num_ranges = std::max<size_t>(1, std::min(chunks, n));
+    const size_t range_size = div_ceil(n, num_ranges);
+
+    const size_t c = bucket_window_size(scalar_bits, range_size, max_bucket_window_size(num_ranges * sizeof(T)));
+    const size_t num_windows = div_ceil(scalar_bits, c);
+
+    std::vector<T> partial(num_ranges, T::zero());
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t r = 0; r < num_ranges; ++r)
+    {
+        const size_t begin = r * n / num_ranges, end = (r + 1) * n / num_ranges;
+        std::vector<T> buckets(1ul << c);
+
+        T result = T::zero();
+        for (size_t w = num_windows; w-- > 0; )
+        {
+            for (size_t i = 0; i < c; ++i)
+            {
+                result = result.dbl();
+            }
+
+            std::fill(buckets.begin(), buckets.end(), T::zero());
+            for (size_t j = begin; j < end; ++j)
+            {
+                const size_t digit = (scalars[j] >> (w * c)) & ((1ul << c) - 1);
+                if (digit != 0)
+                {
+                    buckets[digit] = add_base(buckets[digit], bases[j]);
+                }
+            }
+
+            /* sum_k k * buckets[k], as a sum of running sums */
+            T running = T::zero();
+            for (size_t k = buckets.size() - 1; k > 0; --k)
+            {
+                running = running + buckets[k];
+                result = result + running;
+            }
+        }
+        partial[r] = result;
     }
 
-    return final;
+    return tree_sum<T>(std::move(partial));
+}
+
+inline size_t bucket_window_size(const size_t num_bits, const size_t num_terms, const size_t max_window)
+{
+    size_t c = 1;
+    size_t best_cost = 0;
+    for (size_t w = 1; w <= std::min(num_bits, max_window); ++w)
+    {
+        const size_t cost = div_ceil(num_bits, w) * (num_terms + (2ul << w));
+        if (w == 1 || cost < best_cost)
+        {
+            c = w;
+            best_cost = cost;
+        }
+    }
+    return c;
+}
+
+inline size_t max_bucket_window_size(const size_t bucket_bytes)
+{
+    size_t c = bucket_max_window_size;
+    while (c > 1 && !active_prover_config.fits_scratch_budget((1ul << c) * bucket_bytes))
+    {
+        --c;
+    }
+    return c;
+}
+
+/* the c-bit digit of b starting at bit offset (bits past the top limb are zero) */
+template<mp_size_t n>
+inline size_t bigint_window(const bigint<n> &b, const size_t offset, const size_t c)
+{
+    const size_t limb = offset / GMP_NUMB_BITS, shift = offset % GMP_NUMB_BITS;
+    mp_limb_t digit = (limb < n ? b.data[limb] >> shift : 0);
+    if (shift + c > GMP_NUMB_BITS && limb + 1 < n)
+    {
+        digit |= b.data[limb + 1] << (GMP_NUMB_BITS - shift);
+    }
+    return digit & ((mp_limb_t(1) << c) - 1);
+}
+
+template<typename T, mp_size_t n, typename BaseAt, typename AddBase>
+std::vector<T> multi_scalar_bucket_exp(const size_t num_bases,
+                                       BaseAt base_at,
+                                       const std::vector<std::vector<bigint<n> > > &exponents,
+                                       const size_t num_bits,
+                                       const size_t chunks,
+                                       AddBase add_base)
+{
+    const size_t k = exponents.size();
+    for (size_t i = 0; i < k; ++i)
+    {
+        assert(exponents[i].size() == num_bases);
+    }
+
+    if (num_bases == 0 || k == 0)
+    {
+        return std::vector<T>(k, T::zero());
+    }
+
+    /*
+      The exponents are recoded into signed c-bit digits in (-2^(c-1), 2^(c-1)],
+      so each window needs only 2^(c-1) buckets per exponent vector: a negative
+      digit adds the negated base. With n terms a window costs n + 2^c additions,
+      which is minimized as the unsigned cost with 2n terms. One window more
+      than ceil(num_bits/c) absorbs the final carry.
+    */
+    const size_t num_ranges = std::max<size_t>(1, std::min(chunks, num_bases));
+    const size_t c = bucket_window_size(num_bits, 2 * div_ceil(num_bases, num_ranges),
+                                        max_bucket_window_size(div_ceil(num_ranges * k * sizeof(T), 2)));
+    const size_t num_windows = num_bits / c + 1;
+    const size_t half = 1ul << (c - 1);
+
+    std::vector<std::vector<T> > partial(num_ranges);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t r = 0; r < num_ranges; ++r)
+    {
+        const size_t begin = r * num_bases / num_ranges, end = (r + 1) * num_bases / num_ranges;
+        /* buckets[i * (half + 1) + d] is the bucket of digit +-d for exponent vector i */
+        huge_page_vector<T> buckets(k * (half + 1));
+        /* carries[i * (end - begin) + (j - begin)] is the carry into the current window */
+        std::vector<uint8_t> carries(k * (end - begin), 0);
+        /* window_sums[w * k + i] is the contribution of window w to exponent vector i */
+        std::vector<T> window_sums(num_windows * k);
+
+        for (size_t w = 0; w < num_windows; ++w)
+        {
+            std::fill(buckets.begin(), buckets.end(), T::zero());
+            for (size_t j = begin; j < end; ++j)
+            {
+                const T &base = base_at(j);
+                for (size_t i = 0; i < k; ++i)
+                {
+                    uint8_t &carry = carries[i * (end - begin) + (j - begin)];
+                    const size_t digit = bigint_window<n>(exponents[i][j], w * c, c) + carry;
+                    carry = (digit > half);
+                    if (digit == 0 || digit == 2 * half)
+                    {
+                        continue;
+                    }
+
+                    if (digit <= half)
+                    {
+                        T &bucket = buckets[i * (half + 1) + digit];
+                        bucket = add_base(bucket, base);
+                    }
+                    else
+                    {
+                        T &bucket = buckets[i * (half + 1) + (2 * half - digit)];
+                        bucket = add_base(bucket, -base);
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                /* sum_d d * buckets[d], as a sum of running sums */
+                T running = T::zero();
+                T sum = T::zero();
+                for (size_t d = half; d > 0; --d)
+                {
+                    running = running + buckets[i * (half + 1) + d];
+                    sum = sum + running;
+                }
+                window_sums[w * k + i] = sum;
+            }
+        }
+
+        std::vector<T> result(k, T::zero());
+        for (size_t i = 0; i < k; ++i)
+        {
+            for (size_t w = num_windows; w-- > 0; )
+            {
+                for (size_t b = 0; b < c; ++b)
+                {
+                    result[i] = result[i].dbl();
+                }
+                result[i] = result[i] + window_sums[w * k + i];
+            }
+        }
+        partial[r] = std::move(result);
+    }
+
+    std::vector<T> results(k);
+    for (size_t i = 0; i < k; ++i)
+    {
+        std::vector<T> terms(num_ranges);
+        for (size_t r = 0; r < num_ranges; ++r)
+        {
+            terms[r] = partial[r][i];
+        }
+        results[i] = tree_sum<T>(std::move(terms));
+    }
+
+    return results;
+}
+
+template<typename T, typename FieldT>
+std::vector<T> multi_exp_multi_scalar(typename std::vector<T>::const_iterator vec_start,
+                                      typename std::vector<T>::const_iterator vec_end,
+                                      const std::vector<typename std::vector<FieldT>::const_iterator> &scalar_starts,
+                                      const size_t chunks)
+{
+    const size_t num_bases = vec_end - vec_start;
+    std::vector<std::vector<bigint<FieldT::num_limbs> > > exponents(scalar_starts.size(), std::vector<bigint<FieldT::num_limbs> >(num_bases));
+    for (size_t i = 0; i < scalar_starts.size(); ++i)
+    {
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t j = 0; j < num_bases; ++j)
+        {
+            exponents[i][j] = (scalar_starts[i] + j)->as_bigint();
+        }
+    }
+
+    return multi_scalar_bucket_exp<T>(num_bases,
+                                      [vec_start](const size_t j) -> const T& { return *(vec_start + j); },
+                                      exponents, FieldT::size_in_bits(), chunks,
+                                      [](const T &sum, const T &base) {
+#ifdef USE_MIXED_ADDITION
+                                          return sum.mixed_add(base);
+#else
+                                          return sum + base;
+#endif
+                                      });
 }
 
 template<typename T, typename FieldT>
@@ -330,50 +783,110 @@ T multi_exp_with_mixed_addition(typename std::vector<T>::const_iterator vec_star
                                   const bool use_multiexp)
 {
     enter_block("Process scalar vector");
-    auto value_it = vec_start;
-    auto scalar_it = scalar_start;
-
-    const FieldT zero = FieldT::zero();
-    const FieldT one = FieldT::one();
     std::vector<FieldT> p;
     std::vector<T> g;
 
-    T acc = T::zero();
+    const auto add_base = [](const T &sum, const T &base) {
+#ifdef USE_MIXED_ADDITION
+        return sum.mixed_add(base);
+#else
+        return sum + base;
+#endif
+    };
+
+    std::vector<size_t> small_p;
+    std::vector<T> small_g;
+    split_scalar_statistics stats;
+    const T acc = split_scalar_vector<T, FieldT>(scalar_end - scalar_start,
+                                                 [vec_start](const size_t j) -> const T& { return *(vec_start + j); },
+                                                 [scalar_start](const size_t j) -> const FieldT& { return *(scalar_start + j); },
+                                                 add_base, g, p, small_g, small_p,
+                                                 use_multiexp ? multi_exp_small_scalar_bits : 0, chunks, stats);
+    stats.print();
+
+    leave_block("Process scalar vector");
 
-    size_t num_skip = 0;
-    size_t num_add = 0;
-    size_t num_other = 0;
+    return acc + small_scalar_multi_exp<T>(small_g, small_p, stats.max_small_bit_length(), chunks, add_base) +
+        multi_exp<T, FieldT>(g.begin(), g.end(), p.begin(), p.end(), chunks, use_multiexp);
+}
 
-    for (; scalar_it != scalar_end; ++scalar_it, ++value_it)
+template<typename T, typename FieldT>
+T cyclotomic_multi_exp(typename std::vector<T>::const_iterator vec_start,
+                       typename std::vector<T>::const_iterator vec_end,
+                       typename std::vector<FieldT>::const_iterator scalar_start,
+                       typename std::vector<FieldT>::const_iterator scalar_end)
+{
+    const size_t length = vec_end - vec_start;
+    assert(length == (size_t)(scalar_end - scalar_start));
+
+    /*
+      Per base, a window of w costs 2^(w-1) multiplications for the table of odd
+      powers, plus about scalar_bits/(w+2) for the nonzero wNAF digits.
+    */
+    const size_t scalar_bits = FieldT::size_in_bits();
+    size_t window = 1;
+    for (size_t w = 2; w <= 8; ++w)
     {
-        if (*scalar_it == zero)
+        if ((1ul<<(w-1)) + scalar_bits/(w+2) < (1ul<<(window-1)) + scalar_bits/(window+2))
         {
-            // do nothing
-            ++num_skip;
+            window = w;
         }
-        else if (*scalar_it == one)
+    }
+
+    std::vector<std::vector<long> > wnafs;
+    std::vector<std::vector<T> > tables;
+    wnafs.reserve(length);
+    tables.reserve(length);
+    size_t wnaf_length = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        const bigint<FieldT::num_limbs> scalar = (scalar_start + i)->as_bigint();
+        if (scalar.is_zero())
         {
-#ifdef USE_MIXED_ADDITION
-            acc = acc.mixed_add(*value_it);
-#else
-            acc = acc + (*value_it);
-#endif
-            ++num_add;
+            continue;
         }
-        else
+
+        wnafs.emplace_back(find_wnaf(window, scalar));
+        wnaf_length = std::max(wnaf_length, wnafs.back().size());
+
+        /* table[j] = base^(2j+1) */
+        const T &base = *(vec_start + i);
+        const T base_squared = base.cyclotomic_squared();
+        std::vector<T> table(1ul<<(window-1));
+        table[0] = base;
+        for (size_t j = 1; j < table.size(); ++j)
         {
-            p.emplace_back(*scalar_it);
-            g.emplace_back(*value_it);
-            ++num_other;
+            table[j] = table[j-1] * base_squared;
         }
+        tables.emplace_back(std::move(table));
     }
-    print_indent(); printf("* Elements of w skipped: %zu (%0.2f%%)\n", num_skip, 100.*num_skip/(num_skip+num_add+num_other));
-    print_indent(); printf("* Elements of w processed with special addition: %zu (%0.2f%%)\n", num_add, 100.*num_add/(num_skip+num_add+num_other));
-    print_indent(); printf("* Elements of w remaining: %zu (%0.2f%%)\n", num_other, 100.*num_other/(num_skip+num_add+num_other));
 
-    leave_block("Process scalar vector");
+    T result = T::one();
+    bool found_nonzero = false;
+    for (long j = wnaf_length - 1; j >= 0; --j)
+    {
+        if (found_nonzero)
+        {
+            result = result.cyclotomic_squared();
+        }
 
-    return acc + multi_exp<T, FieldT>(g.begin(), g.end(), p.begin(), p.end(), chunks, use_multiexp);
+        for (size_t i = 0; i < wnafs.size(); ++i)
+        {
+            const long digit = ((size_t)j < wnafs[i].size() ? wnafs[i][j] : 0);
+            if (digit > 0)
+            {
+                found_nonzero = true;
+                result = result * tables[i][digit/2];
+            }
+            else if (digit < 0)
+            {
+                found_nonzero = true;
+                result = result * tables[i][(-digit)/2].unitary_inverse();
+            }
+        }
+    }
+
+    return result;
 }
 
 template<typename T>
@@ -414,6 +927,23 @@ size_t get_exp_window_size(const size_t num_scalars)
     return window;
 }
 
+template<typename T>
+size_t window_table_size_in_bytes(const size_t scalar_size, const size_t window)
+{
+    return div_ceil(scalar_size, window) * (1ul << window) * sizeof(T);
+}
+
+template<typename T>
+size_t fit_window_size(const size_t scalar_size, const size_t window, const size_t max_table_bytes)
+{
+    size_t result = window;
+    while (result > 1 && window_table_size_in_bytes<T>(scalar_size, result) > max_table_bytes)
+    {
+        --result;
+    }
+    return result;
+}
+
 template<typename T>
 window_table<T> get_window_table(const size_t scalar_size,
                                  const size_t window,
@@ -429,7 +959,7 @@ window_table<T> get_window_table(const size_t scalar_size,
     }
 #endif
 
-    window_table<T> powers_of_g(outerc, std::vector<T>(in_window, T::zero()));
+    window_table<T> powers_of_g(outerc, huge_page_vector<T>(in_window, T::zero()));
 
     T gouter = g;
 
@@ -0,0 +1,135 @@
+/** @file
+ *****************************************************************************
+
+ Compares evaluating a sparse knowledge-commitment query (like the A and C
+ queries of an r1cs_ppzksnark proving key) against several witnesses, once
+ with a separate kc_multi_exp_with_mixed_addition per witness, and once with
+ kc_multi_exp_multi_scalar, which reads the query a single time for all of
+ them. The same comparison is made for a dense vector of G1 bases.
+
+ The command
+
+     $ src/algebra/scalar_multiplication/profiling/profile_multi_scalar_multiexp 16 4 8
+
+ profiles queries of size 2^16 against 4 witnesses, in 8 chunks.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "algebra/scalar_multiplication/kc_multiexp.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
+
+using namespace libsnark;
+
+template<typename GroupT, typename FieldT>
+void profile_dense(const size_t n, const size_t num_vectors, const size_t chunks)
+{
+    std::vector<GroupT> bases;
+    for (size_t i = 0; i < n; ++i)
+    {
+        bases.emplace_back(i < 16 ? GroupT::random_element() : bases[i % 16] + bases[(i / 16) % 16]);
+    }
+    batch_to_special<GroupT>(bases);
+
+    std::vector<std::vector<FieldT> > scalars;
+    std::vector<typename std::vector<FieldT>::const_iterator> scalar_starts;
+    for (size_t k = 0; k < num_vectors; ++k)
+    {
+        scalars.emplace_back(random_field_elements<FieldT>(n));
+        scalar_starts.emplace_back(scalars.back().begin());
+    }
+
+    long long start = get_nsec_time();
+    std::vector<GroupT> separate;
+    for (size_t k = 0; k < num_vectors; ++k)
+    {
+        separate.emplace_back(multi_exp<GroupT, FieldT>(bases.begin(), bases.end(), scalars[k].begin(), scalars[k].end(), chunks, true));
+    }
+    const long long separate_time = get_nsec_time() - start;
+
+    start = get_nsec_time();
+    const std::vector<GroupT> batched = multi_exp_multi_scalar<GroupT, FieldT>(bases.begin(), bases.end(), scalar_starts, chunks);
+    const long long batched_time = get_nsec_time() - start;
+    assert(batched == separate);
+
+    printf("dense G1,    %zu x %zu: separate %10.3f ms, one pass %10.3f ms (speedup %0.2fx)\n",
+           num_vectors, n, separate_time * 1e-6, batched_time * 1e-6, 1. * separate_time / batched_time);
+}
+
+template<typename GroupT, typename FieldT>
+void profile_sparse_kc(const size_t n, const size_t num_vectors, const size_t chunks)
+{
+    /* a query over a domain of size 2n, with about half of the entries present */
+    knowledge_commitment_vector<GroupT, GroupT> query;
+    query.domain_size_ = 2 * n;
+    std::vector<knowledge_commitment<GroupT, GroupT> > values;
+    for (size_t i = 0; i < 2 * n; ++i)
+    {
+        if (std::rand() % 2 == 0)
+        {
+            query.indices.emplace_back(i);
+            values.emplace_back(query.indices.size() <= 16 ?
+                                knowledge_commitment<GroupT, GroupT>(GroupT::random_element(), GroupT::random_element()) :
+                                values[values.size() % 16] + values[(values.size() / 16) % 16]);
+        }
+    }
+    kc_batch_to_special<GroupT, GroupT>(values);
+    query.values = std::move(values);
+
+    /* full witness vectors, as the prover passes them, with the constant term first */
+    std::vector<std::vector<FieldT> > scalars;
+    std::vector<typename std::vector<FieldT>::const_iterator> scalar_starts;
+    for (size_t k = 0; k < num_vectors; ++k)
+    {
+        scalars.emplace_back(random_field_elements<FieldT>(2 * n));
+        scalar_starts.emplace_back(scalars.back().begin());
+    }
+
+    long long start = get_nsec_time();
+    std::vector<knowledge_commitment<GroupT, GroupT> > separate;
+    for (size_t k = 0; k < num_vectors; ++k)
+    {
+        separate.emplace_back(kc_multi_exp_with_mixed_addition<GroupT, GroupT, FieldT>(query, 0, 2 * n,
+                                                                                       scalars[k].begin(), scalars[k].end(),
+                                                                                       chunks, true));
+    }
+    const long long separate_time = get_nsec_time() - start;
+
+    start = get_nsec_time();
+    const std::vector<knowledge_commitment<GroupT, GroupT> > batched =
+        kc_multi_exp_multi_scalar<GroupT, GroupT, FieldT>(query, 0, 2 * n, scalar_starts, chunks);
+    const long long batched_time = get_nsec_time() - start;
+    assert(batched == separate);
+
+    printf("sparse kc,   %zu x %zu: separate %10.3f ms, one pass %10.3f ms (speedup %0.2fx)\n",
+           num_vectors, query.size(), separate_time * 1e-6, batched_time * 1e-6, 1. * separate_time / batched_time);
+}
+
+int main(int argc, const char * argv[])
+{
+    default_ec_pp::init_public_params();
+    start_profiling();
+    inhibit_profiling_info = true;
+
+    if (argc != 4)
+    {
+        printf("usage: %s log_size num_vectors chunks\n", argv[0]);
+        return 1;
+    }
+
+    const size_t n = 1ul << atoi(argv[1]);
+    const size_t num_vectors = atoi(argv[2]);
+    const size_t chunks = atoi(argv[3]);
+
+    profile_dense<G1<default_ec_pp>, Fr<default_ec_pp> >(n, num_vectors, chunks);
+    profile_sparse_kc<G1<default_ec_pp>, Fr<default_ec_pp> >(n, num_vectors, chunks);
+}
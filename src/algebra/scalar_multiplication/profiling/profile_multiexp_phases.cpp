@@ -0,0 +1,152 @@
+/** @file
+ *****************************************************************************
+
+ Times the phases of multi_exp_with_mixed_addition separately: the scan that
+ splits the scalars into 0/1/small/other (split_scalar_vector), the bucket
+ pass over the small scalars (against a plain multi_exp of the same pairs),
+ the chunked multi-exponentiation, and the final reduction of the per-chunk
+ results (tree_sum).
+
+ When built with MULTICORE=1, each phase is run with one thread and with all
+ threads, and its serial fraction is estimated with the Karp-Flatt metric
+ e = (1/S - 1/p) / (1 - 1/p), where S is the speedup on p threads.
+
+ The command
+
+     $ src/algebra/scalar_multiplication/profiling/profile_multiexp_phases 18 64
+
+ profiles a multi-exponentiation of size 2^18, in 64 chunks.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "algebra/scalar_multiplication/multiexp.hpp"
+
+using namespace libsnark;
+
+long long time_phase(const std::function<void()> &phase)
+{
+    const long long start = get_nsec_time();
+    phase();
+    return get_nsec_time() - start;
+}
+
+void report_phase(const std::string &name, const std::function<void()> &phase)
+{
+#ifdef MULTICORE
+    const int num_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    const long long serial_time = time_phase(phase);
+    omp_set_num_threads(num_threads);
+    const long long parallel_time = time_phase(phase);
+
+    const double speedup = 1. * serial_time / parallel_time;
+    printf("%-22s: %10.3f ms on 1 thread, %10.3f ms on %d threads (speedup %5.2fx",
+           name.c_str(), serial_time * 1e-6, parallel_time * 1e-6, num_threads, speedup);
+    if (num_threads > 1)
+    {
+        const double p = num_threads;
+        printf(", serial fraction %0.3f", (1. / speedup - 1. / p) / (1. - 1. / p));
+    }
+    printf(")\n");
+#else
+    printf("%-22s: %10.3f ms\n", name.c_str(), time_phase(phase) * 1e-6);
+#endif
+}
+
+template<typename GroupT, typename FieldT>
+void profile_phases(const size_t n, const size_t chunks)
+{
+    std::vector<GroupT> bases;
+    std::vector<FieldT> scalars;
+    for (size_t i = 0; i < n; ++i)
+    {
+        bases.emplace_back(i < 16 ? GroupT::random_element() : bases[i % 16] + bases[(i / 16) % 16]);
+        /* a witness-like mix: a quarter each of zeros, ones, small (up to 16-bit) and full scalars */
+        const size_t kind = i % 4;
+        scalars.emplace_back(kind == 0 ? FieldT::zero() :
+                             kind == 1 ? FieldT::one() :
+                             kind == 2 ? FieldT(2 + std::rand() % ((1 << 16) - 2)) :
+                             FieldT::random_element());
+    }
+    batch_to_special<GroupT>(bases);
+
+    std::vector<GroupT> g, small_g;
+    std::vector<FieldT> p;
+    std::vector<size_t> small_p;
+    split_scalar_statistics stats;
+    const auto add_base = [](const GroupT &sum, const GroupT &base) { return sum.mixed_add(base); };
+    GroupT acc;
+    report_phase("split_scalar_vector", [&]() {
+            acc = split_scalar_vector<GroupT, FieldT>(n,
+                                                      [&bases](const size_t j) -> const GroupT& { return bases[j]; },
+                                                      [&scalars](const size_t j) -> const FieldT& { return scalars[j]; },
+                                                      add_base, g, p, small_g, small_p,
+                                                      multi_exp_small_scalar_bits, chunks, stats);
+        });
+    stats.print();
+
+    GroupT small_result;
+    report_phase("small scalar buckets", [&]() {
+            small_result = small_scalar_multi_exp<GroupT>(small_g, small_p, stats.max_small_bit_length(), chunks, add_base);
+        });
+
+    std::vector<FieldT> small_p_as_field;
+    for (const size_t s : small_p)
+    {
+        small_p_as_field.emplace_back(FieldT(s));
+    }
+    GroupT small_reference;
+    report_phase("(small via multi_exp)", [&]() {
+            small_reference = multi_exp<GroupT, FieldT>(small_g.begin(), small_g.end(), small_p_as_field.begin(), small_p_as_field.end(), chunks, true);
+        });
+    assert(small_result == small_reference);
+
+    GroupT result;
+    report_phase("chunked multi_exp", [&]() {
+            result = multi_exp<GroupT, FieldT>(g.begin(), g.end(), p.begin(), p.end(), chunks, true);
+        });
+
+    std::vector<GroupT> partial;
+    for (size_t i = 0; i < chunks; ++i)
+    {
+        partial.emplace_back(bases[i % n]);
+    }
+    report_phase("tree_sum of partials", [&]() {
+            tree_sum<GroupT>(partial);
+        });
+
+    const GroupT expected = multi_exp_with_mixed_addition<GroupT, FieldT>(bases.begin(), bases.end(), scalars.begin(), scalars.end(), chunks, true);
+    assert(acc + small_result + result == expected);
+}
+
+int main(int argc, const char * argv[])
+{
+    default_ec_pp::init_public_params();
+    start_profiling();
+    inhibit_profiling_info = true;
+
+    if (argc != 3)
+    {
+        printf("usage: %s log_size chunks\n", argv[0]);
+        return 1;
+    }
+
+    const size_t n = 1ul << atoi(argv[1]);
+    const size_t chunks = atoi(argv[2]);
+
+    profile_phases<G1<default_ec_pp>, Fr<default_ec_pp> >(n, chunks);
+}
@@ -0,0 +1,66 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of an allocator that returns memory aligned to a given boundary
+ (by default, a cache line), for std::vector's of data that is streamed by
+ hot loops.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef ALIGNED_ALLOCATOR_HPP_
+#define ALIGNED_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace libsnark {
+
+const size_t cache_line_size = 64;
+
+template<typename T, size_t alignment = cache_line_size>
+class aligned_allocator {
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind {
+        typedef aligned_allocator<U, alignment> other;
+    };
+
+    aligned_allocator() {}
+    template<typename U>
+    aligned_allocator(const aligned_allocator<U, alignment> &other) {}
+
+    T* allocate(const size_t n)
+    {
+        void *p = NULL;
+        if (n == 0)
+        {
+            return NULL;
+        }
+        if (n > ((size_t) -1) / sizeof(T) || posix_memalign(&p, alignment, n * sizeof(T)) != 0)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T *p, const size_t n)
+    {
+        free(p);
+    }
+
+    template<typename U>
+    bool operator==(const aligned_allocator<U, alignment> &other) const { return true; }
+    template<typename U>
+    bool operator!=(const aligned_allocator<U, alignment> &other) const { return false; }
+};
+
+} // libsnark
+
+#endif // ALIGNED_ALLOCATOR_HPP_
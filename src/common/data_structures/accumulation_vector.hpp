@@ -59,6 +59,20 @@ public:
                                             const typename std::vector<FieldT>::const_iterator &it_end,
                                             const size_t offset) const;
 
+    /* accumulate several (offset, values) chunks at once; see sparse_vector::accumulate_chunks */
+    template<typename FieldT>
+    accumulation_vector<T> accumulate_chunks(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const;
+
+    /* return only the accumulation value that accumulate_chunk would produce, without copying the sparse vector */
+    template<typename FieldT>
+    T accumulate_chunk_value(const typename std::vector<FieldT>::const_iterator &it_begin,
+                             const typename std::vector<FieldT>::const_iterator &it_end,
+                             const size_t offset) const;
+
+    /* return only the accumulation value that accumulate_chunks would produce, without copying the sparse vector */
+    template<typename FieldT>
+    T accumulate_chunks_value(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const;
+
 };
 
 template<typename T>
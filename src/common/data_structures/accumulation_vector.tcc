@@ -59,6 +59,31 @@ accumulation_vector<T> accumulation_vector<T>::accumulate_chunk(const typename s
     return accumulation_vector<T>(std::move(new_first), std::move(acc_result.second));
 }
 
+template<typename T>
+template<typename FieldT>
+accumulation_vector<T> accumulation_vector<T>::accumulate_chunks(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const
+{
+    std::pair<T, sparse_vector<T> > acc_result = rest.template accumulate_chunks<FieldT>(chunks);
+    T new_first = first + acc_result.first;
+    return accumulation_vector<T>(std::move(new_first), std::move(acc_result.second));
+}
+
+template<typename T>
+template<typename FieldT>
+T accumulation_vector<T>::accumulate_chunk_value(const typename std::vector<FieldT>::const_iterator &it_begin,
+                                                 const typename std::vector<FieldT>::const_iterator &it_end,
+                                                 const size_t offset) const
+{
+    return first + rest.template accumulate_value<FieldT>(it_begin, it_end, offset);
+}
+
+template<typename T>
+template<typename FieldT>
+T accumulation_vector<T>::accumulate_chunks_value(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const
+{
+    return first + rest.template accumulate_chunks_value<FieldT>(chunks);
+}
+
 template<typename T>
 std::ostream& operator<<(std::ostream& out, const accumulation_vector<T> &v)
 {
@@ -0,0 +1,185 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of interfaces for a word-packed bit vector.
+
+ See packed_bit_vector.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "common/data_structures/packed_bit_vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace libsnark {
+
+const size_t packed_bit_vector::word_bits;
+
+packed_bit_vector::packed_bit_vector(const size_t num_bits, const bool value) :
+    words(div_ceil(num_bits, word_bits), value ? ~word_type(0) : word_type(0)), num_bits(num_bits)
+{
+    clear_unused_bits();
+}
+
+packed_bit_vector::packed_bit_vector(const bit_vector &v) :
+    words(div_ceil(v.size(), word_bits), 0), num_bits(v.size())
+{
+    /* assemble each word in a register, and store it once */
+    auto it = v.begin();
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        const size_t bits_in_word = std::min(word_bits, num_bits - w * word_bits);
+        word_type word = 0;
+        for (size_t j = 0; j < bits_in_word; ++j, ++it)
+        {
+            word |= word_type(*it) << j;
+        }
+        words[w] = word;
+    }
+}
+
+bit_vector packed_bit_vector::to_bit_vector() const
+{
+    bit_vector result(num_bits);
+    for_each_set_bit([&result](const size_t i) { result[i] = true; });
+    return result;
+}
+
+void packed_bit_vector::clear_unused_bits()
+{
+    const size_t used = num_bits % word_bits;
+    if (used != 0)
+    {
+        words.back() &= (word_type(1) << used) - 1;
+    }
+}
+
+void packed_bit_vector::set(const size_t i, const bool value)
+{
+    assert(i < num_bits);
+    const word_type mask = word_type(1) << (i % word_bits);
+    if (value)
+    {
+        words[i / word_bits] |= mask;
+    }
+    else
+    {
+        words[i / word_bits] &= ~mask;
+    }
+}
+
+void packed_bit_vector::resize(const size_t new_size)
+{
+    words.resize(div_ceil(new_size, word_bits), 0);
+    num_bits = new_size;
+    clear_unused_bits();
+}
+
+void packed_bit_vector::clear()
+{
+    words.clear();
+    num_bits = 0;
+}
+
+packed_bit_vector::word_type packed_bit_vector::get_word(const size_t offset, const size_t width) const
+{
+    assert(width <= word_bits);
+    if (width == 0)
+    {
+        return 0;
+    }
+
+    const size_t w = offset / word_bits;
+    const size_t shift = offset % word_bits;
+
+    word_type result = (w < words.size() ? words[w] >> shift : 0);
+    if (shift != 0 && w + 1 < words.size())
+    {
+        result |= words[w + 1] << (word_bits - shift);
+    }
+
+    return (width == word_bits ? result : result & ((word_type(1) << width) - 1));
+}
+
+void packed_bit_vector::append_word(const word_type value, const size_t width)
+{
+    assert(width <= word_bits);
+    if (width == 0)
+    {
+        return;
+    }
+
+    const word_type masked = (width == word_bits ? value : value & ((word_type(1) << width) - 1));
+    const size_t used = num_bits % word_bits;
+    if (used == 0)
+    {
+        words.emplace_back(masked);
+    }
+    else
+    {
+        words.back() |= masked << used;
+        if (used + width > word_bits)
+        {
+            words.emplace_back(masked >> (word_bits - used));
+        }
+    }
+    num_bits += width;
+}
+
+void packed_bit_vector::append(const packed_bit_vector &other)
+{
+    if (num_bits % word_bits == 0)
+    {
+        words.insert(words.end(), other.words.begin(), other.words.end());
+        num_bits += other.num_bits;
+        return;
+    }
+
+    words.reserve(div_ceil(num_bits + other.num_bits, word_bits));
+    for (size_t offset = 0; offset < other.num_bits; offset += word_bits)
+    {
+        append_word(other.words[offset / word_bits], std::min(word_bits, other.num_bits - offset));
+    }
+}
+
+packed_bit_vector packed_bit_vector::slice(const size_t offset, const size_t length) const
+{
+    assert(offset + length <= num_bits);
+
+    packed_bit_vector result;
+    result.words.reserve(div_ceil(length, word_bits));
+    for (size_t i = 0; i < length; i += word_bits)
+    {
+        const size_t width = std::min(word_bits, length - i);
+        result.append_word(get_word(offset + i, width), width);
+    }
+
+    return result;
+}
+
+size_t packed_bit_vector::popcount() const
+{
+    size_t result = 0;
+    for (const word_type w : words)
+    {
+        result += __builtin_popcountll(w);
+    }
+    return result;
+}
+
+bool packed_bit_vector::operator==(const packed_bit_vector &other) const
+{
+    return (this->num_bits == other.num_bits && this->words == other.words);
+}
+
+bool packed_bit_vector::operator!=(const packed_bit_vector &other) const
+{
+    return !((*this) == other);
+}
+
+} // libsnark
@@ -0,0 +1,93 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of interfaces for a word-packed bit vector.
+
+ bit_vector (a std::vector<bool>) only exposes its bits one at a time,
+ through proxy objects, which makes bulk operations (packing into field
+ elements, hashing, counting) loop and branch per bit. A packed_bit_vector
+ stores bit i as bit (i % 64) of word i / 64 (the little-endian order used
+ by field_utils), and offers word-level access, slicing, concatenation and
+ population counts. It converts to and from bit_vector, so hot paths can
+ convert once and then operate on whole words.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef PACKED_BIT_VECTOR_HPP_
+#define PACKED_BIT_VECTOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/utils.hpp"
+
+namespace libsnark {
+
+class packed_bit_vector {
+public:
+    typedef uint64_t word_type;
+    static const size_t word_bits = 64;
+
+private:
+    std::vector<word_type> words; /* bits past num_bits in the last word are always zero */
+    size_t num_bits;
+
+    void clear_unused_bits();
+
+public:
+    packed_bit_vector() : num_bits(0) {};
+    explicit packed_bit_vector(const size_t num_bits, const bool value = false);
+    explicit packed_bit_vector(const bit_vector &v);
+
+    bit_vector to_bit_vector() const;
+
+    size_t size() const { return num_bits; }
+    bool empty() const { return num_bits == 0; }
+    const std::vector<word_type>& get_words() const { return words; }
+
+    bool test(const size_t i) const { return (words[i / word_bits] >> (i % word_bits)) & 1; }
+    bool operator[](const size_t i) const { return test(i); }
+    void set(const size_t i, const bool value = true);
+
+    void resize(const size_t new_size);
+    void clear();
+
+    /* returns bits [offset, offset+width) as an integer (bit offset being the least significant one); bits past the end read as zero */
+    word_type get_word(const size_t offset, const size_t width = word_bits) const;
+    /* appends the width least significant bits of value */
+    void append_word(const word_type value, const size_t width = word_bits);
+    void append(const packed_bit_vector &other);
+    packed_bit_vector slice(const size_t offset, const size_t length) const;
+
+    size_t popcount() const;
+
+    /* calls f(i) for every set bit i, in increasing order */
+    template<typename F>
+    void for_each_set_bit(F f) const;
+
+    bool operator==(const packed_bit_vector &other) const;
+    bool operator!=(const packed_bit_vector &other) const;
+};
+
+template<typename F>
+void packed_bit_vector::for_each_set_bit(F f) const
+{
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        word_type word = words[w];
+        while (word)
+        {
+            f(w * word_bits + __builtin_ctzll(word));
+            word &= word - 1;
+        }
+    }
+}
+
+} // libsnark
+
+#endif // PACKED_BIT_VECTOR_HPP_
@@ -12,6 +12,7 @@
 #ifndef SPARSE_VECTOR_HPP_
 #define SPARSE_VECTOR_HPP_
 
+#include <cstdint>
 #include <vector>
 
 namespace libsnark {
@@ -28,11 +29,18 @@ std::istream& operator>>(std::istream &in, sparse_vector<T> &v);
 /**
  * A sparse vector is a list of indices along with corresponding values.
  * The indices are selected from the set {0,1,...,domain_size-1}.
+ *
+ * Indices are stored in 32 bits (rather than as size_t), which halves their
+ * share of the memory, and of the memory traffic of multi-exponentiations,
+ * for large proving keys. Domain sizes are thus limited to 2^32, and
+ * deserialization fails (sets failbit) on larger domains or indices.
  */
 template<typename T>
 struct sparse_vector {
 
-    std::vector<size_t> indices;
+    typedef uint32_t index_type;
+
+    std::vector<index_type> indices;
     std::vector<T> values;
     size_t domain_size_;
 
@@ -53,15 +61,38 @@ struct sparse_vector {
     bool empty() const;
 
     size_t domain_size() const; // return domain_size_
+    static size_t max_domain_size(); // return the largest domain size whose indices fit in index_type
     size_t size() const; // return the number of indices (representing the number of non-zero entries)
     size_t size_in_bits() const; // return the number bits needed to store the sparse vector
 
+    /* return the positions [first, last) (into indices and values) of the entries whose indices lie in [offset, offset+length) */
+    std::pair<size_t, size_t> find_range(const size_t offset, const size_t length) const;
+
     /* return a pair consisting of the accumulated value and the sparse vector of non-accumuated values */
     template<typename FieldT>
     std::pair<T, sparse_vector<T> > accumulate(const typename std::vector<FieldT>::const_iterator &it_begin,
                                                const typename std::vector<FieldT>::const_iterator &it_end,
                                                const size_t offset) const;
 
+    /* return only the accumulated value, without copying the non-accumulated values */
+    template<typename FieldT>
+    T accumulate_value(const typename std::vector<FieldT>::const_iterator &it_begin,
+                       const typename std::vector<FieldT>::const_iterator &it_end,
+                       const size_t offset) const;
+
+    /*
+     * as repeated accumulate, but for several chunks of values, each given
+     * with its offset: all chunks are accumulated by a single
+     * multi-exponentiation, and the non-accumulated values are copied once
+     * (an entry covered by several chunks takes the scalar of the first)
+     */
+    template<typename FieldT>
+    std::pair<T, sparse_vector<T> > accumulate_chunks(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const;
+
+    /* return only the accumulated value of accumulate_chunks, without copying the non-accumulated values */
+    template<typename FieldT>
+    T accumulate_chunks_value(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const;
+
     friend std::ostream& operator<< <T>(std::ostream &out, const sparse_vector<T> &v);
     friend std::istream& operator>> <T>(std::istream &in, sparse_vector<T> &v);
 };
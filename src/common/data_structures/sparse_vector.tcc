@@ -14,7 +14,13 @@
 #ifndef SPARSE_VECTOR_TCC_
 #define SPARSE_VECTOR_TCC_
 
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+
 #include "algebra/scalar_multiplication/multiexp.hpp"
+#include "common/prover_config.hpp"
 
 namespace libsnark {
 
@@ -22,6 +28,7 @@ template<typename T>
 sparse_vector<T>::sparse_vector(std::vector<T> &&v) :
     values(std::move(v)), domain_size_(values.size())
 {
+    assert(domain_size_ <= max_domain_size());
     indices.resize(domain_size_);
     std::iota(indices.begin(), indices.end(), 0);
 }
@@ -108,6 +115,12 @@ size_t sparse_vector<T>::domain_size() const
     return domain_size_;
 }
 
+template<typename T>
+size_t sparse_vector<T>::max_domain_size()
+{
+    return (size_t) std::numeric_limits<index_type>::max() + 1;
+}
+
 template<typename T>
 size_t sparse_vector<T>::size() const
 {
@@ -117,7 +130,47 @@ size_t sparse_vector<T>::size() const
 template<typename T>
 size_t sparse_vector<T>::size_in_bits() const
 {
-    return indices.size() * (sizeof(size_t) * 8 + T::size_in_bits());
+    return indices.size() * (sizeof(index_type) * 8 + T::size_in_bits());
+}
+
+template<typename T>
+std::pair<size_t, size_t> sparse_vector<T>::find_range(const size_t offset, const size_t length) const
+{
+    /* indices are sorted, so the entries in range are contiguous */
+    const auto first = std::lower_bound(indices.begin(), indices.end(), offset);
+    const auto last = std::lower_bound(first, indices.end(), offset + length);
+
+    return std::make_pair(first - indices.begin(), last - indices.begin());
+}
+
+template<typename T>
+template<typename FieldT>
+T sparse_vector<T>::accumulate_value(const typename std::vector<FieldT>::const_iterator &it_begin,
+                                     const typename std::vector<FieldT>::const_iterator &it_end,
+                                     const size_t offset) const
+{
+    const size_t chunks = active_prover_config.multiexp_chunks();
+    const bool use_multiexp = true;
+
+    const std::pair<size_t, size_t> range = find_range(offset, it_end - it_begin);
+
+    /* the values in range are contiguous, but their scalars need not be (indices may skip zero coefficients) */
+    std::vector<FieldT> scalars;
+    scalars.reserve(range.second - range.first);
+    for (size_t i = range.first; i < range.second; ++i)
+    {
+        scalars.emplace_back(*(it_begin + (indices[i] - offset)));
+    }
+
+#ifdef DEBUG
+    if (range.first < range.second)
+    {
+        print_indent(); printf("doing multiexp for w_%zu ... w_%zu\n", indices[range.first], indices[range.second-1]);
+    }
+#endif
+    return multi_exp<T, FieldT>(values.begin() + range.first, values.begin() + range.second,
+                                scalars.begin(), scalars.end(),
+                                chunks, use_multiexp);
 }
 
 template<typename T>
@@ -126,84 +179,101 @@ std::pair<T, sparse_vector<T> > sparse_vector<T>::accumulate(const typename std:
                                                              const typename std::vector<FieldT>::const_iterator &it_end,
                                                              const size_t offset) const
 {
-    // TODO: does not really belong here.
-    const size_t chunks = 1;
-    const bool use_multiexp = true;
+    const std::pair<size_t, size_t> range = find_range(offset, it_end - it_begin);
+
+    T accumulated_value = this->template accumulate_value<FieldT>(it_begin, it_end, offset);
 
-    T accumulated_value = T::zero();
     sparse_vector<T> resulting_vector;
     resulting_vector.domain_size_ = domain_size_;
+    resulting_vector.indices.reserve(indices.size() - (range.second - range.first));
+    resulting_vector.values.reserve(values.size() - (range.second - range.first));
 
-    const size_t range_len = it_end - it_begin;
-    bool in_block = false;
-    size_t first_pos = -1, last_pos = -1; // g++ -flto emits unitialized warning, even though in_block guards for such cases.
+    resulting_vector.indices.insert(resulting_vector.indices.end(), indices.begin(), indices.begin() + range.first);
+    resulting_vector.indices.insert(resulting_vector.indices.end(), indices.begin() + range.second, indices.end());
+    resulting_vector.values.insert(resulting_vector.values.end(), values.begin(), values.begin() + range.first);
+    resulting_vector.values.insert(resulting_vector.values.end(), values.begin() + range.second, values.end());
 
-    for (size_t i = 0; i < indices.size(); ++i)
-    {
-        const bool matching_pos = (offset <= indices[i] && indices[i] < offset + range_len);
-        // printf("i = %zu, pos[i] = %zu, offset = %zu, w_size = %zu\n", i, indices[i], offset, w_size);
-        bool copy_over;
+    return std::make_pair(std::move(accumulated_value), std::move(resulting_vector));
+}
 
-        if (in_block)
-        {
-            if (matching_pos && last_pos == i-1)
-            {
-                // block can be extended, do it
-                last_pos = i;
-                copy_over = false;
-            }
-            else
-            {
-                // block has ended here
-                in_block = false;
-                copy_over = true;
+template<typename T>
+template<typename FieldT>
+T sparse_vector<T>::accumulate_chunks_value(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const
+{
+    const size_t multi_exp_chunks = active_prover_config.multiexp_chunks();
+    const bool use_multiexp = true;
 
-#ifdef DEBUG
-                print_indent(); printf("doing multiexp for w_%zu ... w_%zu\n", indices[first_pos], indices[last_pos]);
-#endif
-                accumulated_value = accumulated_value + multi_exp<T, FieldT>(values.begin() + first_pos,
-                                                                             values.begin() + last_pos + 1,
-                                                                             it_begin + (indices[first_pos] - offset),
-                                                                             it_begin + (indices[last_pos] - offset) + 1,
-                                                                             chunks, use_multiexp);
-            }
-        }
-        else
+    /*
+     * gather the values in range of every chunk, and their scalars, for a single
+     * multi-exponentiation; as with repeated accumulate, an entry covered by
+     * several chunks is only accumulated with the scalar of the first one
+     */
+    std::vector<bool> is_accumulated(indices.size(), false);
+    std::vector<T> bases;
+    std::vector<FieldT> scalars;
+    for (auto &chunk : chunks)
+    {
+        const size_t offset = chunk.first;
+        const std::pair<size_t, size_t> range = find_range(offset, chunk.second.size());
+
+        for (size_t i = range.first; i < range.second; ++i)
         {
-            if (matching_pos)
+            if (!is_accumulated[i])
             {
-                // block can be started
-                first_pos = i;
-                last_pos = i;
-                in_block = true;
-                copy_over = false;
-            }
-            else
-            {
-                copy_over = true;
+                is_accumulated[i] = true;
+                bases.emplace_back(values[i]);
+                scalars.emplace_back(chunk.second[indices[i] - offset]);
             }
         }
+    }
 
-        if (copy_over)
-        {
-            resulting_vector.indices.emplace_back(indices[i]);
-            resulting_vector.values.emplace_back(values[i]);
-        }
+    return multi_exp<T, FieldT>(bases.begin(), bases.end(),
+                                scalars.begin(), scalars.end(),
+                                multi_exp_chunks, use_multiexp);
+}
+
+template<typename T>
+template<typename FieldT>
+std::pair<T, sparse_vector<T> > sparse_vector<T>::accumulate_chunks(const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks) const
+{
+    T accumulated_value = this->template accumulate_chunks_value<FieldT>(chunks);
+
+    std::vector<std::pair<size_t, size_t> > ranges;
+    ranges.reserve(chunks.size());
+    for (auto &chunk : chunks)
+    {
+        ranges.emplace_back(find_range(chunk.first, chunk.second.size()));
     }
 
-    if (in_block)
+    /* copy everything outside the union of the ranges, in a single pass */
+    std::sort(ranges.begin(), ranges.end());
+
+    size_t num_accumulated = 0, covered_end = 0;
+    for (auto &range : ranges)
     {
-#ifdef DEBUG
-        print_indent(); printf("doing multiexp for w_%zu ... w_%zu\n", indices[first_pos], indices[last_pos]);
-#endif
-        accumulated_value = accumulated_value + multi_exp<T, FieldT>(values.begin() + first_pos,
-                                                                     values.begin() + last_pos + 1,
-                                                                     it_begin + (indices[first_pos] - offset),
-                                                                     it_begin + (indices[last_pos] - offset) + 1,
-                                                                     chunks, use_multiexp);
+        num_accumulated += (range.second > covered_end ? range.second - std::max(range.first, covered_end) : 0);
+        covered_end = std::max(covered_end, range.second);
     }
 
-    return std::make_pair(accumulated_value, resulting_vector);
+    sparse_vector<T> resulting_vector;
+    resulting_vector.domain_size_ = domain_size_;
+    resulting_vector.indices.reserve(indices.size() - num_accumulated);
+    resulting_vector.values.reserve(values.size() - num_accumulated);
+
+    size_t pos = 0;
+    for (auto &range : ranges)
+    {
+        if (pos < range.first)
+        {
+            resulting_vector.indices.insert(resulting_vector.indices.end(), indices.begin() + pos, indices.begin() + range.first);
+            resulting_vector.values.insert(resulting_vector.values.end(), values.begin() + pos, values.begin() + range.first);
+        }
+        pos = std::max(pos, range.second);
+    }
+    resulting_vector.indices.insert(resulting_vector.indices.end(), indices.begin() + pos, indices.end());
+    resulting_vector.values.insert(resulting_vector.values.end(), values.begin() + pos, values.end());
+
+    return std::make_pair(std::move(accumulated_value), std::move(resulting_vector));
 }
 
 template<typename T>
@@ -211,7 +281,7 @@ std::ostream& operator<<(std::ostream& out, const sparse_vector<T> &v)
 {
     out << v.domain_size_ << "\n";
     out << v.indices.size() << "\n";
-    for (const size_t& i : v.indices)
+    for (const typename sparse_vector<T>::index_type& i : v.indices)
     {
         out << i << "\n";
     }
@@ -230,6 +300,12 @@ std::istream& operator>>(std::istream& in, sparse_vector<T> &v)
 {
     in >> v.domain_size_;
     consume_newline(in);
+    if (v.domain_size_ > sparse_vector<T>::max_domain_size())
+    {
+        /* index_type cannot address such a domain */
+        in.setstate(std::ios_base::failbit);
+        return in;
+    }
 
     size_t s;
     in >> s;
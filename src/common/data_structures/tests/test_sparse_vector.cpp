@@ -0,0 +1,191 @@
+/** @file
+ *****************************************************************************
+
+ Functions to test sparse vectors and accumulation vectors.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cassert>
+#include <cstdlib>
+#include <cstdio>
+#include <sstream>
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/data_structures/accumulation_vector.hpp"
+#include "common/data_structures/sparse_vector.hpp"
+#include "common/profiling.hpp"
+
+using namespace libsnark;
+
+/**
+ * Return a sparse vector on [0, domain_size) with random values at about half
+ * of the positions.
+ */
+template<typename T>
+sparse_vector<T> random_sparse_vector(const size_t domain_size)
+{
+    sparse_vector<T> v;
+    v.domain_size_ = domain_size;
+    for (size_t i = 0; i < domain_size; ++i)
+    {
+        if (std::rand() % 2)
+        {
+            v.indices.emplace_back(i);
+            v.values.emplace_back(T::random_element());
+        }
+    }
+
+    return v;
+}
+
+/**
+ * Return num_chunks chunks of random scalars. Their offsets and lengths are
+ * random, so chunks may overlap each other, touch each other, be empty, or lie
+ * partly or wholly beyond the domain.
+ */
+template<typename FieldT>
+std::vector<std::pair<size_t, std::vector<FieldT> > > random_chunks(const size_t domain_size, const size_t num_chunks)
+{
+    std::vector<std::pair<size_t, std::vector<FieldT> > > chunks;
+    for (size_t i = 0; i < num_chunks; ++i)
+    {
+        const size_t offset = std::rand() % (domain_size + 10);
+        const size_t length = std::rand() % 20;
+        chunks.emplace_back(offset, std::vector<FieldT>(length));
+        for (FieldT &s : chunks.back().second)
+        {
+            s = FieldT::random_element();
+        }
+    }
+
+    return chunks;
+}
+
+template<typename T>
+void test_find_range(const sparse_vector<T> &v)
+{
+    for (size_t offset = 0; offset < v.domain_size() + 5; ++offset)
+    {
+        for (size_t length = 0; length < 5; ++length)
+        {
+            const std::pair<size_t, size_t> range = v.find_range(offset, length);
+            for (size_t i = 0; i < v.size(); ++i)
+            {
+                const bool in_range = (offset <= v.indices[i] && v.indices[i] < offset + length);
+                assert(in_range == (range.first <= i && i < range.second));
+            }
+        }
+    }
+}
+
+/**
+ * Compare accumulate_chunks and accumulate_chunks_value with accumulating the
+ * same chunks one after the other, on sparse vectors and on accumulation
+ * vectors.
+ */
+template<typename T, typename FieldT>
+void test_accumulate_chunks(const sparse_vector<T> &v, const std::vector<std::pair<size_t, std::vector<FieldT> > > &chunks)
+{
+    T expected_value = T::zero();
+    sparse_vector<T> expected_rest = v;
+    for (auto &chunk : chunks)
+    {
+        const T value = expected_rest.template accumulate_value<FieldT>(chunk.second.begin(), chunk.second.end(), chunk.first);
+        const std::pair<T, sparse_vector<T> > result = expected_rest.template accumulate<FieldT>(chunk.second.begin(), chunk.second.end(), chunk.first);
+        assert(result.first == value);
+        expected_value = expected_value + result.first;
+        expected_rest = result.second;
+    }
+
+    const std::pair<T, sparse_vector<T> > result = v.template accumulate_chunks<FieldT>(chunks);
+    assert(result.first == expected_value);
+    assert(result.second == expected_rest);
+    assert(v.template accumulate_chunks_value<FieldT>(chunks) == expected_value);
+
+    const T first = T::random_element();
+    accumulation_vector<T> expected_acc{T(first), sparse_vector<T>(v)};
+    for (auto &chunk : chunks)
+    {
+        const T value = expected_acc.template accumulate_chunk_value<FieldT>(chunk.second.begin(), chunk.second.end(), chunk.first);
+        expected_acc = expected_acc.template accumulate_chunk<FieldT>(chunk.second.begin(), chunk.second.end(), chunk.first);
+        assert(expected_acc.first == value);
+    }
+
+    const accumulation_vector<T> acc{T(first), sparse_vector<T>(v)};
+    assert(acc.template accumulate_chunks<FieldT>(chunks) == expected_acc);
+    assert(acc.template accumulate_chunks_value<FieldT>(chunks) == expected_acc.first);
+}
+
+/**
+ * Check the limit of the domain size that 32-bit indices impose: a domain of
+ * max_domain_size() (with the largest index in use) round-trips, and larger
+ * domains or indices are rejected by deserialization.
+ */
+template<typename T>
+void test_domain_size_limit()
+{
+    const size_t max_domain_size = sparse_vector<T>::max_domain_size();
+    assert(max_domain_size == 1ull << 32);
+
+    sparse_vector<T> v(std::vector<T>({ T::random_element(), T::random_element() }));
+    assert(v.domain_size() == 2);
+    v.domain_size_ = max_domain_size;
+    v.indices[1] = max_domain_size - 1;
+    reserialize<sparse_vector<T> >(v);
+
+    std::stringstream too_large_domain;
+    too_large_domain << max_domain_size + 1 << "\n0\n0\n";
+    sparse_vector<T> w;
+    too_large_domain >> w;
+    assert(too_large_domain.fail());
+
+    std::stringstream too_large_index;
+    too_large_index << max_domain_size << "\n1\n" << max_domain_size << "\n1\n" << T::random_element() << OUTPUT_NEWLINE;
+    too_large_index >> w;
+    assert(too_large_index.fail());
+}
+
+template<typename ppT>
+void test_sparse_vector()
+{
+    typedef G1<ppT> T;
+    typedef Fr<ppT> FieldT;
+
+    for (const size_t domain_size : { 0, 1, 50, 200 })
+    {
+        const sparse_vector<T> v = random_sparse_vector<T>(domain_size);
+        test_find_range(v);
+
+        test_accumulate_chunks<T, FieldT>(v, {});
+        for (const size_t num_chunks : { 1, 2, 10, 30 })
+        {
+            test_accumulate_chunks<T, FieldT>(v, random_chunks<FieldT>(domain_size, num_chunks));
+        }
+
+        /* disjoint chunks that touch, and a chunk inside another one (which adds nothing) */
+        std::vector<std::pair<size_t, std::vector<FieldT> > > chunks;
+        for (size_t offset = 0; offset + 7 <= domain_size; offset += 7)
+        {
+            chunks.emplace_back(offset, std::vector<FieldT>(7, FieldT::random_element()));
+        }
+        chunks.emplace_back(domain_size / 2, std::vector<FieldT>(3, FieldT::random_element()));
+        test_accumulate_chunks<T, FieldT>(v, chunks);
+    }
+
+    test_domain_size_limit<T>();
+}
+
+int main(void)
+{
+    start_profiling();
+    default_ec_pp::init_public_params();
+    inhibit_profiling_info = true;
+
+    test_sparse_vector<default_ec_pp>();
+
+    printf("All sparse vector tests passed\n");
+}
@@ -0,0 +1,113 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of interfaces for backing large vectors with huge pages.
+
+ See huge_page_allocator.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "common/huge_page_allocator.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace libsnark {
+
+#ifdef __linux__
+static uintptr_t round_up_to_huge_page(const uintptr_t x)
+{
+    return (x + huge_page_size - 1) & ~uintptr_t(huge_page_size - 1);
+}
+
+static uintptr_t round_down_to_huge_page(const uintptr_t x)
+{
+    return x & ~uintptr_t(huge_page_size - 1);
+}
+#endif
+
+void* allocate_huge_pages(const size_t num_bytes, const huge_page_policy policy)
+{
+#ifdef __linux__
+    if (num_bytes < huge_page_size || policy == huge_pages_none)
+    {
+        return malloc(num_bytes);
+    }
+
+    /* large allocations are always whole, aligned huge pages, so free_huge_pages needs nothing but num_bytes and policy */
+    const size_t mapped_bytes = round_up_to_huge_page(num_bytes);
+    if (policy == huge_pages_explicit)
+    {
+        void *p = mmap(NULL, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED)
+        {
+            return p;
+        }
+    }
+
+    /* over-allocate by a huge page, and trim the mapping to a 2 MB-aligned range */
+    void *q = mmap(NULL, mapped_bytes + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (q == MAP_FAILED)
+    {
+        return NULL;
+    }
+    const uintptr_t begin = round_up_to_huge_page(uintptr_t(q));
+    if (begin != uintptr_t(q))
+    {
+        munmap(q, begin - uintptr_t(q));
+    }
+    munmap((void*) (begin + mapped_bytes), uintptr_t(q) + huge_page_size - begin);
+
+    madvise((void*) begin, mapped_bytes, MADV_HUGEPAGE);
+    return (void*) begin;
+#else
+    (void) policy;
+    return malloc(num_bytes);
+#endif
+}
+
+void free_huge_pages(void *p, const size_t num_bytes, const huge_page_policy policy)
+{
+#ifdef __linux__
+    if (num_bytes >= huge_page_size && policy != huge_pages_none)
+    {
+        munmap(p, round_up_to_huge_page(num_bytes));
+        return;
+    }
+#else
+    (void) num_bytes;
+    (void) policy;
+#endif
+    free(p);
+}
+
+void advise_huge_pages(const void *data, const size_t num_bytes)
+{
+#ifdef __linux__
+    if (active_prover_config.huge_pages == huge_pages_none)
+    {
+        return;
+    }
+
+    /* madvise works on whole pages, and only whole huge pages can be backed by one */
+    const uintptr_t begin = round_up_to_huge_page(uintptr_t(data));
+    const uintptr_t end = round_down_to_huge_page(uintptr_t(data) + num_bytes);
+    if (begin < end)
+    {
+        /* huge pages are only a hint, so failures are ignored */
+        madvise((void*) begin, end - begin, MADV_HUGEPAGE);
+    }
+#else
+    (void) data;
+    (void) num_bytes;
+#endif
+}
+
+} // libsnark
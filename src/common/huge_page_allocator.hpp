@@ -0,0 +1,122 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of an allocator that backs large vectors with huge pages, and of
+ helpers that request huge pages for the storage of ordinary std::vector's.
+
+ Multi-exponentiations (bucket accumulation and the Bos-Coster heap), the
+ bit-reversal passes of FFTs, and lookups in fixed-base window tables touch
+ vectors of field and group elements at random offsets. With 4 kB pages,
+ vectors of 2^24 and more elements span far more pages than the TLB covers,
+ so nearly every such access misses it. Backing these vectors by 2 MB pages
+ cuts the number of pages by a factor of 512.
+
+ The kind of huge pages is set by the huge_page_policy of the active prover
+ configuration (see common/prover_config.hpp):
+ - huge_pages_transparent maps the memory 2 MB-aligned and asks the kernel to
+   back it by transparent huge pages (madvise), which works whenever
+   /sys/kernel/mm/transparent_hugepage/enabled is "always" or "madvise";
+ - huge_pages_explicit maps preallocated huge pages (MAP_HUGETLB, see
+   /proc/sys/vm/nr_hugepages), and falls back to transparent huge pages if
+   there are not enough of them.
+
+ Only allocations of at least huge_page_size bytes are affected; smaller ones,
+ and all allocations under huge_pages_none, come from malloc as usual. An
+ allocator keeps the policy that was active when it was constructed, so
+ memory is released the way it was obtained even if the configuration changes
+ in between. Huge pages need Linux; elsewhere the allocator behaves like
+ std::allocator.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef HUGE_PAGE_ALLOCATOR_HPP_
+#define HUGE_PAGE_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "common/prover_config.hpp"
+
+namespace libsnark {
+
+const size_t huge_page_size = 1ul << 21;
+
+/* return num_bytes bytes, which are mapped on huge pages according to policy if num_bytes >= huge_page_size and policy is not huge_pages_none (NULL if out of memory) */
+void* allocate_huge_pages(const size_t num_bytes, const huge_page_policy policy);
+
+/* release memory returned by allocate_huge_pages(num_bytes, policy) */
+void free_huge_pages(void *p, const size_t num_bytes, const huge_page_policy policy);
+
+/* ask for transparent huge pages for the 2 MB-aligned pages within [data, data + num_bytes), unless the policy of the active prover configuration is huge_pages_none; only pages that are not yet touched are affected right away */
+void advise_huge_pages(const void *data, const size_t num_bytes);
+
+template<typename T>
+class huge_page_allocator {
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind {
+        typedef huge_page_allocator<U> other;
+    };
+
+    /* memory is always released by an allocator with the same policy, even across moves and swaps of containers */
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    huge_page_policy policy;
+
+    huge_page_allocator() : policy(active_prover_config.huge_pages) {}
+    template<typename U>
+    huge_page_allocator(const huge_page_allocator<U> &other) : policy(other.policy) {}
+
+    T* allocate(const size_t n)
+    {
+        if (n == 0)
+        {
+            return NULL;
+        }
+        void *p = (n > ((size_t) -1) / sizeof(T) ? NULL : allocate_huge_pages(n * sizeof(T), policy));
+        if (p == NULL)
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T *p, const size_t n)
+    {
+        free_huge_pages(p, n * sizeof(T), policy);
+    }
+
+    template<typename U>
+    bool operator==(const huge_page_allocator<U> &other) const { return policy == other.policy; }
+    template<typename U>
+    bool operator!=(const huge_page_allocator<U> &other) const { return policy != other.policy; }
+};
+
+/* a vector for scratch space that is accessed at random offsets */
+template<typename T>
+using huge_page_vector = std::vector<T, huge_page_allocator<T> >;
+
+/*
+ * Return a std::vector of n copies of value whose storage is advised to use
+ * transparent huge pages, usually before it is first touched (malloc may also
+ * reuse touched heap memory, see the implementation). This serves vectors that
+ * are passed on as std::vector's (such as FFT inputs); huge_pages_explicit
+ * falls back to transparent huge pages for them.
+ */
+template<typename T>
+std::vector<T> make_vector_on_huge_pages(const size_t n, const T &value);
+
+} // libsnark
+
+#include "common/huge_page_allocator.tcc"
+
+#endif // HUGE_PAGE_ALLOCATOR_HPP_
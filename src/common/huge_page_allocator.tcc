@@ -0,0 +1,38 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of templatized helpers for vectors backed by huge pages.
+
+ See huge_page_allocator.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef HUGE_PAGE_ALLOCATOR_TCC_
+#define HUGE_PAGE_ALLOCATOR_TCC_
+
+namespace libsnark {
+
+template<typename T>
+std::vector<T> make_vector_on_huge_pages(const size_t n, const T &value)
+{
+    std::vector<T> v;
+    /*
+      malloc maps a reservation above its mmap threshold afresh, so none of it
+      is touched before the advice. glibc raises that threshold dynamically
+      (up to 32 MB) after large blocks are freed, and then serves the
+      reservation from the heap, whose pages may already be touched; those
+      only get huge pages when khugepaged collapses them.
+    */
+    v.reserve(n);
+    advise_huge_pages(v.data(), n * sizeof(T));
+    v.resize(n, value);
+    return v;
+}
+
+} // libsnark
+
+#endif // HUGE_PAGE_ALLOCATOR_TCC_
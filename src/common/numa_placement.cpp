@@ -0,0 +1,180 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of interfaces for NUMA-aware placement of large vectors and
+ for pinning worker threads to CPUs.
+
+ See numa_placement.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "common/numa_placement.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+#ifdef USE_NUMA
+#include <numa.h>
+#include <numaif.h>
+#endif
+
+namespace libsnark {
+
+size_t numa_num_nodes()
+{
+#ifdef USE_NUMA
+    if (numa_available() >= 0)
+    {
+        return numa_num_configured_nodes();
+    }
+#endif
+    return 1;
+}
+
+size_t numa_node_of_address(const void *p)
+{
+#ifdef USE_NUMA
+    if (numa_available() >= 0)
+    {
+        /* with no target nodes, move_pages only reports where the page is */
+        void *page = (void*) (uintptr_t(p) & ~uintptr_t(numa_pagesize() - 1));
+        int status = -1;
+        if (move_pages(0, 1, &page, NULL, &status, 0) == 0 && status >= 0)
+        {
+            return status;
+        }
+    }
+#else
+    (void) p;
+#endif
+    return 0;
+}
+
+size_t numa_node_of_calling_thread()
+{
+#ifdef USE_NUMA
+    if (numa_available() >= 0)
+    {
+        const int node = numa_node_of_cpu(sched_getcpu());
+        return (node < 0 ? 0 : node);
+    }
+#endif
+    return 0;
+}
+
+#ifdef __linux__
+/* the CPUs available to the process when first called, ordered by NUMA node */
+static std::vector<int> available_cpus_by_node()
+{
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &set))
+            {
+                cpus.emplace_back(cpu);
+            }
+        }
+    }
+#ifdef USE_NUMA
+    if (numa_available() >= 0)
+    {
+        std::stable_sort(cpus.begin(), cpus.end(), [](const int a, const int b) { return numa_node_of_cpu(a) < numa_node_of_cpu(b); });
+    }
+#endif
+    return cpus;
+}
+
+static void pin_to_cpu(const int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+}
+#endif
+
+void pin_worker_threads()
+{
+#ifdef __linux__
+    /* computed once, as pinning the calling thread shrinks its affinity mask */
+    static const std::vector<int> cpus = available_cpus_by_node();
+    if (cpus.empty())
+    {
+        return;
+    }
+
+    /* OpenMP reuses the same threads for later parallel regions of the same size, so they stay pinned */
+#ifdef MULTICORE
+#pragma omp parallel
+    {
+        pin_to_cpu(cpus[omp_get_thread_num() % cpus.size()]);
+    }
+#else
+    pin_to_cpu(cpus[0]);
+#endif
+#endif
+}
+
+void numa_place_memory(const void *data, const size_t num_bytes, const numa_placement_policy policy, const size_t num_parts)
+{
+#ifdef USE_NUMA
+    if (policy == numa_first_touch || num_bytes == 0 || numa_available() < 0)
+    {
+        return;
+    }
+
+    /* mbind works on whole pages, so also move the pages that data only partially covers */
+    const uintptr_t page_mask = uintptr_t(numa_pagesize() - 1);
+    const uintptr_t begin = uintptr_t(data) & ~page_mask;
+    const uintptr_t end = (uintptr_t(data) + num_bytes + page_mask) & ~page_mask;
+
+    /* placement is only a hint, so failures to migrate are ignored */
+    if (policy == numa_interleave)
+    {
+        struct bitmask *nodes = numa_get_mems_allowed();
+        mbind((void*) begin, end - begin, MPOL_INTERLEAVE, nodes->maskp, nodes->size + 1, MPOL_MF_MOVE);
+        numa_bitmask_free(nodes);
+        return;
+    }
+
+    /* numa_partition: with a static schedule, part i is moved by worker thread i, to its own node */
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < num_parts; ++i)
+    {
+        const uintptr_t part_begin = (i == 0 ? begin : (uintptr_t(data) + i * num_bytes / num_parts + page_mask) & ~page_mask);
+        const uintptr_t part_end = (i == num_parts - 1 ? end : (uintptr_t(data) + (i + 1) * num_bytes / num_parts + page_mask) & ~page_mask);
+        if (part_begin >= part_end)
+        {
+            continue;
+        }
+
+        const int node = numa_node_of_cpu(sched_getcpu());
+        struct bitmask *nodes = numa_allocate_nodemask();
+        numa_bitmask_setbit(nodes, node < 0 ? 0 : node);
+        mbind((void*) part_begin, part_end - part_begin, MPOL_BIND, nodes->maskp, nodes->size + 1, MPOL_MF_MOVE);
+        numa_bitmask_free(nodes);
+    }
+#else
+    (void) data;
+    (void) num_bytes;
+    (void) policy;
+    (void) num_parts;
+#endif
+}
+
+} // libsnark
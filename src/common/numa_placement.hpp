@@ -0,0 +1,62 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of interfaces for NUMA-aware placement of large vectors (such as
+ the queries of a proving key) and for pinning worker threads to CPUs.
+
+ A proving key is usually faulted in by the thread that loads it, so all of
+ its pages end up on that thread's NUMA node, and the worker threads of the
+ multi-exponentiations on other nodes read remote memory. The functions below
+ migrate the pages of a vector according to a numa_placement_policy (see
+ common/prover_config.hpp):
+ - numa_interleave spreads the pages evenly over all nodes;
+ - numa_partition splits the vector into the same parts as the chunks of a
+   multi-exponentiation, and moves every part to the node of the worker
+   thread that processes that chunk (which is stable once threads are pinned).
+ The multi-exponentiations copy the bases with non-trivial scalars out of the
+ proving key before processing them in chunks, and place those copies in the
+ same way (see split_scalar_vector in algebra/scalar_multiplication/multiexp.hpp).
+
+ Page migration needs libnuma (build with NUMA=1, see README.md); otherwise
+ it is a no-op and there is a single node. Pinning only needs Linux.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef NUMA_PLACEMENT_HPP_
+#define NUMA_PLACEMENT_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "common/prover_config.hpp"
+
+namespace libsnark {
+
+/* return the number of NUMA nodes (1 if not built with NUMA=1) */
+size_t numa_num_nodes();
+
+/* return the NUMA node that holds the page at p (0 if not built with NUMA=1, or if the page is not mapped) */
+size_t numa_node_of_address(const void *p);
+
+/* return the NUMA node of the CPU the calling thread runs on (0 if not built with NUMA=1) */
+size_t numa_node_of_calling_thread();
+
+/* pin the i-th OpenMP worker thread to the i-th CPU available to the process, with the CPUs ordered by NUMA node */
+void pin_worker_threads();
+
+/* migrate the pages of [data, data + num_bytes) according to policy; numa_partition splits it into num_parts parts */
+void numa_place_memory(const void *data, const size_t num_bytes, const numa_placement_policy policy, const size_t num_parts);
+
+/* migrate the pages of v according to the policy of the active prover configuration */
+template<typename T>
+void numa_place_vector(const std::vector<T> &v);
+
+} // libsnark
+
+#include "common/numa_placement.tcc"
+
+#endif // NUMA_PLACEMENT_HPP_
@@ -0,0 +1,28 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of templatized interfaces for NUMA-aware placement of large
+ vectors.
+
+ See numa_placement.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef NUMA_PLACEMENT_TCC_
+#define NUMA_PLACEMENT_TCC_
+
+namespace libsnark {
+
+template<typename T>
+void numa_place_vector(const std::vector<T> &v)
+{
+    numa_place_memory(v.data(), v.size() * sizeof(T), active_prover_config.numa_placement, active_prover_config.multiexp_chunks());
+}
+
+} // libsnark
+
+#endif // NUMA_PLACEMENT_TCC_
@@ -0,0 +1,152 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of interfaces for a runtime resource budget of the generators
+ and provers.
+
+ See prover_config.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "common/prover_config.hpp"
+
+#include <cstdio>
+#include <limits>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include "common/numa_placement.hpp"
+#include "common/profiling.hpp"
+
+namespace libsnark {
+
+static prover_config the_prover_config;
+const prover_config &active_prover_config = the_prover_config;
+
+prover_config::prover_config(const size_t memory_budget,
+                             const size_t num_threads,
+                             const numa_placement_policy numa_placement,
+                             const bool pin_threads,
+                             const huge_page_policy huge_pages) :
+    memory_budget(memory_budget), num_threads(num_threads), numa_placement(numa_placement), pin_threads(pin_threads), huge_pages(huge_pages)
+{
+}
+
+bool prover_config::has_memory_budget() const
+{
+    return (memory_budget != 0);
+}
+
+size_t prover_config::effective_num_threads() const
+{
+#ifdef MULTICORE
+    return (num_threads != 0 ? num_threads : omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+size_t prover_config::multiexp_chunks() const
+{
+    return effective_num_threads();
+}
+
+size_t prover_config::available_memory(const size_t reserved_bytes) const
+{
+    if (!has_memory_budget())
+    {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    return (reserved_bytes < memory_budget ? memory_budget - reserved_bytes : 0);
+}
+
+size_t prover_config::scratch_budget() const
+{
+    return (has_memory_budget() ? memory_budget / 4 : std::numeric_limits<size_t>::max());
+}
+
+bool prover_config::fits_scratch_budget(const size_t num_bytes) const
+{
+    return (num_bytes <= scratch_budget());
+}
+
+void prover_config::print() const
+{
+    if (inhibit_profiling_info)
+    {
+        return;
+    }
+
+    print_indent();
+    if (has_memory_budget())
+    {
+        printf("* Prover configuration: memory budget %zu kB, ", memory_budget >> 10);
+    }
+    else
+    {
+        printf("* Prover configuration: no memory budget, ");
+    }
+    printf("thread budget %zu, multi-exponentiation chunks %zu\n", effective_num_threads(), multiexp_chunks());
+
+    if (numa_placement != numa_first_touch || pin_threads)
+    {
+        print_indent();
+        printf("* NUMA placement: %s on %zu nodes, %s threads\n",
+               numa_placement == numa_interleave ? "interleave" : numa_placement == numa_partition ? "partition" : "first touch",
+               numa_num_nodes(), pin_threads ? "pinned" : "unpinned");
+    }
+
+    if (huge_pages != huge_pages_none)
+    {
+        print_indent();
+        printf("* Huge pages: %s\n", huge_pages == huge_pages_explicit ? "explicit" : "transparent");
+    }
+}
+
+void set_prover_config(const prover_config &config)
+{
+    the_prover_config = config;
+#ifdef MULTICORE
+    if (config.num_threads != 0)
+    {
+        omp_set_num_threads(config.num_threads);
+    }
+#endif
+    if (config.pin_threads)
+    {
+        pin_worker_threads();
+    }
+}
+
+void print_memory_estimate(const char *name, const size_t num_bytes)
+{
+    if (inhibit_profiling_info)
+    {
+        return;
+    }
+
+    print_indent();
+    if (num_bytes < (1ul << 20))
+    {
+        printf("* %s: %zu kB", name, num_bytes >> 10);
+    }
+    else
+    {
+        printf("* %s: %zu MB", name, num_bytes >> 20);
+    }
+
+    if (active_prover_config.has_memory_budget())
+    {
+        printf(" (budget %zu kB%s)", active_prover_config.memory_budget >> 10,
+               num_bytes > active_prover_config.memory_budget ? ", exceeded" : "");
+    }
+    printf("\n");
+}
+
+} // libsnark
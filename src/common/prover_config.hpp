@@ -0,0 +1,96 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of interfaces for a runtime resource budget of the generators
+ and provers.
+
+ A prover_config specifies a memory budget and a thread budget. The library
+ derives its resource-dependent parameters from the active configuration
+ (active_prover_config) instead of from fixed tables and compile-time flags:
+ - the window size of fixed-base exponentiation tables (get_exp_window_size),
+ - the window size, and thus the number of buckets, of bucket-method
+   multi-exponentiations,
+ - whether multi_exp uses the Bos-Coster method (which copies its bases) or
+   the bucket method (which does not),
+ - whether FFTs use the parallel algorithm (which needs a scratch copy of
+   their input),
+ - the number of chunks of multi-exponentiations and of the FFT,
+ - the NUMA placement of proving keys and the pinning of worker threads
+   (see common/numa_placement.hpp), and
+ - whether randomly accessed scratch vectors and FFT buffers are backed by
+   huge pages (see common/huge_page_allocator.hpp).
+
+ The default configuration has no memory budget and uses all available
+ threads, which matches the previous behavior. (The LOWMEM flag still caps
+ the fixed-base window size, independently of the budget.)
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef PROVER_CONFIG_HPP_
+#define PROVER_CONFIG_HPP_
+
+#include <cstddef>
+
+namespace libsnark {
+
+enum numa_placement_policy {
+    numa_first_touch = 0, /* leave pages on the node of the thread that first touched them */
+    numa_interleave = 1, /* interleave pages over all nodes */
+    numa_partition = 2 /* place the i-th of multiexp_chunks() parts of a vector on the node of worker thread i */
+};
+
+enum huge_page_policy {
+    huge_pages_none = 0, /* use regular pages */
+    huge_pages_transparent = 1, /* ask the kernel for transparent huge pages */
+    huge_pages_explicit = 2 /* map preallocated huge pages, falling back to transparent ones */
+};
+
+struct prover_config {
+    size_t memory_budget; /* in bytes; 0 means unlimited */
+    size_t num_threads; /* 0 means all available threads */
+    numa_placement_policy numa_placement;
+    bool pin_threads; /* pin worker thread i to the i-th available CPU (ordered by NUMA node) */
+    huge_page_policy huge_pages;
+
+    prover_config(const size_t memory_budget = 0,
+                  const size_t num_threads = 0,
+                  const numa_placement_policy numa_placement = numa_first_touch,
+                  const bool pin_threads = false,
+                  const huge_page_policy huge_pages = huge_pages_none);
+
+    bool has_memory_budget() const;
+    size_t effective_num_threads() const; /* 1 if not built with MULTICORE */
+    size_t multiexp_chunks() const;
+
+    /* return the memory left in the budget once reserved_bytes are in use (the maximum size_t if unlimited) */
+    size_t available_memory(const size_t reserved_bytes) const;
+    /* return the memory a single multi-exponentiation or FFT may use for scratch space (a quarter of the budget) */
+    size_t scratch_budget() const;
+    bool fits_scratch_budget(const size_t num_bytes) const;
+
+    void print() const;
+};
+
+/*
+ * The configuration used by the generators and provers. It is process-wide
+ * and read without synchronization (also by OpenMP worker threads), so it can
+ * only be changed by set_prover_config, which must not run while a generator
+ * or prover runs in any thread. Generators and provers that run concurrently
+ * therefore share one configuration; a different budget for each of them
+ * would need the configuration to be passed explicitly.
+ */
+extern const prover_config &active_prover_config;
+
+/* make config the active configuration (and, if built with MULTICORE, set the number of OpenMP threads and pin them accordingly); not thread-safe, see active_prover_config */
+void set_prover_config(const prover_config &config);
+
+/* print "* <name>: X MB" (or "X kB" for small sizes), along with the budget if there is one */
+void print_memory_estimate(const char *name, const size_t num_bytes);
+
+} // libsnark
+
+#endif // PROVER_CONFIG_HPP_
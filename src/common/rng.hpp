@@ -3,6 +3,11 @@
 
  Declaration of functions for generating randomness.
 
+ SHA512_rng derives a single field element from an index. SHA512_rng_bulk
+ derives many at once (in parallel when built with MULTICORE), either
+ reproducing SHA512_rng exactly or, in counter mode, cutting several
+ elements out of each SHA-512 digest.
+
  *****************************************************************************
  * @author     This file is part of libsnark, developed by SCIPR Lab
  *             and contributors (see AUTHORS).
@@ -13,12 +18,37 @@
 #define RNG_HPP_
 
 #include <cstdint>
+#include <vector>
 
 namespace libsnark {
 
 template<typename FieldT>
 FieldT SHA512_rng(const uint64_t idx);
 
+/**
+ * Output modes of SHA512_rng_bulk:
+ *
+ * - SHA512_rng_compat: element i equals SHA512_rng<FieldT>(start_idx + i),
+ *   so that existing public parameters (e.g., knapsack coefficients) are
+ *   reproduced bit for bit; only the per-element work is parallelized.
+ *
+ * - SHA512_rng_counter: the elements are cut, num_limbs 64-bit words at a
+ *   time, from SHA-512 digests of (start_idx, chunk, counter), with rejection
+ *   of values that are not below the modulus. Each digest yields up to
+ *   8 / num_limbs candidates (e.g., 2 for 256-bit fields). The elements are
+ *   produced in fixed-size chunks, so the output does not depend on the
+ *   number of threads and a shorter request is a prefix of a longer one.
+ *   These outputs differ from those of SHA512_rng.
+ */
+enum SHA512_rng_mode {
+    SHA512_rng_compat,
+    SHA512_rng_counter
+};
+
+template<typename FieldT>
+std::vector<FieldT> SHA512_rng_bulk(const uint64_t start_idx, const size_t count,
+                                    const SHA512_rng_mode mode = SHA512_rng_compat);
+
 } // libsnark
 
 #include "common/rng.tcc"
@@ -14,10 +14,21 @@
 #ifndef RNG_TCC_
 #define RNG_TCC_
 
+#include <algorithm>
 #include <openssl/sha.h>
 
 namespace libsnark {
 
+/* mask that clears all bits of the most significant limb higher than MSB of modulus */
+template<typename FieldT>
+mp_limb_t SHA512_rng_top_limb_mask()
+{
+    const size_t top_limb_bits = FieldT::mod.num_bits() - GMP_NUMB_BITS * (FieldT::num_limbs - 1);
+    assert(0 < top_limb_bits && top_limb_bits <= GMP_NUMB_BITS);
+
+    return (top_limb_bits == GMP_NUMB_BITS ? ~mp_limb_t(0) : (mp_limb_t(1) << top_limb_bits) - 1);
+}
+
 template<typename FieldT>
 FieldT SHA512_rng(const uint64_t idx)
 {
@@ -26,6 +37,8 @@ FieldT SHA512_rng(const uint64_t idx)
 
     assert(FieldT::size_in_bits() <= SHA512_DIGEST_LENGTH * 8);
 
+    const mp_limb_t top_limb_mask = SHA512_rng_top_limb_mask<FieldT>();
+
     bigint<FieldT::num_limbs> rval;
     uint64_t iter = 0;
     do
@@ -44,16 +57,7 @@ FieldT SHA512_rng(const uint64_t idx)
         }
 
         /* clear all bits higher than MSB of modulus */
-        size_t bitno = GMP_NUMB_BITS * FieldT::num_limbs;
-        while (FieldT::mod.test_bit(bitno) == false)
-        {
-            const std::size_t part = bitno/GMP_NUMB_BITS;
-            const std::size_t bit = bitno - (GMP_NUMB_BITS*part);
-
-            rval.data[part] &= ~(1ul<<bit);
-
-            bitno--;
-        }
+        rval.data[FieldT::num_limbs - 1] &= top_limb_mask;
 
         ++iter;
     }
@@ -64,6 +68,78 @@ FieldT SHA512_rng(const uint64_t idx)
     return FieldT(rval);
 }
 
+template<typename FieldT>
+std::vector<FieldT> SHA512_rng_bulk(const uint64_t start_idx, const size_t count, const SHA512_rng_mode mode)
+{
+    assert(GMP_NUMB_BITS == 64);
+    assert(is_little_endian());
+
+    assert(FieldT::size_in_bits() <= SHA512_DIGEST_LENGTH * 8);
+
+    std::vector<FieldT> result(count);
+
+    if (mode == SHA512_rng_compat)
+    {
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t i = 0; i < count; ++i)
+        {
+            result[i] = SHA512_rng<FieldT>(start_idx + i);
+        }
+
+        return result;
+    }
+
+    assert(mode == SHA512_rng_counter);
+
+    /* fixed (rather than per-thread) chunks keep the output independent of the number of threads */
+    const size_t chunk_size = 1024;
+    const size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+    const size_t limbs_per_digest = (SHA512_DIGEST_LENGTH*8) / GMP_NUMB_BITS;
+    const size_t candidates_per_digest = limbs_per_digest / FieldT::num_limbs;
+    const mp_limb_t top_limb_mask = SHA512_rng_top_limb_mask<FieldT>();
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        const uint64_t chunk_idx = chunk;
+        const size_t chunk_end = std::min(count, (chunk + 1) * chunk_size);
+
+        size_t i = chunk * chunk_size;
+        uint64_t counter = 0;
+        while (i < chunk_end)
+        {
+            mp_limb_t hash[limbs_per_digest];
+
+            SHA512_CTX sha512;
+            SHA512_Init(&sha512);
+            SHA512_Update(&sha512, &start_idx, sizeof(start_idx));
+            SHA512_Update(&sha512, &chunk_idx, sizeof(chunk_idx));
+            SHA512_Update(&sha512, &counter, sizeof(counter));
+            SHA512_Final((unsigned char*)hash, &sha512);
+            ++counter;
+
+            for (size_t j = 0; j < candidates_per_digest && i < chunk_end; ++j)
+            {
+                bigint<FieldT::num_limbs> rval;
+                std::copy(hash + j * FieldT::num_limbs, hash + (j+1) * FieldT::num_limbs, rval.data);
+                rval.data[FieldT::num_limbs - 1] &= top_limb_mask;
+
+                /* keep only candidates below the modulus (rejection sampling) */
+                if (mpn_cmp(rval.data, FieldT::mod.data, FieldT::num_limbs) < 0)
+                {
+                    result[i++] = FieldT(rval);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 } // libsnark
 
 #endif // RNG_TCC_
@@ -11,6 +11,7 @@
  * @copyright  MIT license (see LICENSE file)
  *****************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
 #include "common/routing_algorithms/as_waksman_routing_algorithm.hpp"
@@ -267,15 +268,20 @@ size_t as_waksman_other_input_position(const size_t row_offset, const size_t pac
  * - pi maps [lo, lo+1, ... hi] to itself, offset by lo, and
  * - piinv is the inverse of pi.
  *
- * NOTE: due to offsets, neither pi or piinv are instances of integer_permutation.
+ * The permutation pi and its inverse piinv are read from positions
+ * [lo..hi] of buffers.permutation[depth % 2] and
+ * buffers.permutation_inv[depth % 2], respectively. The permutations
+ * for the two subnetworks are written to the same positions of the
+ * other pair of buffers: sibling subnetworks occupy disjoint positions,
+ * and a subnetwork is done reading its input before its subnetworks
+ * overwrite it.
  */
 void as_waksman_route_inner(const size_t left,
                             const size_t right,
                             const size_t lo,
                             const size_t hi,
-                            const integer_permutation &permutation,
-                            const integer_permutation &permutation_inv,
-                            as_waksman_routing &routing)
+                            const size_t depth,
+                            as_waksman_routing_buffers &buffers)
 {
     if (left > right)
     {
@@ -286,12 +292,18 @@ void as_waksman_route_inner(const size_t left,
     const size_t subnetwork_width = as_waksman_num_columns(subnetwork_size);
     assert(right - left + 1 >= subnetwork_width);
 
+    const std::vector<size_t> &permutation = buffers.permutation[depth % 2];
+    const std::vector<size_t> &permutation_inv = buffers.permutation_inv[depth % 2];
+    std::vector<size_t> &new_permutation = buffers.permutation[(depth + 1) % 2];
+    std::vector<size_t> &new_permutation_inv = buffers.permutation_inv[(depth + 1) % 2];
+    std::vector<std::vector<char> > &routing = buffers.switch_settings;
+
 #ifdef DEBUG
-    assert(permutation.min_element == lo);
-    assert(permutation.max_element == hi);
-    assert(permutation.size() == subnetwork_size);
-    assert(permutation.is_valid());
-    assert(permutation.inverse() == permutation_inv);
+    for (size_t packet_idx = lo; packet_idx <= hi; ++packet_idx)
+    {
+        assert(lo <= permutation[packet_idx] && permutation[packet_idx] <= hi);
+        assert(permutation_inv[permutation[packet_idx]] == packet_idx);
+    }
 #endif
 
     if (right - left + 1 > subnetwork_width)
@@ -301,18 +313,18 @@ void as_waksman_route_inner(const size_t left,
          * then the topology for this subnetwork includes straight edges
          * along its sides and no switches, so it suffices to recurse.
          */
-        as_waksman_route_inner(left+1, right-1, lo, hi, permutation, permutation_inv, routing);
+        as_waksman_route_inner(left+1, right-1, lo, hi, depth, buffers);
     }
     else if (subnetwork_size == 2)
     {
         /**
          * Non-trivial base case: switch settings for a 2-element permutation
          */
-        assert(permutation.get(lo) == lo || permutation.get(lo) == lo+1);
-        assert(permutation.get(lo+1) == lo || permutation.get(lo+1) == lo + 1);
-        assert(permutation.get(lo) != permutation.get(lo+1));
+        assert(permutation[lo] == lo || permutation[lo] == lo+1);
+        assert(permutation[lo+1] == lo || permutation[lo+1] == lo + 1);
+        assert(permutation[lo] != permutation[lo+1]);
 
-        routing[left][lo] = (permutation.get(lo) != lo);
+        routing[left][lo] = (permutation[lo] != lo);
     }
     else
     {
@@ -323,9 +335,13 @@ void as_waksman_route_inner(const size_t left,
          * If this enforces a LHS switch setting, then forward-route that;
          * otherwise we will select the next value from LHS to route.
          */
-        integer_permutation new_permutation(lo, hi);
-        integer_permutation new_permutation_inv(lo, hi);
-        std::vector<bool> lhs_routed(subnetwork_size, false); /* offset by lo, i.e. lhs_routed[packet_idx-lo] is set if packet packet_idx is routed */
+        for (size_t packet_idx = lo; packet_idx <= hi; ++packet_idx)
+        {
+            new_permutation[packet_idx] = packet_idx;
+            new_permutation_inv[packet_idx] = packet_idx;
+        }
+        bit_vector &lhs_routed = buffers.lhs_routed; /* indexed by packet_idx, only [lo..hi] is used here */
+        std::fill(lhs_routed.begin() + lo, lhs_routed.begin() + hi + 1, false);
 
         size_t to_route;
         size_t max_unrouted;
@@ -338,14 +354,14 @@ void as_waksman_route_inner(const size_t left,
              * which is not connected to any of the switches at this level
              * of recursion and just passed into the lower subnetwork.
              */
-            if (permutation.get(hi) == hi)
+            if (permutation[hi] == hi)
             {
                 /**
                  * Easy sub-case: it is routed directly to the bottom-most
                  * wire on RHS, so no switches need to be touched.
                  */
-                new_permutation.set(hi, hi);
-                new_permutation_inv.set(hi, hi);
+                new_permutation[hi] = hi;
+                new_permutation_inv[hi] = hi;
                 to_route = hi - 1;
                 route_left = true;
             }
@@ -356,18 +372,18 @@ void as_waksman_route_inner(const size_t left,
                  * on RHS, so route the other value from that switch
                  * using the lower subnetwork.
                  */
-                const size_t rhs_switch = as_waksman_get_canonical_row_idx(lo, permutation.get(hi));
-                const bool rhs_switch_setting = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation.get(hi), false);
+                const size_t rhs_switch = as_waksman_get_canonical_row_idx(lo, permutation[hi]);
+                const bool rhs_switch_setting = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation[hi], false);
                 routing[right][rhs_switch] = rhs_switch_setting;
                 size_t tprime = as_waksman_switch_input(subnetwork_size, lo, rhs_switch, false);
-                new_permutation.set(hi, tprime);
-                new_permutation_inv.set(tprime, hi);
+                new_permutation[hi] = tprime;
+                new_permutation_inv[tprime] = hi;
 
-                to_route = as_waksman_other_output_position(lo, permutation.get(hi));
+                to_route = as_waksman_other_output_position(lo, permutation[hi]);
                 route_left = false;
             }
 
-            lhs_routed[hi-lo] = true;
+            lhs_routed[hi] = true;
             max_unrouted = hi - 1;
         }
         else
@@ -392,40 +408,40 @@ void as_waksman_route_inner(const size_t left,
             {
                 /* If switch value has not been assigned, assign it arbitrarily. */
                 const size_t lhs_switch = as_waksman_get_canonical_row_idx(lo, to_route);
-                if (routing[left].find(lhs_switch) == routing[left].end())
+                if (routing[left][lhs_switch] == as_waksman_no_switch)
                 {
                     routing[left][lhs_switch] = false;
                 }
                 const bool lhs_switch_setting = routing[left][lhs_switch];
                 const bool use_top = as_waksman_get_top_bottom_decision_from_switch_setting(lo, to_route, lhs_switch_setting);
                 const size_t t = as_waksman_switch_output(subnetwork_size, lo, lhs_switch, use_top);
-                if (permutation.get(to_route) == hi)
+                if (permutation[to_route] == hi)
                 {
                     /**
                      * We have routed to the straight wire for the odd case,
                      * so now we back-route from it.
                      */
-                    new_permutation.set(t, hi);
-                    new_permutation_inv.set(hi, t);
-                    lhs_routed[to_route-lo] = true;
+                    new_permutation[t] = hi;
+                    new_permutation_inv[hi] = t;
+                    lhs_routed[to_route] = true;
                     to_route = max_unrouted;
                     route_left = true;
                 }
                 else
                 {
-                    const size_t rhs_switch = as_waksman_get_canonical_row_idx(lo, permutation.get(to_route));
+                    const size_t rhs_switch = as_waksman_get_canonical_row_idx(lo, permutation[to_route]);
                     /**
                      * We know that the corresponding switch on the right-hand side
                      * cannot be set, so we set it according to the incoming wire.
                      */
-                    assert(routing[right].find(rhs_switch) == routing[right].end());
-                    routing[right][rhs_switch] = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation.get(to_route), use_top);
+                    assert(routing[right][rhs_switch] == as_waksman_no_switch);
+                    routing[right][rhs_switch] = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation[to_route], use_top);
                     const size_t tprime = as_waksman_switch_input(subnetwork_size, lo, rhs_switch, use_top);
-                    new_permutation.set(t, tprime);
-                    new_permutation_inv.set(tprime, t);
+                    new_permutation[t] = tprime;
+                    new_permutation_inv[tprime] = t;
 
-                    lhs_routed[to_route-lo] = true;
-                    to_route = as_waksman_other_output_position(lo, permutation.get(to_route));
+                    lhs_routed[to_route] = true;
+                    to_route = as_waksman_other_output_position(lo, permutation[to_route]);
                     route_left = false;
                 }
             }
@@ -436,40 +452,39 @@ void as_waksman_route_inner(const size_t left,
                  * Next, we back route from here.
                  */
                 const size_t rhs_switch = as_waksman_get_canonical_row_idx(lo, to_route);
-                const size_t lhs_switch = as_waksman_get_canonical_row_idx(lo, permutation_inv.get(to_route));
-                assert(routing[right].find(rhs_switch) != routing[right].end());
+                const size_t lhs_switch = as_waksman_get_canonical_row_idx(lo, permutation_inv[to_route]);
+                assert(routing[right][rhs_switch] != as_waksman_no_switch);
                 const bool rhs_switch_setting = routing[right][rhs_switch];
                 const bool use_top = as_waksman_get_top_bottom_decision_from_switch_setting(lo, to_route, rhs_switch_setting);
-                const bool lhs_switch_setting = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation_inv.get(to_route), use_top);
+                const bool lhs_switch_setting = as_waksman_get_switch_setting_from_top_bottom_decision(lo, permutation_inv[to_route], use_top);
 
                 /* The value on the left-hand side is either the same or not set. */
-                auto it = routing[left].find(lhs_switch);
-                assert(it == routing[left].end() || it->second == lhs_switch_setting);
+                assert(routing[left][lhs_switch] == as_waksman_no_switch || routing[left][lhs_switch] == lhs_switch_setting);
                 routing[left][lhs_switch] = lhs_switch_setting;
 
                 const size_t t = as_waksman_switch_input(subnetwork_size, lo, rhs_switch, use_top);
                 const size_t tprime = as_waksman_switch_output(subnetwork_size, lo, lhs_switch, use_top);
-                new_permutation.set(tprime, t);
-                new_permutation_inv.set(t, tprime);
+                new_permutation[tprime] = t;
+                new_permutation_inv[t] = tprime;
 
-                lhs_routed[permutation_inv.get(to_route)-lo] = true;
-                to_route = as_waksman_other_input_position(lo, permutation_inv.get(to_route));
+                lhs_routed[permutation_inv[to_route]] = true;
+                to_route = as_waksman_other_input_position(lo, permutation_inv[to_route]);
                 route_left = true;
             }
 
             /* If the next packet to be routed hasn't been routed before, then try routing it. */
-            if (!route_left || !lhs_routed[to_route-lo])
+            if (!route_left || !lhs_routed[to_route])
             {
                 continue;
             }
 
             /* Otherwise just find the next unrouted packet. */
-            while (max_unrouted > lo && lhs_routed[max_unrouted-lo])
+            while (max_unrouted > lo && lhs_routed[max_unrouted])
             {
                 --max_unrouted;
             }
 
-            if (max_unrouted < lo || (max_unrouted == lo && lhs_routed[0])) /* lhs_routed[0] = corresponds to lo shifted by lo */
+            if (max_unrouted < lo || (max_unrouted == lo && lhs_routed[lo]))
             {
                 /* All routed! */
                 break;
@@ -484,28 +499,60 @@ void as_waksman_route_inner(const size_t left,
         if (subnetwork_size % 2 == 0)
         {
             /* Remove the AS-Waksman switch with the fixed value. */
-            routing[left].erase(hi-1);
+            routing[left][hi-1] = as_waksman_no_switch;
         }
 
         const size_t d = as_waksman_top_height(subnetwork_size);
-        const integer_permutation new_permutation_upper = new_permutation.slice(lo, lo + d - 1);
-        const integer_permutation new_permutation_lower = new_permutation.slice(lo + d, hi);
+        as_waksman_route_inner(left+1, right-1, lo, lo + d - 1, depth + 1, buffers);
+        as_waksman_route_inner(left+1, right-1, lo + d, hi, depth + 1, buffers);
+    }
+}
+
+void get_as_waksman_routing(const integer_permutation &permutation, as_waksman_routing_buffers &buffers)
+{
+    const size_t num_packets = permutation.size();
+    const size_t width = as_waksman_num_columns(num_packets);
+    assert(permutation.min_element == 0);
+
+    buffers.switch_settings.resize(width);
+    for (size_t column_idx = 0; column_idx < width; ++column_idx)
+    {
+        buffers.switch_settings[column_idx].assign(num_packets, as_waksman_no_switch);
+    }
 
-        const integer_permutation new_permutation_inv_upper = new_permutation_inv.slice(lo, lo + d - 1);
-        const integer_permutation new_permutation_inv_lower = new_permutation_inv.slice(lo + d, hi);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        buffers.permutation[i].resize(num_packets);
+        buffers.permutation_inv[i].resize(num_packets);
+    }
+    buffers.lhs_routed.resize(num_packets);
 
-        as_waksman_route_inner(left+1, right-1, lo, lo + d - 1, new_permutation_upper, new_permutation_inv_upper, routing);
-        as_waksman_route_inner(left+1, right-1, lo + d, hi, new_permutation_lower, new_permutation_inv_lower, routing);
+    for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
+    {
+        buffers.permutation[0][packet_idx] = permutation.get(packet_idx);
+        buffers.permutation_inv[0][permutation.get(packet_idx)] = packet_idx;
     }
+
+    as_waksman_route_inner(0, width-1, 0, num_packets-1, 0, buffers);
 }
 
 as_waksman_routing get_as_waksman_routing(const integer_permutation &permutation)
 {
-    const size_t num_packets = permutation.size();
-    const size_t width = as_waksman_num_columns(num_packets);
+    as_waksman_routing_buffers buffers;
+    get_as_waksman_routing(permutation, buffers);
+
+    as_waksman_routing routing(buffers.switch_settings.size());
+    for (size_t column_idx = 0; column_idx < routing.size(); ++column_idx)
+    {
+        for (size_t packet_idx = 0; packet_idx < permutation.size(); ++packet_idx)
+        {
+            if (buffers.switch_settings[column_idx][packet_idx] != as_waksman_no_switch)
+            {
+                routing[column_idx][packet_idx] = buffers.switch_settings[column_idx][packet_idx];
+            }
+        }
+    }
 
-    as_waksman_routing routing(width);
-    as_waksman_route_inner(0, width-1, 0, num_packets-1, permutation, permutation.inverse(), routing);
     return routing;
 }
 
@@ -99,6 +99,31 @@ typedef std::vector<std::vector<std::pair<size_t, size_t> > > as_waksman_topolog
  */
 typedef std::vector<std::map<size_t, bool> > as_waksman_routing;
 
+/**
+ * Marks a position that is not the canonical position of a switch in
+ * as_waksman_routing_buffers::switch_settings (see below).
+ */
+const char as_waksman_no_switch = 2;
+
+/**
+ * Buffers for routing many permutations of the same size (e.g. one
+ * per proof) without allocating on every call.
+ *
+ * After get_as_waksman_routing(permutation, buffers), the routing is
+ * stored flat: switch_settings[column_idx][packet_idx] is 0 ("straight")
+ * or 1 ("cross") for the switch with canonical position
+ * (column_idx,packet_idx), and as_waksman_no_switch elsewhere.
+ *
+ * The remaining members are scratch space of the routing algorithm.
+ */
+class as_waksman_routing_buffers {
+public:
+    std::vector<std::vector<char> > switch_settings;
+
+    std::vector<size_t> permutation[2], permutation_inv[2]; /* alternate between recursion levels */
+    bit_vector lhs_routed;
+};
+
 /**
  * Return the number of (switch) columns in a AS-Waksman network for a given number of packets.
  *
@@ -122,6 +147,13 @@ as_waksman_topology generate_as_waksman_topology(const size_t num_packets);
  */
 as_waksman_routing get_as_waksman_routing(const integer_permutation &permutation);
 
+/**
+ * Route the given permutation on an AS-Waksman network of suitable
+ * size, storing the result in buffers.switch_settings and reusing the
+ * memory of previous calls.
+ */
+void get_as_waksman_routing(const integer_permutation &permutation, as_waksman_routing_buffers &buffers);
+
 /**
  * Check if a routing "implements" the given permutation.
  */
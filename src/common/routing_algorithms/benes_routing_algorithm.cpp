@@ -12,6 +12,7 @@
  *****************************************************************************/
 
 #include "common/routing_algorithms/benes_routing_algorithm.hpp"
+#include <algorithm>
 #include <cassert>
 
 namespace libsnark {
@@ -147,23 +148,32 @@ benes_topology generate_benes_topology(const size_t num_packets)
  * The network from t_start to t_end is the part of the Benes network
  * that needs to be routed according to the permutation pi.
  *
- * The permutation
- * - pi maps [subnetwork_offset..subnetwork_offset+subnetwork_size-1] to itself, offset by subnetwork_offset, and
- * - piinv is the inverse of pi.
+ * The permutation pi maps [subnetwork_offset..subnetwork_offset+subnetwork_size-1]
+ * to itself. It and its inverse piinv are read from these positions of
+ * buffers.permutation[depth % 2] and buffers.permutation_inv[depth % 2];
+ * the permutations for the two subnetworks are written to the same
+ * positions of the other pair of buffers.
  */
 void route_benes_inner(const size_t dimension,
-                       const integer_permutation &permutation,
-                       const integer_permutation &permutation_inv,
+                       const size_t depth,
                        const size_t column_idx_start,
                        const size_t column_idx_end,
                        const size_t subnetwork_offset,
                        const size_t subnetwork_size,
-                       benes_routing &routing)
+                       benes_routing_buffers &buffers)
 {
+    const std::vector<size_t> &permutation = buffers.permutation[depth % 2];
+    const std::vector<size_t> &permutation_inv = buffers.permutation_inv[depth % 2];
+    std::vector<size_t> &new_permutation = buffers.permutation[(depth + 1) % 2];
+    std::vector<size_t> &new_permutation_inv = buffers.permutation_inv[(depth + 1) % 2];
+    benes_routing &routing = buffers.routing;
+
 #ifdef DEBUG
-    assert(permutation.size() == subnetwork_size);
-    assert(permutation.is_valid());
-    assert(permutation.inverse() == permutation_inv);
+    for (size_t packet_idx = subnetwork_offset; packet_idx < subnetwork_offset + subnetwork_size; ++packet_idx)
+    {
+        assert(subnetwork_offset <= permutation[packet_idx] && permutation[packet_idx] < subnetwork_offset + subnetwork_size);
+        assert(permutation_inv[permutation[packet_idx]] == packet_idx);
+    }
 #endif
 
     if (column_idx_start == column_idx_end)
@@ -171,13 +181,17 @@ void route_benes_inner(const size_t dimension,
         /* nothing to route */
         return;
     }
-    bit_vector lhs_routed(subnetwork_size, false); /* adjusted by subnetwork_offset */
+    bit_vector &lhs_routed = buffers.lhs_routed; /* indexed by packet_idx, only this subnetwork's positions are used here */
+    std::fill(lhs_routed.begin() + subnetwork_offset, lhs_routed.begin() + subnetwork_offset + subnetwork_size, false);
 
     size_t w = subnetwork_offset; /* left-hand-side vertex to be routed. */
     size_t last_unrouted = subnetwork_offset;
 
-    integer_permutation new_permutation(subnetwork_offset, subnetwork_offset + subnetwork_size - 1);
-    integer_permutation new_permutation_inv(subnetwork_offset, subnetwork_offset + subnetwork_size - 1);
+    for (size_t packet_idx = subnetwork_offset; packet_idx < subnetwork_offset + subnetwork_size; ++packet_idx)
+    {
+        new_permutation[packet_idx] = packet_idx;
+        new_permutation_inv[packet_idx] = packet_idx;
+    }
 
     while (true)
     {
@@ -188,39 +202,39 @@ void route_benes_inner(const size_t dimension,
          */
 
         /* route w to its target on RHS, wprime = pi[w], using upper network */
-        size_t wprime = permutation.get(w);
+        size_t wprime = permutation[w];
 
         /* route (column_idx_start, w) forward via top subnetwork */
         routing[column_idx_start][w] = benes_get_switch_setting_from_subnetwork(dimension, column_idx_start, w, true);
-        new_permutation.set(benes_lhs_packet_destination(dimension, column_idx_start, w, true), benes_rhs_packet_source(dimension, column_idx_end, wprime, true));
-        lhs_routed[w-subnetwork_offset] = true;
+        new_permutation[benes_lhs_packet_destination(dimension, column_idx_start, w, true)] = benes_rhs_packet_source(dimension, column_idx_end, wprime, true);
+        lhs_routed[w] = true;
 
         /* route (column_idx_end, wprime) backward via top subnetwork */
         routing[column_idx_end-1][benes_rhs_packet_source(dimension, column_idx_end, wprime, true)] = benes_get_switch_setting_from_subnetwork(dimension, column_idx_end-1, wprime, true);
-        new_permutation_inv.set(benes_rhs_packet_source(dimension, column_idx_end, wprime, true), benes_lhs_packet_destination(dimension, column_idx_start, w, true));
+        new_permutation_inv[benes_rhs_packet_source(dimension, column_idx_end, wprime, true)] = benes_lhs_packet_destination(dimension, column_idx_start, w, true);
 
         /* now the other neighbor of wprime must be back-routed via the lower network, so get vprime, the neighbor on RHS and v, its target on LHS */
         const size_t vprime = benes_packet_cross_source(dimension, column_idx_end, wprime);
-        const size_t v = permutation_inv.get(vprime);
-        assert(!lhs_routed[v-subnetwork_offset]);
+        const size_t v = permutation_inv[vprime];
+        assert(!lhs_routed[v]);
 
         /* back-route (column_idx_end, vprime) using the lower subnetwork */
         routing[column_idx_end-1][benes_rhs_packet_source(dimension, column_idx_end, vprime, false)] = benes_get_switch_setting_from_subnetwork(dimension, column_idx_end-1, vprime, false);
-        new_permutation_inv.set(benes_rhs_packet_source(dimension, column_idx_end, vprime, false), benes_lhs_packet_destination(dimension, column_idx_start, v, false));
+        new_permutation_inv[benes_rhs_packet_source(dimension, column_idx_end, vprime, false)] = benes_lhs_packet_destination(dimension, column_idx_start, v, false);
 
         /* forward-route (column_idx_start, v) using the lower subnetwork */
         routing[column_idx_start][v] = benes_get_switch_setting_from_subnetwork(dimension, column_idx_start, v, false);
-        new_permutation.set(benes_lhs_packet_destination(dimension, column_idx_start, v, false), benes_rhs_packet_source(dimension, column_idx_end, vprime, false));
-        lhs_routed[v-subnetwork_offset] = true;
+        new_permutation[benes_lhs_packet_destination(dimension, column_idx_start, v, false)] = benes_rhs_packet_source(dimension, column_idx_end, vprime, false);
+        lhs_routed[v] = true;
 
         /* if the other neighbor of v is not routed, route it; otherwise, find the next unrouted node  */
-        if (!lhs_routed[benes_packet_cross_destination(dimension, column_idx_start, v) - subnetwork_offset])
+        if (!lhs_routed[benes_packet_cross_destination(dimension, column_idx_start, v)])
         {
             w = benes_packet_cross_destination(dimension, column_idx_start, v);
         }
         else
         {
-            while ((last_unrouted < subnetwork_offset + subnetwork_size) && lhs_routed[last_unrouted-subnetwork_offset])
+            while ((last_unrouted < subnetwork_offset + subnetwork_size) && lhs_routed[last_unrouted])
             {
                 ++last_unrouted;
             }
@@ -236,32 +250,49 @@ void route_benes_inner(const size_t dimension,
         }
     }
 
-    const integer_permutation new_permutation_upper = new_permutation.slice(subnetwork_offset, subnetwork_offset + subnetwork_size/2 - 1);
-    const integer_permutation new_permutation_lower = new_permutation.slice(subnetwork_offset + subnetwork_size/2, subnetwork_offset + subnetwork_size - 1);
-
-    const integer_permutation new_permutation_inv_upper = new_permutation_inv.slice(subnetwork_offset, subnetwork_offset + subnetwork_size/2 - 1);
-    const integer_permutation new_permutation_inv_lower = new_permutation_inv.slice(subnetwork_offset + subnetwork_size/2, subnetwork_offset + subnetwork_size - 1);
-
     /* route upper part */
-    route_benes_inner(dimension, new_permutation_upper, new_permutation_inv_upper, column_idx_start+1, column_idx_end-1,
-                      subnetwork_offset, subnetwork_size/2, routing);
+    route_benes_inner(dimension, depth+1, column_idx_start+1, column_idx_end-1,
+                      subnetwork_offset, subnetwork_size/2, buffers);
 
     /* route lower part */
-    route_benes_inner(dimension, new_permutation_lower, new_permutation_inv_lower, column_idx_start+1, column_idx_end-1,
-                      subnetwork_offset+subnetwork_size/2, subnetwork_size/2, routing);
+    route_benes_inner(dimension, depth+1, column_idx_start+1, column_idx_end-1,
+                      subnetwork_offset+subnetwork_size/2, subnetwork_size/2, buffers);
 }
 
-benes_routing get_benes_routing(const integer_permutation &permutation)
+void get_benes_routing(const integer_permutation &permutation, benes_routing_buffers &buffers)
 {
     const size_t num_packets = permutation.size();
     const size_t num_columns = benes_num_columns(num_packets);
     const size_t dimension = log2(num_packets);
+    assert(permutation.min_element == 0);
 
-    benes_routing routing(num_columns, bit_vector(num_packets));
+    buffers.routing.resize(num_columns);
+    for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
+    {
+        buffers.routing[column_idx].assign(num_packets, false);
+    }
 
-    route_benes_inner(dimension, permutation, permutation.inverse(), 0, num_columns, 0, num_packets, routing);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        buffers.permutation[i].resize(num_packets);
+        buffers.permutation_inv[i].resize(num_packets);
+    }
+    buffers.lhs_routed.resize(num_packets);
+
+    for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
+    {
+        buffers.permutation[0][packet_idx] = permutation.get(packet_idx);
+        buffers.permutation_inv[0][permutation.get(packet_idx)] = packet_idx;
+    }
+
+    route_benes_inner(dimension, 0, 0, num_columns, 0, num_packets, buffers);
+}
 
-    return routing;
+benes_routing get_benes_routing(const integer_permutation &permutation)
+{
+    benes_routing_buffers buffers;
+    get_benes_routing(permutation, buffers);
+    return buffers.routing;
 }
 
 /* auxuliary function that is used in valid_benes_routing below */
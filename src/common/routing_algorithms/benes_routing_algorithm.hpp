@@ -58,6 +58,20 @@ typedef std::vector<std::vector<std::pair<size_t, size_t> > > benes_topology;
  */
 typedef std::vector<bit_vector> benes_routing;
 
+/**
+ * Buffers for routing many permutations of the same size (e.g. one
+ * per proof) without allocating on every call. After
+ * get_benes_routing(permutation, buffers) the result is in routing;
+ * the remaining members are scratch space of the routing algorithm.
+ */
+class benes_routing_buffers {
+public:
+    benes_routing routing;
+
+    std::vector<size_t> permutation[2], permutation_inv[2]; /* alternate between recursion levels */
+    bit_vector lhs_routed;
+};
+
 /**
  * Return the number of (switch) columns in a Benes network for a given number of packets.
  *
@@ -81,6 +95,13 @@ benes_topology generate_benes_topology(const size_t num_packets);
  */
 benes_routing get_benes_routing(const integer_permutation &permutation);
 
+/**
+ * Route the given permutation on a Benes network of suitable size,
+ * storing the result in buffers.routing and reusing the memory of
+ * previous calls.
+ */
+void get_benes_routing(const integer_permutation &permutation, benes_routing_buffers &buffers);
+
 /**
  * Check if a routing "implements" the given permutation.
  */
@@ -102,6 +102,37 @@ std::istream& operator>>(std::istream& in, std::vector<T> &v)
     return in;
 }
 
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const std::set<T> &s)
+{
+    out << s.size() << "\n";
+    for (const T& t : s)
+    {
+        out << t << "\n";
+    }
+
+    return out;
+}
+
+template<typename T>
+std::istream& operator>>(std::istream& in, std::set<T> &s)
+{
+    size_t size;
+    in >> size;
+    consume_newline(in);
+
+    s.clear();
+    for (size_t i = 0; i < size; ++i)
+    {
+        T elt;
+        in >> elt;
+        consume_newline(in);
+        s.insert(elt);
+    }
+
+    return in;
+}
+
 }
 
 #endif // SERIALIZATION_TCC_
@@ -11,6 +11,8 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdarg>
+#include <cstdio>
+#include <stdexcept>
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -79,6 +81,21 @@ bool is_little_endian()
     return (*c = 0x78);
 }
 
+void read_random_bytes(void *data, const size_t num_bytes)
+{
+    FILE *fp = fopen("/dev/urandom", "r");
+    if (fp == NULL)
+    {
+        throw std::runtime_error("cannot open /dev/urandom");
+    }
+    const size_t bytes_read = fread(data, 1, num_bytes, fp);
+    fclose(fp);
+    if (bytes_read != num_bytes)
+    {
+        throw std::runtime_error("cannot read from /dev/urandom");
+    }
+}
+
 std::string FORMAT(const std::string &prefix, const char* format, ...)
 {
     const static size_t MAX_FMT = 256;
@@ -34,6 +34,9 @@ long long div_ceil(long long x, long long y);
 
 bool is_little_endian();
 
+/// fills data with num_bytes bytes from the operating system's randomness source (/dev/urandom); throws std::runtime_error if it cannot be read
+void read_random_bytes(void *data, const size_t num_bytes);
+
 std::string FORMAT(const std::string &prefix, const char* format, ...);
 
 #ifdef DEBUG
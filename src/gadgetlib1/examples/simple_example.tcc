@@ -44,10 +44,9 @@ r1cs_example<FieldT> gen_r1cs_example_from_protoboard(const size_t num_constrain
 
     compute_inner_product.generate_r1cs_witness();
 
-    pb.constraint_system.num_inputs = num_inputs;
-    const r1cs_variable_assignment<FieldT> va = pb.values;
-    const r1cs_variable_assignment<FieldT> input(va.begin(), va.begin() + num_inputs);
-    return r1cs_example<FieldT>(pb.constraint_system, input, va, num_inputs);
+    /* the protoboard keeps its constraints in a compact arena, which get_constraint_system() expands */
+    pb.set_input_sizes(num_inputs);
+    return r1cs_example<FieldT>(pb.get_constraint_system(), pb.primary_input(), pb.auxiliary_input());
 }
 
 } // libsnark
@@ -43,6 +43,7 @@
 #ifndef KNAPSACK_GADGET_HPP_
 #define KNAPSACK_GADGET_HPP_
 
+#include "common/data_structures/packed_bit_vector.hpp"
 #include "gadgetlib1/gadgets/basic_gadgets.hpp"
 #include "gadgetlib1/gadgets/hashes/hash_io.hpp"
 
@@ -83,6 +84,7 @@ public:
     static size_t get_digest_len();
     size_t get_block_len() const;
     static std::vector<FieldT> get_hash(const bit_vector &input);
+    static std::vector<FieldT> get_hash(const packed_bit_vector &input);
     static void sample_randomness(const size_t input_len);
 
     /* for debugging */
@@ -119,6 +121,7 @@ public:
     static size_t get_digest_len();
     size_t get_block_len() const;
     static hash_value_type get_hash(const bit_vector &input);
+    static hash_value_type get_hash(const packed_bit_vector &input);
     static void sample_randomness(const size_t input_len);
 
     /* for debugging */
@@ -99,21 +99,24 @@ size_t knapsack_CRH_with_field_out_gadget<FieldT>::get_block_len() const
 
 template<typename FieldT>
 std::vector<FieldT> knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(const bit_vector &input)
+{
+    return get_hash(packed_bit_vector(input));
+}
+
+template<typename FieldT>
+std::vector<FieldT> knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(const packed_bit_vector &input)
 {
     const size_t dimension = knapsack_dimension<FieldT>::dimension;
     assert(num_cached_coefficients >= dimension * input.size());
 
     std::vector<FieldT> result(dimension, FieldT::zero());
 
+    /* only the set bits contribute, so walk them word by word */
     for (size_t i = 0; i < dimension; ++i)
     {
-        for (size_t k = 0; k < input.size(); ++k)
-        {
-            if (input[k])
-            {
-                result[i] += knapsack_coefficients[input.size()*i + k];
-            }
-        }
+        const FieldT *coefficients = &knapsack_coefficients[input.size()*i];
+        FieldT &sum = result[i];
+        input.for_each_set_bit([coefficients, &sum](const size_t k) { sum += coefficients[k]; });
     }
 
     return result;
@@ -131,11 +134,10 @@ void knapsack_CRH_with_field_out_gadget<FieldT>::sample_randomness(const size_t
     const size_t num_coefficients = knapsack_dimension<FieldT>::dimension * input_len;
     if (num_coefficients > num_cached_coefficients)
     {
-        knapsack_coefficients.resize(num_coefficients);
-        for (size_t i = num_cached_coefficients; i < num_coefficients; ++i)
-        {
-            knapsack_coefficients[i] = SHA512_rng<FieldT>(i);
-        }
+        const std::vector<FieldT> new_coefficients = SHA512_rng_bulk<FieldT>(num_cached_coefficients,
+                                                                             num_coefficients - num_cached_coefficients,
+                                                                             SHA512_rng_compat);
+        knapsack_coefficients.insert(knapsack_coefficients.end(), new_coefficients.begin(), new_coefficients.end());
         num_cached_coefficients = num_coefficients;
     }
 }
@@ -224,16 +226,14 @@ size_t knapsack_CRH_with_bit_out_gadget<FieldT>::get_block_len() const
 template<typename FieldT>
 bit_vector knapsack_CRH_with_bit_out_gadget<FieldT>::get_hash(const bit_vector &input)
 {
-    const std::vector<FieldT> hash_elems = knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(input);
-    hash_value_type result;
-
-    for (const FieldT &elt : hash_elems)
-    {
-        bit_vector elt_bits = convert_field_element_to_bit_vector<FieldT>(elt);
-        result.insert(result.end(), elt_bits.begin(), elt_bits.end());
-    }
+    return get_hash(packed_bit_vector(input));
+}
 
-    return result;
+template<typename FieldT>
+bit_vector knapsack_CRH_with_bit_out_gadget<FieldT>::get_hash(const packed_bit_vector &input)
+{
+    const std::vector<FieldT> hash_elems = knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(input);
+    return convert_field_element_vector_to_packed_bit_vector<FieldT>(hash_elems).to_bit_vector();
 }
 
 template<typename FieldT>
@@ -0,0 +1,153 @@
+/** @file
+ *****************************************************************************
+
+ Microbenchmarks for the native (out-of-circuit) bit vector hot paths:
+ packing bits into field elements (compared against the straightforward
+ bit-by-bit loop over a bit_vector), knapsack hashing (from a bit_vector and
+ from a packed_bit_vector), and Merkle tree updates of delegated_ra_memory.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "gadgetlib1/gadgets/hashes/knapsack/knapsack_gadget.hpp"
+#include "relations/ram_computations/memory/delegated_ra_memory.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+std::vector<FieldT> reference_pack(const bit_vector &v, const size_t chunk_bits)
+{
+    const size_t repacked_size = div_ceil(v.size(), chunk_bits);
+    std::vector<FieldT> result(repacked_size);
+
+    for (size_t i = 0; i < repacked_size; ++i)
+    {
+        bigint<FieldT::num_limbs> b;
+        for (size_t j = 0; j < chunk_bits; ++j)
+        {
+            b.data[j / GMP_NUMB_BITS] |= ((i * chunk_bits + j) < v.size() && v[i * chunk_bits + j] ? 1ll : 0ll) << (j % GMP_NUMB_BITS);
+        }
+        result[i] = FieldT(b);
+    }
+
+    return result;
+}
+
+bit_vector random_bits(const size_t n)
+{
+    bit_vector result(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = std::rand() % 2;
+    }
+    return result;
+}
+
+template<typename FieldT>
+void profile_packing(const size_t num_bits, const size_t reps)
+{
+    const bit_vector bits = random_bits(num_bits);
+    const size_t chunk_bits = FieldT::capacity();
+
+    long long start = get_nsec_time();
+    std::vector<FieldT> ref;
+    for (size_t r = 0; r < reps; ++r)
+    {
+        ref = reference_pack<FieldT>(bits, chunk_bits);
+    }
+    const long long ref_time = get_nsec_time() - start;
+
+    start = get_nsec_time();
+    std::vector<FieldT> res;
+    for (size_t r = 0; r < reps; ++r)
+    {
+        res = pack_bit_vector_into_field_element_vector<FieldT>(packed_bit_vector(bits), chunk_bits);
+    }
+    const long long time = get_nsec_time() - start;
+
+    const packed_bit_vector packed(bits);
+    start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        res = pack_bit_vector_into_field_element_vector<FieldT>(packed, chunk_bits);
+    }
+    const long long packed_time = get_nsec_time() - start;
+    assert(res == ref);
+
+    printf("pack %6zu bits:   %8.3f ms (from bit_vector %8.3f ms, reference %8.3f ms, speedup %0.2fx)\n",
+           num_bits, packed_time * 1e-6, time * 1e-6, ref_time * 1e-6, 1. * ref_time / time);
+}
+
+template<typename FieldT>
+void profile_knapsack(const size_t input_len, const size_t reps)
+{
+    knapsack_CRH_with_field_out_gadget<FieldT>::sample_randomness(input_len);
+    const bit_vector input = random_bits(input_len);
+    const packed_bit_vector packed_input(input);
+
+    long long start = get_nsec_time();
+    std::vector<FieldT> res;
+    for (size_t r = 0; r < reps; ++r)
+    {
+        res = knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(input);
+    }
+    const long long time = get_nsec_time() - start;
+
+    start = get_nsec_time();
+    std::vector<FieldT> packed_res;
+    for (size_t r = 0; r < reps; ++r)
+    {
+        packed_res = knapsack_CRH_with_field_out_gadget<FieldT>::get_hash(packed_input);
+    }
+    const long long packed_time = get_nsec_time() - start;
+    assert(res == packed_res);
+
+    printf("knapsack %6zu bits: %8.3f ms (from bit_vector %8.3f ms)\n",
+           input_len, packed_time * 1e-6, time * 1e-6);
+}
+
+template<typename FieldT>
+void profile_merkle_updates(const size_t num_addresses, const size_t num_updates)
+{
+    typedef knapsack_CRH_with_bit_out_gadget<FieldT> HashT;
+
+    const size_t value_size = 64;
+    delegated_ra_memory<HashT> mem(num_addresses, value_size);
+
+    const long long start = get_nsec_time();
+    for (size_t i = 0; i < num_updates; ++i)
+    {
+        mem.set_value(std::rand() % num_addresses, std::rand());
+    }
+    const long long time = get_nsec_time() - start;
+
+    printf("merkle updates (%zu addresses): %8.3f us per update\n",
+           num_addresses, time * 1e-3 / num_updates);
+}
+
+int main(void)
+{
+    start_profiling();
+    default_ec_pp::init_public_params();
+    typedef Fr<default_ec_pp> FieldT;
+
+    for (size_t num_bits = 1ul<<8; num_bits <= 1ul<<16; num_bits *= 4)
+    {
+        profile_packing<FieldT>(num_bits, (1ul<<22) / num_bits);
+    }
+
+    for (size_t input_len = 1ul<<8; input_len <= 1ul<<14; input_len *= 4)
+    {
+        profile_knapsack<FieldT>(input_len, (1ul<<20) / input_len);
+    }
+
+    profile_merkle_updates<FieldT>(1ul<<16, 1000);
+}
@@ -0,0 +1,122 @@
+/** @file
+ *****************************************************************************
+
+ Memory taken by the constraints of a protoboard, for the r1cs_ppzksnark
+ verifier gadget and the TinyRAM universal gadget: the compact constraint
+ arena used by protoboard versus the same constraints stored as
+ std::vector<r1cs_constraint<FieldT> >.
+
+ The arena only saves memory while a circuit is built and checked: the
+ generators and provers take an r1cs_constraint_system, so the arena is
+ expanded when the constraints are handed off. The peak at that point is
+ also reported, for get_constraint_system() (which keeps the protoboard's
+ constraints, as did the std::vector the protoboard used to hold) and for
+ release_constraint_system() (which frees the arena right after expanding
+ it, leaving only the expanded constraints). All sizes are computed from
+ element counts, without vector slack or allocator overhead.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cstdio>
+
+#include "algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#include "common/default_types/tinyram_ppzksnark_pp.hpp"
+#include "common/profiling.hpp"
+#include "gadgetlib1/gadgets/verifiers/r1cs_ppzksnark_verifier_gadget.hpp"
+#include "reductions/ram_to_r1cs/ram_to_r1cs.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+void report_constraint_storage(const std::string &name, protoboard<FieldT> &pb)
+{
+    const r1cs_constraint_arena<FieldT> &arena = pb.get_constraint_arena();
+    const size_t compact = arena.size_in_bytes();
+    const size_t expanded = arena.expanded_size_in_bytes();
+
+    printf("%-30s: %8zu constraints, %9zu terms (%8zu distinct pooled coefficients): arena %8.2f MB, std::vector %8.2f MB, ratio %0.2fx\n",
+           name.c_str(), arena.size(), arena.num_terms(), arena.num_pool_coeffs(),
+           compact / 1048576., expanded / 1048576., 1. * expanded / compact);
+    printf("%-30s  hand-off peak: get_constraint_system %8.2f MB (std::vector protoboard: %8.2f MB), release_constraint_system %8.2f MB, then %8.2f MB\n",
+           "", (compact + expanded) / 1048576., 2. * expanded / 1048576., (compact + expanded) / 1048576., expanded / 1048576.);
+
+    /* the arena must expand back to the constraints the gadgets added */
+    const r1cs_constraint_system<FieldT> cs = pb.get_constraint_system();
+    assert(cs.num_constraints() == arena.size());
+    for (size_t i = 0; i < cs.num_constraints(); i += 1 + cs.num_constraints() / 1000)
+    {
+        FieldT ares, bres, cres;
+        arena.evaluate(i, pb.full_variable_assignment(), ares, bres, cres);
+        assert(ares == cs.constraints[i].a.evaluate(pb.full_variable_assignment()));
+        assert(bres == cs.constraints[i].b.evaluate(pb.full_variable_assignment()));
+        assert(cres == cs.constraints[i].c.evaluate(pb.full_variable_assignment()));
+    }
+
+    /* releasing gives the same constraints, and leaves the arena empty */
+    const r1cs_constraint_system<FieldT> released = pb.release_constraint_system();
+    assert(released.constraints == cs.constraints);
+    assert(released.primary_input_size == cs.primary_input_size && released.auxiliary_input_size == cs.auxiliary_input_size);
+    assert(pb.get_constraint_arena().size() == 0);
+}
+
+template<typename ppT_A, typename ppT_B>
+void profile_verifier_storage(const std::string &name, const size_t primary_input_size)
+{
+    typedef Fr<ppT_A> FieldT_A;
+    typedef Fr<ppT_B> FieldT_B;
+
+    const size_t elt_size = FieldT_A::size_in_bits();
+    const size_t vk_size_in_bits = r1cs_ppzksnark_verification_key_variable<ppT_B>::size_in_bits(primary_input_size);
+
+    protoboard<FieldT_B> pb;
+    pb_variable_array<FieldT_B> vk_bits;
+    vk_bits.allocate(pb, vk_size_in_bits, "vk_bits");
+
+    pb_variable_array<FieldT_B> primary_input_bits;
+    primary_input_bits.allocate(pb, elt_size * primary_input_size, "primary_input_bits");
+
+    r1cs_ppzksnark_proof_variable<ppT_B> proof(pb, "proof");
+    r1cs_ppzksnark_verification_key_variable<ppT_B> vk(pb, vk_bits, primary_input_size, "vk");
+
+    pb_variable<FieldT_B> result;
+    result.allocate(pb, "result");
+
+    r1cs_ppzksnark_verifier_gadget<ppT_B> verifier(pb, vk, primary_input_bits, elt_size, proof, result, "verifier");
+    proof.generate_r1cs_constraints();
+    verifier.generate_r1cs_constraints();
+
+    report_constraint_storage(name, pb);
+}
+
+void profile_tinyram_storage(const size_t w, const size_t k, const size_t boot_trace_size_bound, const size_t time_bound)
+{
+    typedef default_tinyram_ppzksnark_pp::machine_pp ramT;
+
+    const ram_architecture_params<ramT> ap(w, k);
+    ram_to_r1cs<ramT> r(ap, boot_trace_size_bound, time_bound);
+    r.instance_map();
+
+    char name[64];
+    snprintf(name, sizeof(name), "tinyram (w=%zu, k=%zu, T=%zu)", w, k, time_bound);
+    report_constraint_storage(name, r.main_protoboard);
+}
+
+int main(int argc, const char * argv[])
+{
+    start_profiling();
+    inhibit_profiling_info = true;
+    mnt4_pp::init_public_params();
+    mnt6_pp::init_public_params();
+    default_tinyram_ppzksnark_pp::init_public_params();
+
+    profile_verifier_storage<mnt4_pp, mnt6_pp>("verifier (mnt4 proof in mnt6)", 3);
+    profile_verifier_storage<mnt6_pp, mnt4_pp>("verifier (mnt6 proof in mnt4)", 3);
+
+    profile_tinyram_storage(16, 16, 102, 20);
+    profile_tinyram_storage(32, 16, 102, 20);
+}
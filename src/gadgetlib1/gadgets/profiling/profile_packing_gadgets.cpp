@@ -0,0 +1,126 @@
+/** @file
+ *****************************************************************************
+
+ Microbenchmarks for the witness generation of packing_gadget and
+ multipacking_gadget, compared against the straightforward bit-by-bit loops
+ (one field doubling and addition per bit, FieldT::one() per assigned bit).
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "gadgetlib1/gadgets/basic_gadgets.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+FieldT reference_pack(const protoboard<FieldT> &pb, const pb_variable_array<FieldT> &bits)
+{
+    FieldT result = FieldT::zero();
+    for (size_t i = 0; i < bits.size(); ++i)
+    {
+        result += result + pb.val(bits[bits.size()-1-i]);
+    }
+    return result;
+}
+
+template<typename FieldT>
+void reference_unpack(protoboard<FieldT> &pb, const pb_variable_array<FieldT> &bits, const FieldT &r)
+{
+    const bigint<FieldT::num_limbs> rint = r.as_bigint();
+    for (size_t i = 0; i < bits.size(); ++i)
+    {
+        pb.val(bits[i]) = rint.test_bit(i) ? FieldT::one() : FieldT::zero();
+    }
+}
+
+template<typename FieldT>
+void profile_multipacking(const size_t num_bits, const size_t reps)
+{
+    const size_t chunk_size = FieldT::capacity();
+    const size_t num_chunks = div_ceil(num_bits, chunk_size);
+
+    protoboard<FieldT> pb;
+    pb_variable_array<FieldT> bits;
+    pb_variable_array<FieldT> packed;
+    bits.allocate(pb, num_bits, "bits");
+    packed.allocate(pb, num_chunks, "packed");
+
+    multipacking_gadget<FieldT> packer(pb, bits, packed, chunk_size, "packer");
+    packer.generate_r1cs_constraints(true);
+
+    for (size_t i = 0; i < num_bits; ++i)
+    {
+        pb.val(bits[i]) = (std::rand() % 2) ? FieldT::one() : FieldT::zero();
+    }
+
+    std::vector<pb_variable_array<FieldT> > chunks(num_chunks);
+    for (size_t i = 0; i < num_chunks; ++i)
+    {
+        chunks[i] = pb_variable_array<FieldT>(bits.begin() + i * chunk_size,
+                                              bits.begin() + std::min((i+1) * chunk_size, num_bits));
+    }
+
+    long long start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        for (size_t i = 0; i < num_chunks; ++i)
+        {
+            pb.val(packed[i]) = reference_pack(pb, chunks[i]);
+        }
+    }
+    const long long ref_pack_time = get_nsec_time() - start;
+    const std::vector<FieldT> ref_packed = packed.get_vals(pb);
+
+    start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        packer.generate_r1cs_witness_from_bits();
+    }
+    const long long pack_time = get_nsec_time() - start;
+    assert(packed.get_vals(pb) == ref_packed);
+    assert(pb.is_satisfied());
+
+    const std::vector<FieldT> ref_bits = bits.get_vals(pb);
+    start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        for (size_t i = 0; i < num_chunks; ++i)
+        {
+            reference_unpack(pb, chunks[i], pb.val(packed[i]));
+        }
+    }
+    const long long ref_unpack_time = get_nsec_time() - start;
+
+    start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        packer.generate_r1cs_witness_from_packed();
+    }
+    const long long unpack_time = get_nsec_time() - start;
+    assert(bits.get_vals(pb) == ref_bits);
+    assert(pb.is_satisfied());
+
+    printf("num_bits = %zu, reps = %zu: pack %0.3f ms (reference %0.3f ms, speedup %0.2fx), unpack %0.3f ms (reference %0.3f ms, speedup %0.2fx)\n",
+           num_bits, reps,
+           pack_time * 1e-6, ref_pack_time * 1e-6, 1. * ref_pack_time / pack_time,
+           unpack_time * 1e-6, ref_unpack_time * 1e-6, 1. * ref_unpack_time / unpack_time);
+}
+
+int main(int argc, const char * argv[])
+{
+    start_profiling();
+    default_ec_pp::init_public_params();
+
+    for (size_t num_bits = 64; num_bits <= 1ul<<14; num_bits *= 4)
+    {
+        profile_multipacking<Fr<default_ec_pp> >(num_bits, (1ul<<18) / num_bits);
+    }
+}
@@ -30,10 +30,12 @@ private:
 
       routed_packets[column_idx][packet_idx][subpacket_idx]
       pack_inputs/unpack_outputs[packet_idx]
-      asw_switch_bits[column_idx][row_idx]
+      switch_rows[column_idx][switch_idx]
+      asw_switch_bits[column_idx][switch_idx]
 
       Where column_idx ranges is in range 0 .. width and packet_idx is
-      in range 0 .. num_packets-1.
+      in range 0 .. num_packets-1. switch_rows[column_idx] lists the
+      canonical rows of the switches of a column in increasing order.
 
       Note that unlike in Bene\v{s} routing networks row_idx are
       *not* necessarily consecutive; similarly for straight edges
@@ -53,8 +55,12 @@ private:
       connection), and 1 corresponds to switch on (crossed
       connection).
     */
-    std::vector<std::map<size_t, pb_variable<FieldT> > > asw_switch_bits;
+    std::vector<pb_variable_array<FieldT> > asw_switch_bits;
+    std::vector<std::vector<size_t> > switch_rows;
     as_waksman_topology neighbors;
+
+    /* reused by every call to generate_r1cs_witness */
+    as_waksman_routing_buffers routing_buffers;
 public:
     const size_t num_packets;
     const size_t num_columns;
@@ -38,6 +38,19 @@ as_waksman_routing_gadget<FieldT>::as_waksman_routing_gadget(protoboard<FieldT>
     neighbors = generate_as_waksman_topology(num_packets);
     routed_packets.resize(num_columns+1);
 
+    switch_rows.resize(num_columns);
+    for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
+    {
+        for (size_t row_idx = 0; row_idx < num_packets; ++row_idx)
+        {
+            if (neighbors[column_idx][row_idx].first != neighbors[column_idx][row_idx].second)
+            {
+                switch_rows[column_idx].emplace_back(row_idx);
+                ++row_idx; /* next row_idx corresponds to the same switch, so skip it */
+            }
+        }
+    }
+
     /* Two pass allocation. First allocate LHS packets, then for every
        switch either copy over the variables from previously allocated
        to allocate target packets */
@@ -94,13 +107,10 @@ as_waksman_routing_gadget<FieldT>::as_waksman_routing_gadget(protoboard<FieldT>
 
         for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
         {
-            for (size_t row_idx = 0; row_idx < num_packets; ++row_idx)
+            asw_switch_bits[column_idx].resize(switch_rows[column_idx].size());
+            for (size_t switch_idx = 0; switch_idx < switch_rows[column_idx].size(); ++switch_idx)
             {
-                if (neighbors[column_idx][row_idx].first != neighbors[column_idx][row_idx].second)
-                {
-                    asw_switch_bits[column_idx][row_idx].allocate(pb, FMT(annotation_prefix, " asw_switch_bits_%zu_%zu", column_idx, row_idx));
-                    ++row_idx; /* next row_idx corresponds to the same switch, so skip it */
-                }
+                asw_switch_bits[column_idx][switch_idx].allocate(pb, FMT(annotation_prefix, " asw_switch_bits_%zu_%zu", column_idx, switch_rows[column_idx][switch_idx]));
             }
         }
     }
@@ -119,13 +129,9 @@ void as_waksman_routing_gadget<FieldT>::generate_r1cs_constraints()
     /* actual routing constraints */
     for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
     {
-        for (size_t row_idx = 0; row_idx < num_packets; ++row_idx)
+        for (size_t switch_idx = 0; switch_idx < switch_rows[column_idx].size(); ++switch_idx)
         {
-            if (neighbors[column_idx][row_idx].first == neighbors[column_idx][row_idx].second)
-            {
-                /* if there is no switch at this position, then just continue with next row_idx */
-                continue;
-            }
+            const size_t row_idx = switch_rows[column_idx][switch_idx];
 
             if (num_subpackets == 1)
             {
@@ -147,7 +153,7 @@ void as_waksman_routing_gadget<FieldT>::generate_r1cs_constraints()
             else
             {
                 /* require switching bit to be boolean */
-                generate_boolean_r1cs_constraint<FieldT>(this->pb, asw_switch_bits[column_idx][row_idx],
+                generate_boolean_r1cs_constraint<FieldT>(this->pb, asw_switch_bits[column_idx][switch_idx],
                                                          FMT(this->annotation_prefix, " asw_switch_bits_%zu_%zu", column_idx, row_idx));
 
                 /* route forward according to the switch bit */
@@ -164,16 +170,13 @@ void as_waksman_routing_gadget<FieldT>::generate_r1cs_constraints()
 
                         this->pb.add_r1cs_constraint(
                             r1cs_constraint<FieldT>(
-                                asw_switch_bits[column_idx][row_idx],
+                                asw_switch_bits[column_idx][switch_idx],
                                 routed_packets[column_idx+1][cross_edge][subpacket_idx] - routed_packets[column_idx+1][straight_edge][subpacket_idx],
                                 routed_packets[column_idx][switch_input][subpacket_idx] - routed_packets[column_idx+1][straight_edge][subpacket_idx]),
                             FMT(this->annotation_prefix, " route_forward_%zu_%zu_%zu", column_idx, switch_input, subpacket_idx));
                     }
                 }
             }
-
-            /* we processed both switch inputs at once, so skip the next iteration */
-            ++row_idx;
         }
     }
 }
@@ -182,59 +185,61 @@ template<typename FieldT>
 void as_waksman_routing_gadget<FieldT>::generate_r1cs_witness(const integer_permutation& permutation)
 {
     /* pack inputs */
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
     for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
     {
         pack_inputs[packet_idx].generate_r1cs_witness_from_bits();
     }
 
     /* do the routing */
-    as_waksman_routing routing = get_as_waksman_routing(permutation);
-
+    get_as_waksman_routing(permutation, routing_buffers);
+    const FieldT one = FieldT::one();
+    const FieldT zero = FieldT::zero();
+
+    /*
+      Straight edges reuse the variables of the previous column, so only
+      the switch outputs need to be assigned. The switches of a column
+      write disjoint variables, so each column is processed in parallel.
+    */
     for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
     {
-        for (size_t row_idx = 0; row_idx < num_packets; ++row_idx)
+        const std::vector<char> &switch_settings = routing_buffers.switch_settings[column_idx];
+        const std::vector<pb_variable_array<FieldT> > &cur_packets = routed_packets[column_idx];
+        const std::vector<pb_variable_array<FieldT> > &next_packets = routed_packets[column_idx+1];
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t switch_idx = 0; switch_idx < switch_rows[column_idx].size(); ++switch_idx)
         {
-            if (neighbors[column_idx][row_idx].first == neighbors[column_idx][row_idx].second)
-            {
-                /* this is a straight edge, so just pass the values forward */
-                const size_t next = neighbors[column_idx][row_idx].first;
+            const size_t row_idx = switch_rows[column_idx][switch_idx];
+            const bool switch_val = switch_settings[row_idx];
 
-                for (size_t subpacket_idx = 0; subpacket_idx < num_subpackets; ++subpacket_idx)
-                {
-                    this->pb.val(routed_packets[column_idx+1][next][subpacket_idx]) = this->pb.val(routed_packets[column_idx][row_idx][subpacket_idx]);
-                }
-            }
-            else
+            if (num_subpackets > 1)
             {
-                if (num_subpackets > 1)
-                {
-                    /* update the switch bit */
-                    this->pb.val(asw_switch_bits[column_idx][row_idx]) = FieldT(routing[column_idx][row_idx] ? 1 : 0);
-                }
+                this->pb.val(asw_switch_bits[column_idx][switch_idx]) = (switch_val ? one : zero);
+            }
 
-                /* route according to the switch bit */
-                const bool switch_val = routing[column_idx][row_idx];
+            /* route according to the switch bit */
+            for (size_t switch_input : { row_idx, row_idx+1 })
+            {
+                const pb_variable_array<FieldT> &from = cur_packets[switch_input];
+                const pb_variable_array<FieldT> &to = next_packets[switch_val ? neighbors[column_idx][switch_input].second : neighbors[column_idx][switch_input].first];
 
-                for (size_t switch_input : { row_idx, row_idx+1 })
+                for (size_t subpacket_idx = 0; subpacket_idx < num_subpackets; ++subpacket_idx)
                 {
-                    const size_t straight_edge = neighbors[column_idx][switch_input].first;
-                    const size_t cross_edge = neighbors[column_idx][switch_input].second;
-
-                    const size_t switched_edge = (switch_val ? cross_edge : straight_edge);
-
-                    for (size_t subpacket_idx = 0; subpacket_idx < num_subpackets; ++subpacket_idx)
-                    {
-                        this->pb.val(routed_packets[column_idx+1][switched_edge][subpacket_idx]) = this->pb.val(routed_packets[column_idx][switch_input][subpacket_idx]);
-                    }
+                    this->pb.val(to[subpacket_idx]) = this->pb.val(from[subpacket_idx]);
                 }
-
-                /* we processed both switch inputs at once, so skip the next iteration */
-                ++row_idx;
             }
         }
     }
 
     /* unpack outputs */
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
     for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
     {
         unpack_outputs[packet_idx].generate_r1cs_witness_from_packed();
@@ -286,7 +291,7 @@ void test_as_waksman_routing_gadget(const size_t num_packets, const size_t packe
 
     printf("num_constraints = %zu, num_variables = %zu\n",
            pb.num_constraints(),
-           pb.constraint_system.num_variables);
+           pb.num_variables());
 }
 
 } // libsnark
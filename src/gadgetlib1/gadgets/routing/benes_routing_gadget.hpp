@@ -49,6 +49,9 @@ private:
     */
     std::vector<pb_variable_array<FieldT>> benes_switch_bits;
     benes_topology neighbors;
+
+    /* reused by every call to generate_r1cs_witness */
+    benes_routing_buffers routing_buffers;
 public:
     const size_t num_packets;
     const size_t num_columns;
@@ -153,37 +153,48 @@ template<typename FieldT>
 void benes_routing_gadget<FieldT>::generate_r1cs_witness(const integer_permutation& permutation)
 {
     /* pack inputs */
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
     for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
     {
         pack_inputs[packet_idx].generate_r1cs_witness_from_bits();
     }
 
     /* do the routing */
-    const benes_routing routing = get_benes_routing(permutation);
+    get_benes_routing(permutation, routing_buffers);
+    const benes_routing &routing = routing_buffers.routing;
+    const FieldT one = FieldT::one();
+    const FieldT zero = FieldT::zero();
 
+    /* every packet of a column is routed to a distinct output, so a column is processed in parallel */
     for (size_t column_idx = 0; column_idx < num_columns; ++column_idx)
     {
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
         for (size_t packet_idx = 0; packet_idx < num_packets; ++packet_idx)
         {
-            const size_t straight_edge = neighbors[column_idx][packet_idx].first;
-            const size_t cross_edge = neighbors[column_idx][packet_idx].second;
+            const bool switch_val = routing[column_idx][packet_idx];
+            const pb_variable_array<FieldT> &from = routed_packets[column_idx][packet_idx];
+            const pb_variable_array<FieldT> &to = routed_packets[column_idx+1][switch_val ? neighbors[column_idx][packet_idx].second : neighbors[column_idx][packet_idx].first];
 
             if (num_subpackets > 1)
             {
-                this->pb.val(benes_switch_bits[column_idx][packet_idx]) = FieldT(routing[column_idx][packet_idx] ? 1 : 0);
+                this->pb.val(benes_switch_bits[column_idx][packet_idx]) = (switch_val ? one : zero);
             }
 
             for (size_t subpacket_idx = 0; subpacket_idx < num_subpackets; ++subpacket_idx)
             {
-                this->pb.val(routing[column_idx][packet_idx] ?
-                             routed_packets[column_idx+1][cross_edge][subpacket_idx] :
-                             routed_packets[column_idx+1][straight_edge][subpacket_idx]) =
-                    this->pb.val(routed_packets[column_idx][packet_idx][subpacket_idx]);
+                this->pb.val(to[subpacket_idx]) = this->pb.val(from[subpacket_idx]);
             }
         }
     }
 
     /* unpack outputs */
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
     for (size_t packet_idx = 0; packet_idx < lines_to_unpack; ++packet_idx)
     {
         unpack_outputs[packet_idx].generate_r1cs_witness_from_packed();
@@ -239,7 +250,7 @@ void test_benes_routing_gadget(const size_t num_packets, const size_t packet_siz
 
     printf("num_constraints = %zu, num_variables = %zu\n",
            pb.num_constraints(),
-           pb.constraint_system.num_variables);
+           pb.num_variables());
 }
 
 } // libsnark
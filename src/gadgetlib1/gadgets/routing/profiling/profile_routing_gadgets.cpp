@@ -3,6 +3,10 @@
 
  Functions to profile the gadgetlib1 implementations of Benes and AS-Waksman routing networks.
 
+ Besides the network sizes, this measures the time to compute a routing
+ with fresh allocations versus into buffers reused across calls, and the
+ time of the gadgets' witness generation.
+
  *****************************************************************************
  * @author     This file is part of libsnark, developed by SCIPR Lab
  *             and contributors (see AUTHORS).
@@ -10,6 +14,8 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <cstdio>
+#include <functional>
 
 #include "common/default_types/ec_pp.hpp"
 #include "common/profiling.hpp"
@@ -98,10 +104,99 @@ void profile_num_switches(const size_t l)
     }
 }
 
+long long time_reps(const size_t reps, const std::function<void()> &f)
+{
+    const long long start = get_nsec_time();
+    for (size_t r = 0; r < reps; ++r)
+    {
+        f();
+    }
+    return get_nsec_time() - start;
+}
+
+template<typename FieldT>
+void profile_as_waksman_witness(const size_t n, const size_t l, const size_t reps)
+{
+    protoboard<FieldT> pb;
+
+    std::vector<pb_variable_array<FieldT> > randbits(n), outbits(n);
+    for (size_t y = 0; y < n; ++y)
+    {
+        randbits[y].allocate(pb, l, FMT("", "randbits_%zu", y));
+        outbits[y].allocate(pb, l, FMT("", "outbits_%zu", y));
+        for (size_t i = 0; i < l; ++i)
+        {
+            pb.val(randbits[y][i]) = (rand() % 2) ? FieldT::one() : FieldT::zero();
+        }
+    }
+
+    as_waksman_routing_gadget<FieldT> r(pb, n, randbits, outbits, "main_routing_gadget");
+    r.generate_r1cs_constraints();
+
+    integer_permutation permutation(n);
+    permutation.random_shuffle();
+
+    const long long fresh = time_reps(reps, [&]() { as_waksman_routing routing = get_as_waksman_routing(permutation); });
+    as_waksman_routing_buffers buffers;
+    const long long reused = time_reps(reps, [&]() { get_as_waksman_routing(permutation, buffers); });
+    const long long witness = time_reps(reps, [&]() { r.generate_r1cs_witness(permutation); });
+    assert(pb.is_satisfied());
+
+    printf("as_waksman n = %5zu, l = %zu: routing (maps) %8.3f ms, routing (reused buffers) %8.3f ms, speedup %0.2fx, witness %8.3f ms\n",
+           n, l, fresh * 1e-6 / reps, reused * 1e-6 / reps, 1. * fresh / reused, witness * 1e-6 / reps);
+}
+
+template<typename FieldT>
+void profile_benes_witness(const size_t n, const size_t l, const size_t reps)
+{
+    protoboard<FieldT> pb;
+
+    std::vector<pb_variable_array<FieldT> > randbits(n), outbits(n);
+    for (size_t y = 0; y < n; ++y)
+    {
+        randbits[y].allocate(pb, l, FMT("", "randbits_%zu", y));
+        outbits[y].allocate(pb, l, FMT("", "outbits_%zu", y));
+        for (size_t i = 0; i < l; ++i)
+        {
+            pb.val(randbits[y][i]) = (rand() % 2) ? FieldT::one() : FieldT::zero();
+        }
+    }
+
+    benes_routing_gadget<FieldT> r(pb, n, randbits, outbits, n, "main_routing_gadget");
+    r.generate_r1cs_constraints();
+
+    integer_permutation permutation(n);
+    permutation.random_shuffle();
+
+    const long long fresh = time_reps(reps, [&]() { benes_routing routing = get_benes_routing(permutation); });
+    benes_routing_buffers buffers;
+    const long long reused = time_reps(reps, [&]() { get_benes_routing(permutation, buffers); });
+    const long long witness = time_reps(reps, [&]() { r.generate_r1cs_witness(permutation); });
+    assert(pb.is_satisfied());
+
+    printf("benes      n = %5zu, l = %zu: routing (fresh)  %8.3f ms, routing (reused buffers) %8.3f ms, speedup %0.2fx, witness %8.3f ms\n",
+           n, l, fresh * 1e-6 / reps, reused * 1e-6 / reps, 1. * fresh / reused, witness * 1e-6 / reps);
+}
+
+template<typename FieldT>
+void profile_routing_witness(const size_t l)
+{
+    printf("profiling routing computation and witness generation\n");
+    for (size_t n = 16; n <= 4096; n *= 4)
+    {
+        const size_t reps = std::max<size_t>(1, 4096 / n);
+        profile_as_waksman_witness<FieldT>(n-1, l, reps);
+        profile_benes_witness<FieldT>(n, l, reps);
+    }
+}
+
 int main(int argc, const char * argv[])
 {
     start_profiling();
     default_ec_pp::init_public_params();
     profile_routing_gadgets<Fr<default_ec_pp> >(32+16+3+2);
     profile_num_switches<Fr<default_ec_pp> >(1);
+
+    inhibit_profiling_info = true;
+    profile_routing_witness<Fr<default_ec_pp> >(32+16+3+2);
 }
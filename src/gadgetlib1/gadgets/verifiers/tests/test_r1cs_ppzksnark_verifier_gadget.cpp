@@ -21,7 +21,7 @@ template<typename FieldT>
 void dump_constraints(const protoboard<FieldT> &pb)
 {
 #ifdef DEBUG
-    for (auto s : pb.constraint_system.constraint_annotations)
+    for (auto s : pb.get_constraint_system().constraint_annotations)
     {
         printf("constraint: %s\n", s.second.c_str());
     }
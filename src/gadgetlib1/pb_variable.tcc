@@ -7,6 +7,7 @@
 
 #ifndef PB_VARIABLE_TCC_
 #define PB_VARIABLE_TCC_
+#include <algorithm>
 #include <cassert>
 #include "gadgetlib1/protoboard.hpp"
 #include "common/utils.hpp"
@@ -48,9 +49,11 @@ template<typename FieldT>
 void pb_variable_array<FieldT>::fill_with_bits(protoboard<FieldT> &pb, const bit_vector& bits) const
 {
     assert(this->size() == bits.size());
+    const FieldT one = FieldT::one(); /* FieldT::one() performs a Montgomery reduction, so only do it once */
+    const FieldT zero = FieldT::zero();
     for (size_t i = 0; i < bits.size(); ++i)
     {
-        pb.val((*this)[i]) = (bits[i] ? FieldT::one() : FieldT::zero());
+        pb.val((*this)[i]) = (bits[i] ? one : zero);
     }
 }
 
@@ -58,9 +61,24 @@ template<typename FieldT>
 void pb_variable_array<FieldT>::fill_with_bits_of_field_element(protoboard<FieldT> &pb, const FieldT &r) const
 {
     const bigint<FieldT::num_limbs> rint = r.as_bigint();
-    for (size_t i = 0; i < this->size(); ++i)
+    const FieldT one = FieldT::one();
+    const FieldT zero = FieldT::zero();
+
+    /* extract bits a limb at a time; positions past the last limb are zero */
+    const size_t num_words = std::min<size_t>(div_ceil(this->size(), GMP_NUMB_BITS), FieldT::num_limbs);
+    for (size_t w = 0; w < num_words; ++w)
     {
-        pb.val((*this)[i]) = rint.test_bit(i) ? FieldT::one() : FieldT::zero();
+        mp_limb_t word = rint.data[w];
+        const size_t end = std::min<size_t>((w+1) * GMP_NUMB_BITS, this->size());
+        for (size_t i = w * GMP_NUMB_BITS; i < end; ++i, word >>= 1)
+        {
+            pb.val((*this)[i]) = (word & 1) ? one : zero;
+        }
+    }
+
+    for (size_t i = num_words * GMP_NUMB_BITS; i < this->size(); ++i)
+    {
+        pb.val((*this)[i]) = zero;
     }
 }
 
@@ -97,17 +115,33 @@ bit_vector pb_variable_array<FieldT>::get_bits(const protoboard<FieldT> &pb) con
 template<typename FieldT>
 FieldT pb_variable_array<FieldT>::get_field_element_from_bits(const protoboard<FieldT> &pb) const
 {
-    FieldT result = FieldT::zero();
+    if (this->size() > FieldT::num_limbs * GMP_NUMB_BITS)
+    {
+        /* too wide to fit in a bigint, so fall back to the (reducing) double-and-add loop */
+        FieldT result = FieldT::zero();
 
+        for (size_t i = 0; i < this->size(); ++i)
+        {
+            /* push in the new bit */
+            const FieldT v = pb.val((*this)[this->size()-1-i]);
+            assert(v == FieldT::zero() || v == FieldT::one());
+            result += result + v;
+        }
+
+        return result;
+    }
+
+    /* assemble the bits word by word and convert to Montgomery form only once */
+    const FieldT one = FieldT::one();
+    bigint<FieldT::num_limbs> b;
     for (size_t i = 0; i < this->size(); ++i)
     {
-        /* push in the new bit */
-        const FieldT v = pb.val((*this)[this->size()-1-i]);
-        assert(v == FieldT::zero() || v == FieldT::one());
-        result += result + v;
+        const FieldT v = pb.val((*this)[i]);
+        assert(v.is_zero() || v == one);
+        b.data[i / GMP_NUMB_BITS] |= ((mp_limb_t)(v == one)) << (i % GMP_NUMB_BITS);
     }
 
-    return result;
+    return FieldT(b);
 }
 
 template<typename FieldT>
@@ -214,9 +248,11 @@ template<typename FieldT>
 void pb_linear_combination_array<FieldT>::fill_with_bits(protoboard<FieldT> &pb, const bit_vector& bits) const
 {
     assert(this->size() == bits.size());
+    const FieldT one = FieldT::one(); /* FieldT::one() performs a Montgomery reduction, so only do it once */
+    const FieldT zero = FieldT::zero();
     for (size_t i = 0; i < bits.size(); ++i)
     {
-        pb.lc_val((*this)[i]) = (bits[i] ? FieldT::one() : FieldT::zero());
+        pb.lc_val((*this)[i]) = (bits[i] ? one : zero);
     }
 }
 
@@ -224,9 +260,24 @@ template<typename FieldT>
 void pb_linear_combination_array<FieldT>::fill_with_bits_of_field_element(protoboard<FieldT> &pb, const FieldT &r) const
 {
     const bigint<FieldT::num_limbs> rint = r.as_bigint();
-    for (size_t i = 0; i < this->size(); ++i)
+    const FieldT one = FieldT::one();
+    const FieldT zero = FieldT::zero();
+
+    /* extract bits a limb at a time; positions past the last limb are zero */
+    const size_t num_words = std::min<size_t>(div_ceil(this->size(), GMP_NUMB_BITS), FieldT::num_limbs);
+    for (size_t w = 0; w < num_words; ++w)
     {
-        pb.lc_val((*this)[i]) = rint.test_bit(i) ? FieldT::one() : FieldT::zero();
+        mp_limb_t word = rint.data[w];
+        const size_t end = std::min<size_t>((w+1) * GMP_NUMB_BITS, this->size());
+        for (size_t i = w * GMP_NUMB_BITS; i < end; ++i, word >>= 1)
+        {
+            pb.lc_val((*this)[i]) = (word & 1) ? one : zero;
+        }
+    }
+
+    for (size_t i = num_words * GMP_NUMB_BITS; i < this->size(); ++i)
+    {
+        pb.lc_val((*this)[i]) = zero;
     }
 }
 
@@ -263,17 +314,33 @@ bit_vector pb_linear_combination_array<FieldT>::get_bits(const protoboard<FieldT
 template<typename FieldT>
 FieldT pb_linear_combination_array<FieldT>::get_field_element_from_bits(const protoboard<FieldT> &pb) const
 {
-    FieldT result = FieldT::zero();
+    if (this->size() > FieldT::num_limbs * GMP_NUMB_BITS)
+    {
+        /* too wide to fit in a bigint, so fall back to the (reducing) double-and-add loop */
+        FieldT result = FieldT::zero();
 
+        for (size_t i = 0; i < this->size(); ++i)
+        {
+            /* push in the new bit */
+            const FieldT v = pb.lc_val((*this)[this->size()-1-i]);
+            assert(v == FieldT::zero() || v == FieldT::one());
+            result += result + v;
+        }
+
+        return result;
+    }
+
+    /* assemble the bits word by word and convert to Montgomery form only once */
+    const FieldT one = FieldT::one();
+    bigint<FieldT::num_limbs> b;
     for (size_t i = 0; i < this->size(); ++i)
     {
-        /* push in the new bit */
-        const FieldT v = pb.lc_val((*this)[this->size()-1-i]);
-        assert(v == FieldT::zero() || v == FieldT::one());
-        result += result + v;
+        const FieldT v = pb.lc_val((*this)[i]);
+        assert(v.is_zero() || v == one);
+        b.data[i / GMP_NUMB_BITS] |= ((mp_limb_t)(v == one)) << (i % GMP_NUMB_BITS);
     }
 
-    return result;
+    return FieldT(b);
 }
 
 template<typename FieldT>
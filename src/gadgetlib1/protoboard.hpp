@@ -11,10 +11,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <functional>
 #include <string>
 #include <vector>
 #include "gadgetlib1/pb_variable.hpp"
 #include "relations/constraint_satisfaction_problems/r1cs/r1cs.hpp"
+#include "relations/constraint_satisfaction_problems/r1cs/r1cs_constraint_arena.hpp"
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -25,6 +27,39 @@ class r1cs_constraint;
 template<typename FieldT>
 class r1cs_constraint_system;
 
+/**
+ * An independent piece of witness generation. The task may only write the
+ * variables with indices in [first_var, last_var) and the linear
+ * combinations with indices in [first_lc, last_lc), and may only read values
+ * assigned before the task is executed. Tasks with disjoint ranges can thus
+ * run in any order, or concurrently, and give the same assignment.
+ *
+ * The ranges of a gadget's own variables and linear combinations are
+ * obtained by reading protoboard::next_var_index() and
+ * protoboard::next_lc_index() before and after constructing it.
+ */
+class pb_witness_task {
+public:
+    var_index_t first_var;
+    var_index_t last_var;
+    lc_index_t first_lc;
+    lc_index_t last_lc;
+    std::function<void()> generate_r1cs_witness;
+
+    /* a task that writes no linear combinations */
+    pb_witness_task(const var_index_t first_var,
+                    const var_index_t last_var,
+                    const std::function<void()> &generate_r1cs_witness) :
+        first_var(first_var), last_var(last_var), first_lc(0), last_lc(0), generate_r1cs_witness(generate_r1cs_witness) {};
+
+    pb_witness_task(const var_index_t first_var,
+                    const var_index_t last_var,
+                    const lc_index_t first_lc,
+                    const lc_index_t last_lc,
+                    const std::function<void()> &generate_r1cs_witness) :
+        first_var(first_var), last_var(last_var), first_lc(first_lc), last_lc(last_lc), generate_r1cs_witness(generate_r1cs_witness) {};
+};
+
 template<typename FieldT>
 class protoboard {
 private:
@@ -33,7 +68,8 @@ private:
     var_index_t next_free_var;
     lc_index_t next_free_lc;
     std::vector<FieldT> lc_values;
-    r1cs_constraint_system<FieldT> constraint_system;
+    r1cs_constraint_system<FieldT> constraint_system; /* holds sizes and annotations; the constraints themselves are kept in the arena below */
+    r1cs_constraint_arena<FieldT> constraints;
 
 public:
     protoboard();
@@ -52,6 +88,8 @@ public:
     size_t num_constraints() const;
     size_t num_inputs() const;
     size_t num_variables() const;
+    var_index_t next_var_index() const;
+    lc_index_t next_lc_index() const;
 
     void set_input_sizes(const size_t primary_input_size);
 
@@ -59,6 +97,12 @@ public:
     r1cs_primary_input<FieldT> primary_input() const;
     r1cs_auxiliary_input<FieldT> auxiliary_input() const;
     r1cs_constraint_system<FieldT> get_constraint_system() const;
+    /* like get_constraint_system(), but frees the arena, so that the constraints are not kept twice; the protoboard then has no constraints, and only its assignment may be used */
+    r1cs_constraint_system<FieldT> release_constraint_system();
+    const r1cs_constraint_arena<FieldT>& get_constraint_arena() const;
+
+    /* runs the tasks in parallel if compiled with MULTICORE; the ranges of the tasks must be disjoint */
+    void execute_witness_tasks(const std::vector<pb_witness_task> &tasks);
 
     friend class pb_variable<FieldT>;
     friend class pb_linear_combination<FieldT>;
@@ -93,9 +93,9 @@ void protoboard<FieldT>::add_r1cs_constraint(const r1cs_constraint<FieldT> &cons
 {
 #ifdef DEBUG
     assert(annotation != "");
-    constraint_system.constraint_annotations[constraint_system.constraints.size()] = annotation;
+    constraint_system.constraint_annotations[constraints.size()] = annotation;
 #endif
-    constraint_system.constraints.emplace_back(constr);
+    constraints.add_constraint(constr);
 }
 
 template<typename FieldT>
@@ -110,7 +110,29 @@ void protoboard<FieldT>::augment_variable_annotation(const pb_variable<FieldT> &
 template<typename FieldT>
 bool protoboard<FieldT>::is_satisfied() const
 {
-    return constraint_system.is_satisfied(primary_input(), auxiliary_input());
+    assert(values.size() == constraint_system.num_variables());
+
+    FieldT ares, bres, cres;
+    for (size_t c = 0; c < constraints.size(); ++c)
+    {
+        constraints.evaluate(c, values, ares, bres, cres);
+
+        if (!(ares*bres == cres))
+        {
+#ifdef DEBUG
+            auto it = constraint_system.constraint_annotations.find(c);
+            printf("constraint %zu (%s) unsatisfied\n", c, (it == constraint_system.constraint_annotations.end() ? "no annotation" : it->second.c_str()));
+            printf("<a,(1,x)> = "); ares.print();
+            printf("<b,(1,x)> = "); bres.print();
+            printf("<c,(1,x)> = "); cres.print();
+            printf("constraint was:\n");
+            dump_r1cs_constraint(constraints.get_constraint(c), values, constraint_system.variable_annotations);
+#endif // DEBUG
+            return false;
+        }
+    }
+
+    return true;
 }
 
 template<typename FieldT>
@@ -128,7 +150,7 @@ void protoboard<FieldT>::dump_variables() const
 template<typename FieldT>
 size_t protoboard<FieldT>::num_constraints() const
 {
-    return constraint_system.num_constraints();
+    return constraints.size();
 }
 
 template<typename FieldT>
@@ -143,6 +165,18 @@ size_t protoboard<FieldT>::num_variables() const
     return next_free_var - 1;
 }
 
+template<typename FieldT>
+var_index_t protoboard<FieldT>::next_var_index() const
+{
+    return next_free_var;
+}
+
+template<typename FieldT>
+lc_index_t protoboard<FieldT>::next_lc_index() const
+{
+    return next_free_lc;
+}
+
 template<typename FieldT>
 void protoboard<FieldT>::set_input_sizes(const size_t primary_input_size)
 {
@@ -172,7 +206,103 @@ r1cs_auxiliary_input<FieldT> protoboard<FieldT>::auxiliary_input() const
 template<typename FieldT>
 r1cs_constraint_system<FieldT> protoboard<FieldT>::get_constraint_system() const
 {
-    return constraint_system;
+    r1cs_constraint_system<FieldT> result = constraint_system;
+    result.constraints = constraints.get_constraints();
+    return result;
+}
+
+template<typename FieldT>
+r1cs_constraint_system<FieldT> protoboard<FieldT>::release_constraint_system()
+{
+    r1cs_constraint_system<FieldT> result;
+    result.primary_input_size = constraint_system.primary_input_size;
+    result.auxiliary_input_size = constraint_system.auxiliary_input_size;
+#ifdef DEBUG
+    result.constraint_annotations = std::move(constraint_system.constraint_annotations);
+    result.variable_annotations = constraint_system.variable_annotations;
+    constraint_system.constraint_annotations.clear();
+#endif
+    result.constraints = constraints.get_constraints();
+    constraints = r1cs_constraint_arena<FieldT>();
+    return result;
+}
+
+template<typename FieldT>
+const r1cs_constraint_arena<FieldT>& protoboard<FieldT>::get_constraint_arena() const
+{
+    return constraints;
+}
+
+#ifdef DEBUG
+/* assert that the non-empty [first, last) ranges are disjoint, and return them sorted */
+inline std::vector<std::pair<size_t, size_t> > sorted_disjoint_ranges(std::vector<std::pair<size_t, size_t> > ranges)
+{
+    ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                                [](const std::pair<size_t, size_t> &r) { return r.first == r.second; }),
+                 ranges.end());
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 1; i < ranges.size(); ++i)
+    {
+        assert(ranges[i-1].second <= ranges[i].first);
+    }
+    return ranges;
+}
+
+/* assert that after[i] == before[i] for every i + offset outside of the sorted ranges */
+template<typename FieldT>
+void assert_unchanged_outside_ranges(const std::vector<FieldT> &before,
+                                     const std::vector<FieldT> &after,
+                                     const size_t offset,
+                                     const std::vector<std::pair<size_t, size_t> > &ranges)
+{
+    size_t next_range = 0;
+    for (size_t idx = offset; idx < before.size() + offset; ++idx)
+    {
+        while (next_range < ranges.size() && ranges[next_range].second <= idx)
+        {
+            ++next_range;
+        }
+        if (next_range < ranges.size() && ranges[next_range].first <= idx)
+        {
+            continue;
+        }
+        assert(after[idx-offset] == before[idx-offset]);
+    }
+}
+#endif
+
+template<typename FieldT>
+void protoboard<FieldT>::execute_witness_tasks(const std::vector<pb_witness_task> &tasks)
+{
+#ifdef DEBUG
+    std::vector<std::pair<size_t, size_t> > var_ranges, lc_ranges;
+    for (const pb_witness_task &t : tasks)
+    {
+        assert(0 < t.first_var && t.first_var <= t.last_var && t.last_var <= next_free_var);
+        assert(t.first_lc <= t.last_lc && t.last_lc <= next_free_lc);
+        var_ranges.emplace_back(std::make_pair(t.first_var, t.last_var));
+        lc_ranges.emplace_back(std::make_pair(t.first_lc, t.last_lc));
+    }
+    var_ranges = sorted_disjoint_ranges(var_ranges);
+    lc_ranges = sorted_disjoint_ranges(lc_ranges);
+
+    const r1cs_variable_assignment<FieldT> values_before = values;
+    const std::vector<FieldT> lc_values_before = lc_values;
+#endif
+
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        tasks[i].generate_r1cs_witness();
+    }
+
+#ifdef DEBUG
+    /* no task may write outside of its declared ranges, or the result would depend on the schedule */
+    assert_unchanged_outside_ranges(values_before, values, 1, var_ranges); /* values[0] is variable 1 */
+    assert_unchanged_outside_ranges(lc_values_before, lc_values, 0, lc_ranges);
+#endif
 }
 
 } // libsnark
@@ -0,0 +1,140 @@
+/**
+ *****************************************************************************
+ Test program that checks that protoboard::execute_witness_tasks gives the
+ same variable and linear combination values as running the same tasks one
+ after the other. The tasks come in two groups: the tasks of the first group
+ write variables and a linear combination each, and the tasks of the second
+ group read what the first group wrote.
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#include <cassert>
+#include <cstdio>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "gadgetlib1/protoboard.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+class witness_task_example {
+public:
+    protoboard<FieldT> pb;
+    pb_variable<FieldT> x;
+    std::vector<pb_variable_array<FieldT> > a, b;
+    std::vector<pb_linear_combination<FieldT> > a_sums, b_sums;
+    std::vector<pb_witness_task> first_group, second_group;
+
+    witness_task_example(const size_t num_tasks, const size_t task_size)
+    {
+        x.allocate(pb, "x");
+        a.resize(num_tasks);
+        b.resize(num_tasks);
+        a_sums.resize(num_tasks);
+        b_sums.resize(num_tasks);
+
+        /* a[i][j] = x * (i * task_size + j + 1), and a_sums[i] = sum_j a[i][j] */
+        for (size_t i = 0; i < num_tasks; ++i)
+        {
+            const var_index_t first_var = pb.next_var_index();
+            const lc_index_t first_lc = pb.next_lc_index();
+            a[i].allocate(pb, task_size, FMT("", "a_%zu", i));
+            a_sums[i].assign(pb, pb_sum<FieldT>(pb_linear_combination_array<FieldT>(a[i])));
+            for (size_t j = 0; j < task_size; ++j)
+            {
+                pb.add_r1cs_constraint(r1cs_constraint<FieldT>(x, FieldT(i * task_size + j + 1), a[i][j]), FMT("", "a_%zu_%zu", i, j));
+            }
+
+            first_group.emplace_back(pb_witness_task(first_var, pb.next_var_index(), first_lc, pb.next_lc_index(), [this, i, task_size]() {
+                        for (size_t j = 0; j < task_size; ++j)
+                        {
+                            pb.val(a[i][j]) = pb.val(x) * FieldT(i * task_size + j + 1);
+                        }
+                        a_sums[i].evaluate(pb);
+                    }));
+        }
+
+        /* b[i][j] = a_sums[num_tasks - 1 - i] * a[i][j], and b_sums[i] = sum_j b[i][j] */
+        for (size_t i = 0; i < num_tasks; ++i)
+        {
+            const var_index_t first_var = pb.next_var_index();
+            const lc_index_t first_lc = pb.next_lc_index();
+            b[i].allocate(pb, task_size, FMT("", "b_%zu", i));
+            b_sums[i].assign(pb, pb_sum<FieldT>(pb_linear_combination_array<FieldT>(b[i])));
+            for (size_t j = 0; j < task_size; ++j)
+            {
+                pb.add_r1cs_constraint(r1cs_constraint<FieldT>(a_sums[num_tasks - 1 - i], a[i][j], b[i][j]), FMT("", "b_%zu_%zu", i, j));
+            }
+
+            second_group.emplace_back(pb_witness_task(first_var, pb.next_var_index(), first_lc, pb.next_lc_index(), [this, i, num_tasks, task_size]() {
+                        for (size_t j = 0; j < task_size; ++j)
+                        {
+                            pb.val(b[i][j]) = pb.lc_val(a_sums[num_tasks - 1 - i]) * pb.val(a[i][j]);
+                        }
+                        b_sums[i].evaluate(pb);
+                    }));
+        }
+    }
+
+    /* the lambdas capture this, so the example is neither copied nor moved */
+    witness_task_example(const witness_task_example&) = delete;
+    witness_task_example& operator=(const witness_task_example&) = delete;
+};
+
+template<typename FieldT>
+void test_witness_tasks(const size_t num_tasks, const size_t task_size)
+{
+    witness_task_example<FieldT> serial(num_tasks, task_size), tasks(num_tasks, task_size);
+
+    const FieldT x_value = FieldT::random_element();
+    serial.pb.val(serial.x) = x_value;
+    for (const pb_witness_task &t : serial.first_group)
+    {
+        t.generate_r1cs_witness();
+    }
+    for (const pb_witness_task &t : serial.second_group)
+    {
+        t.generate_r1cs_witness();
+    }
+    assert(serial.pb.is_satisfied());
+
+#ifdef MULTICORE
+    /* the assignment must not depend on the number of threads */
+    const int max_threads = omp_get_max_threads();
+    for (const int num_threads : { 1, max_threads })
+    {
+        omp_set_num_threads(num_threads);
+#endif
+        tasks.pb.val(tasks.x) = x_value;
+        tasks.pb.execute_witness_tasks(tasks.first_group);
+        tasks.pb.execute_witness_tasks(tasks.second_group);
+
+        assert(tasks.pb.is_satisfied());
+        assert(tasks.pb.full_variable_assignment() == serial.pb.full_variable_assignment());
+        for (size_t i = 0; i < num_tasks; ++i)
+        {
+            assert(tasks.pb.lc_val(tasks.a_sums[i]) == serial.pb.lc_val(serial.a_sums[i]));
+            assert(tasks.pb.lc_val(tasks.b_sums[i]) == serial.pb.lc_val(serial.b_sums[i]));
+        }
+#ifdef MULTICORE
+    }
+    omp_set_num_threads(max_threads);
+#endif
+}
+
+int main()
+{
+    start_profiling();
+    default_ec_pp::init_public_params();
+
+    test_witness_tasks<Fr<default_ec_pp> >(1, 5);
+    test_witness_tasks<Fr<default_ec_pp> >(16, 7);
+
+    printf("All witness task tests passed\n");
+}
@@ -137,17 +137,17 @@ void R1P_AND_Gadget::generateConstraints() {
 }
 
 void R1P_AND_Gadget::generateWitness() {
-    FElem sum = 0;
+    Fp sum = Fp::zero();
     for(size_t i = 0; i < input_.size(); ++i) {
-        sum += val(input_[i]);
+        sum += r1pVal(input_[i]);
     }
-    sum -= input_.size(); // sum(input[i]) - n ==> sum
-    if (sum == 0) { // AND(input[0], input[1], ...) == 1
-        val(sumInverse_) = 0;
-        val(result_) = 1;
+    sum -= Fp(long(input_.size())); // sum(input[i]) - n ==> sum
+    if (sum.is_zero()) { // AND(input[0], input[1], ...) == 1
+        r1pVal(sumInverse_) = Fp::zero();
+        r1pVal(result_) = Fp::one();
     } else {                   // AND(input[0], input[1], ...) == 0
-        val(sumInverse_) = sum.inverse(R1P);
-        val(result_) = 0;
+        r1pVal(sumInverse_) = sum.inverse();
+        r1pVal(result_) = Fp::zero();
     }
 }
 
@@ -244,16 +244,16 @@ void R1P_OR_Gadget::generateConstraints() {
 }
 
 void R1P_OR_Gadget::generateWitness() {
-    FElem sum = 0;
+    Fp sum = Fp::zero();
     for(size_t i = 0; i < input_.size(); ++i) { // sum(input[i]) ==> sum
-        sum += val(input_[i]);
+        sum += r1pVal(input_[i]);
     }
-    if (sum == 0) { // OR(input[0], input[1], ...) == 0
-        val(sumInverse_) = 0;
-        val(result_) = 0;
+    if (sum.is_zero()) { // OR(input[0], input[1], ...) == 0
+        r1pVal(sumInverse_) = Fp::zero();
+        r1pVal(result_) = Fp::zero();
     } else {                   // OR(input[0], input[1], ...) == 1
-        val(sumInverse_) = sum.inverse(R1P);
-        val(result_) = 1;
+        r1pVal(sumInverse_) = sum.inverse();
+        r1pVal(result_) = Fp::one();
     }
 }
 
@@ -332,16 +332,18 @@ void R1P_InnerProduct_Gadget::generateConstraints() {
 
 void R1P_InnerProduct_Gadget::generateWitness() {
     const int n = A_.size();
+    Fp partialSum = r1pVal(A_[0]) * r1pVal(B_[0]);
     if (n == 1) {
-        val(result_) = val(A_[0]) * val(B_[0]);
+        r1pVal(result_) = partialSum;
         return;
     }
     // else (n > 1)
-    val(partialSums_[0]) = val(A_[0]) * val(B_[0]);
+    r1pVal(partialSums_[0]) = partialSum;
     for(int i = 1; i <= n-2; ++i) {
-        val(partialSums_[i]) = val(partialSums_[i-1]) + val(A_[i]) * val(B_[i]);
+        partialSum += r1pVal(A_[i]) * r1pVal(B_[i]);
+        r1pVal(partialSums_[i]) = partialSum;
     }
-    val(result_) = val(partialSums_[n-2]) + val(A_[n-1]) * val(B_[n-1]);
+    r1pVal(result_) = partialSum + r1pVal(A_[n-1]) * r1pVal(B_[n-1]);
 }
 
 /***********************************/
@@ -412,17 +414,19 @@ void R1P_LooseMUX_Gadget::generateConstraints() {
 
 void R1P_LooseMUX_Gadget::generateWitness() {
     const size_t n = inputs_.size();
-    /* assumes that idx can be fit in ulong; true for our purposes for now */
-    const size_t index = val(index_).asLong();
-    const FElem arraySize = n;
+    /* compare the whole index with n, not only its lowest limb, so that large indices are out of bounds */
+    const auto indexBits = r1pVal(index_).as_bigint();
+    const bool inBounds = indexBits.num_bits() <= 8 * sizeof(unsigned long) && indexBits.as_ulong() < n;
+    const size_t index = inBounds ? indexBits.as_ulong() : n;
+    const Fp zero = Fp::zero();
     for(size_t i = 0; i < n; ++i) {
-        val(indicators_[i]) = 0; // Redundant, but just in case.
+        r1pVal(indicators_[i]) = zero; // Redundant, but just in case.
     }
-    if (index >= n) { //  || index < 0
-        val(successFlag_) = 0;
+    if (!inBounds) { //  || index < 0
+        r1pVal(successFlag_) = zero;
     } else { // index in bounds
-        val(indicators_[index]) = 1;
-        val(successFlag_) = 1;
+        r1pVal(indicators_[index]) = Fp::one();
+        r1pVal(successFlag_) = Fp::one();
     }
     for(auto& curGadget : computeResult_) {
         curGadget->generateWitness();
@@ -525,23 +529,26 @@ void R1P_CompressionPacking_Gadget::generateConstraints() {
 
 void R1P_CompressionPacking_Gadget::generateWitness() {
     const int n = unpacked_.size();
+    const Fp zero = Fp::zero();
+    const Fp one = Fp::one();
     if (packingMode_ == PackingMode::PACK) {
-        FElem packedVal = 0;
-        FElem two_i(R1P_Elem(1)); // will hold 2^i
-        for(int i = 0; i < n; ++i) {
-            GADGETLIB_ASSERT(val(unpacked_[i]).asLong() == 0 || val(unpacked_[i]).asLong() == 1,
+        Fp packedVal = zero;
+        for(int i = n-1; i >= 0; --i) { // Horner's rule, most significant bit first
+            const Fp& bit = r1pVal(unpacked_[i]);
+            GADGETLIB_ASSERT(bit == zero || bit == one,
                          GADGETLIB2_FMT("unpacked[%u]  = %u. Expected a Boolean value.", i,
-                             val(unpacked_[i]).asLong()));
-            packedVal += two_i * val(unpacked_[i]).asLong();
-            two_i += two_i;
+                             bit.as_ulong()));
+            packedVal += packedVal;
+            packedVal += bit;
         }
-        val(packed_[0]) = packedVal;
+        r1pVal(packed_[0]) = packedVal;
         return;
     }
     // else (UNPACK)
     GADGETLIB_ASSERT(packingMode_ == PackingMode::UNPACK, "Packing gadget created with unknown packing mode.");
+    const auto packedBits = r1pVal(packed_[0]).as_bigint(); // convert out of Montgomery form once
     for(int i = 0; i < n; ++i) {
-        val(unpacked_[i]) = val(packed_[0]).getBit(i, R1P);
+        r1pVal(unpacked_[i]) = packedBits.test_bit(i) ? one : zero;
     }
 }
 
@@ -638,8 +645,9 @@ void R1P_EqualsConst_Gadget::generateConstraints() {
 }
 
 void R1P_EqualsConst_Gadget::generateWitness() {
-    val(aux_) = val(input_) == n_ ? 0 : (val(input_) - n_).inverse(R1P) ;
-    val(result_) = val(input_) == n_ ? 1 : 0 ;
+    const Fp diff = r1pVal(input_) - n_.asFp();
+    r1pVal(aux_) = diff.is_zero() ? Fp::zero() : diff.inverse();
+    r1pVal(result_) = diff.is_zero() ? Fp::one() : Fp::zero();
 }
 
 /***********************************/
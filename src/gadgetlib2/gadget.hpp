@@ -136,6 +136,10 @@ public:
                                     const LinearCombination& b,
                                     const LinearCombination& c,
                                     const ::std::string& name);
+    /// Non-virtual witness access for R1P gadgets: the value of var as a plain Fp, so that
+    /// witness arithmetic does not go through FElemInterface.
+    Fp& r1pVal(const Variable& var) {return val(var).asFp();}
+    Fp r1pVal(const LinearCombination& lc) {return val(lc).asFp();}
 private:
     virtual void init() = 0; // private in order to force programmer to invoke from a Gadget* only
     DISALLOW_COPY_AND_ASSIGN(R1P_Gadget);
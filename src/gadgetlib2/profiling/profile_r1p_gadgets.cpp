@@ -0,0 +1,166 @@
+/** @file
+ *****************************************************************************
+ Profiling of witness generation for the basic R1P gadgets of gadgetlib2.
+
+ The circuits follow the tutorial examples (AND/OR, inner product, LooseMUX and
+ packing). Each gadget is timed against the same witness computation written
+ with generic FElem arithmetic, i.e. through the virtual FElemInterface.
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cstdio>
+#include <functional>
+
+#include "common/profiling.hpp"
+#include "gadgetlib2/gadget.hpp"
+
+using namespace gadgetlib2;
+
+long long time_reps(const size_t reps, const ::std::function<void()> &f) {
+    const long long start = libsnark::get_nsec_time();
+    for (size_t r = 0; r < reps; ++r) {
+        f();
+    }
+    return libsnark::get_nsec_time() - start;
+}
+
+void report(const char* name, const size_t n, const long long fast, const long long generic) {
+    printf("%-20s n = %5zu: r1p %8.3f ms, generic FElem %8.3f ms, speedup %0.2fx\n",
+           name, n, fast * 1e-6, generic * 1e-6, 1. * generic / fast);
+}
+
+void profile_and_or(const size_t n, const size_t reps) {
+    ProtoboardPtr pb = Protoboard::create(R1P);
+    VariableArray input(n, "input");
+    Variable andResult("andResult"), orResult("orResult");
+    GadgetPtr andGadget = AND_Gadget::create(pb, input, andResult);
+    GadgetPtr orGadget = OR_Gadget::create(pb, input, orResult);
+    andGadget->generateConstraints();
+    orGadget->generateConstraints();
+    for (size_t i = 0; i < n; ++i) {
+        pb->val(input[i]) = (i % 3 != 0) ? 1 : 0;
+    }
+
+    const long long fast = time_reps(reps, [&]() {
+        andGadget->generateWitness();
+        orGadget->generateWitness();
+    });
+    Variable andInverse("andInverse"), orInverse("orInverse");
+    const long long generic = time_reps(reps, [&]() {
+        FElem andSum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            andSum += pb->val(input[i]);
+        }
+        andSum -= n;
+        pb->val(andInverse) = andSum == 0 ? FElem(0) : andSum.inverse(R1P);
+        pb->val(andResult) = andSum == 0 ? 1 : 0;
+        FElem orSum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            orSum += pb->val(input[i]);
+        }
+        pb->val(orInverse) = orSum == 0 ? FElem(0) : orSum.inverse(R1P);
+        pb->val(orResult) = orSum == 0 ? 0 : 1;
+    });
+    andGadget->generateWitness();
+    orGadget->generateWitness();
+    GADGETLIB_ASSERT(pb->isSatisfied(), "AND/OR witness is not satisfying");
+    report("AND+OR", n, fast, generic);
+}
+
+void profile_inner_product(const size_t n, const size_t reps) {
+    ProtoboardPtr pb = Protoboard::create(R1P);
+    VariableArray A(n, "A"), B(n, "B");
+    Variable result("result");
+    GadgetPtr g = InnerProduct_Gadget::create(pb, A, B, result);
+    g->generateConstraints();
+    for (size_t i = 0; i < n; ++i) {
+        pb->val(A[i]) = i + 1;
+        pb->val(B[i]) = 2 * i + 1;
+    }
+
+    const long long fast = time_reps(reps, [&]() { g->generateWitness(); });
+    VariableArray partialSums(n, "partialSums");
+    const long long generic = time_reps(reps, [&]() {
+        pb->val(partialSums[0]) = pb->val(A[0]) * pb->val(B[0]);
+        for (size_t i = 1; i < n; ++i) {
+            pb->val(partialSums[i]) = pb->val(partialSums[i-1]) + pb->val(A[i]) * pb->val(B[i]);
+        }
+    });
+    GADGETLIB_ASSERT(pb->isSatisfied(), "InnerProduct witness is not satisfying");
+    report("InnerProduct", n, fast, generic);
+}
+
+void profile_loose_mux(const size_t n, const size_t reps) {
+    ProtoboardPtr pb = Protoboard::create(R1P);
+    VariableArray inputs(n, "inputs");
+    Variable index("index"), output("output"), successFlag("successFlag");
+    GadgetPtr g = LooseMUX_Gadget::create(pb, inputs, index, output, successFlag);
+    g->generateConstraints();
+    for (size_t i = 0; i < n; ++i) {
+        pb->val(inputs[i]) = 1000 + i;
+    }
+    pb->val(index) = n / 2;
+
+    const long long fast = time_reps(reps, [&]() { g->generateWitness(); });
+    VariableArray indicators(n, "indicators"), partialSums(n, "partialSums");
+    const long long generic = time_reps(reps, [&]() {
+        const size_t idx = pb->val(index).asLong();
+        for (size_t i = 0; i < n; ++i) {
+            pb->val(indicators[i]) = (i == idx) ? 1 : 0;
+        }
+        pb->val(partialSums[0]) = pb->val(indicators[0]) * pb->val(inputs[0]);
+        for (size_t i = 1; i < n; ++i) {
+            pb->val(partialSums[i]) = pb->val(partialSums[i-1]) + pb->val(indicators[i]) * pb->val(inputs[i]);
+        }
+    });
+    GADGETLIB_ASSERT(pb->isSatisfied(), "LooseMUX witness is not satisfying");
+    report("LooseMUX", n, fast, generic);
+}
+
+void profile_packing(const size_t n, const size_t reps) {
+    ProtoboardPtr pb = Protoboard::create(R1P);
+    VariableArray unpacked(n, "unpacked");
+    VariableArray packed(1, "packed");
+    GadgetPtr packer = CompressionPacking_Gadget::create(pb, unpacked, packed, PackingMode::PACK);
+    GadgetPtr unpacker = CompressionPacking_Gadget::create(pb, unpacked, packed, PackingMode::UNPACK);
+    unpacker->generateConstraints();
+    for (size_t i = 0; i < n; ++i) {
+        pb->val(unpacked[i]) = (i % 5 == 1) ? 1 : 0;
+    }
+
+    const long long fast = time_reps(reps, [&]() {
+        packer->generateWitness();
+        unpacker->generateWitness();
+    });
+    const long long generic = time_reps(reps, [&]() {
+        FElem packedVal = 0;
+        FElem two_i(Fp(1));
+        for (size_t i = 0; i < n; ++i) {
+            packedVal += two_i * pb->val(unpacked[i]).asLong();
+            two_i += two_i;
+        }
+        pb->val(packed[0]) = packedVal;
+        for (size_t i = 0; i < n; ++i) {
+            pb->val(unpacked[i]) = packedVal.getBit(i, R1P);
+        }
+    });
+    GADGETLIB_ASSERT(pb->isSatisfied(), "CompressionPacking witness is not satisfying");
+    report("CompressionPacking", n, fast, generic);
+}
+
+int main(int argc, const char * argv[])
+{
+    libsnark::start_profiling();
+    initPublicParamsFromDefaultPp();
+
+    for (size_t n = 16; n <= 4096; n *= 4) {
+        const size_t reps = 65536 / n;
+        profile_and_or(n, reps);
+        profile_inner_product(n, reps);
+        profile_loose_mux(n, reps);
+    }
+    profile_packing(Fp::capacity(), 256);
+}
@@ -212,6 +212,25 @@ const size_t n = EXHAUSTIVE_N;
     }
 }
 
+TEST(gadgetLib2,R1P_LooseMUX_Gadget_LargeIndex) {
+    initPublicParamsFromDefaultPp();
+    auto pb = Protoboard::create(R1P);
+    VariableArray arr(4, "arr");
+    Variable index("index");
+    Variable result("result");
+    Variable success_flag("success_flag");
+    auto g = LooseMUX_Gadget::create(pb, arr, index, result, success_flag);
+    g->generateConstraints();
+    for (size_t i = 0; i < 4; ++i) {
+        pb->val(arr[i]) = i + 1;
+    }
+    // 2^64 + 1 agrees with the in-bounds index 1 on its lowest limb
+    pb->val(index) = FElem(Fp("18446744073709551617"));
+    g->generateWitness();
+    EXPECT_EQ(pb->val(success_flag) , 0);
+    EXPECT_TRUE(pb->isSatisfied(PrintOptions::DBG_PRINT_IF_NOT_SATISFIED));
+}
+
 // Forward declaration
 void packing_Gadget_R1P_ExhaustiveTest(ProtoboardPtr unpackingPB, ProtoboardPtr packingPB,
                                        const int n, VariableArray packed, VariableArray unpacked,
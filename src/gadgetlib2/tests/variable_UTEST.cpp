@@ -366,6 +366,22 @@ TEST(gadgetLib2, FElem_R1P_Elem_inverse) {
     EXPECT_EQ(e42.inverse(R1P),Fp(42).inverse());
 }
 
+TEST(gadgetLib2, FElem_R1P_Elem_asFp) {
+    initPublicParamsFromDefaultPp();
+    const FElem c = -3;
+    EXPECT_EQ(c.asFp(), Fp(-3));
+    EXPECT_EQ(c.fieldType(), AGNOSTIC);
+    FElem e = 7;
+    e.asFp() *= Fp(6);
+    EXPECT_EQ(e.fieldType(), R1P);
+    EXPECT_EQ(e, 42);
+    FElem e1 = Fp(1);
+    e1 = e;
+    e.asFp() += Fp(1);
+    EXPECT_EQ(e1, 42);
+    EXPECT_EQ(e, 43);
+}
+
 TEST(gadgetLib2, LinearTermConstructors) {
     initPublicParamsFromDefaultPp();
     //LinearTerm(const Variable& v) : variable_(v), coeff_(1) {}
@@ -50,7 +50,10 @@ FElem::FElem(const FElem& src) : elem_(src.elem_->clone()) {}
 
 
 FElem& FElem::operator=(const FElem& other) {
-    if (fieldType() == other.fieldType() || fieldType() == AGNOSTIC) {
+    if (fieldType() == R1P && other.fieldType() == R1P) {
+        // assign in place instead of cloning a new heap element
+        static_cast<R1P_Elem*>(elem_.get())->elem_ = static_cast<const R1P_Elem*>(other.elem_.get())->elem_;
+    } else if (fieldType() == other.fieldType() || fieldType() == AGNOSTIC) {
         elem_ = other.elem_->clone();
     } else if (other.fieldType() != AGNOSTIC) {
         GADGETLIB_FATAL("Attempted to assign field element of incorrect type");
@@ -119,6 +122,18 @@ int FElem::getBit(unsigned int i, const FieldType& fieldType) {
     }
 }
 
+Fp& FElem::asFp() {
+    promoteToFieldType(R1P);
+    return static_cast<R1P_Elem*>(elem_.get())->elem_;
+}
+
+Fp FElem::asFp() const {
+    if (fieldType() == R1P) {
+        return static_cast<const R1P_Elem*>(elem_.get())->elem_;
+    }
+    return Fp(elem_->asLong());
+}
+
 FElem power(const FElem& base, long exponent) { // TODO .cpp
     FElem retval(base);
     retval.elem_->power(exponent);
@@ -176,9 +191,9 @@ FElemInterface& FConst::power(long exponent) {
 
 R1P_Elem& R1P_Elem::operator+=(const FElemInterface& other) {
     if (other.fieldType() == R1P) {
-        elem_ += dynamic_cast<const R1P_Elem&>(other).elem_;
+        elem_ += static_cast<const R1P_Elem&>(other).elem_;
     } else if (other.fieldType() == AGNOSTIC) {
-        elem_ += dynamic_cast<const FConst&>(other).asLong();
+        elem_ += static_cast<const FConst&>(other).asLong();
     } else {
         GADGETLIB_FATAL("Attempted to add incompatible type to R1P_Elem.");
     }
@@ -187,9 +202,9 @@ R1P_Elem& R1P_Elem::operator+=(const FElemInterface& other) {
 
 R1P_Elem& R1P_Elem::operator-=(const FElemInterface& other) {
     if (other.fieldType() == R1P) {
-        elem_ -= dynamic_cast<const R1P_Elem&>(other).elem_;
+        elem_ -= static_cast<const R1P_Elem&>(other).elem_;
     } else if (other.fieldType() == AGNOSTIC) {
-        elem_ -= dynamic_cast<const FConst&>(other).asLong();
+        elem_ -= static_cast<const FConst&>(other).asLong();
     } else {
         GADGETLIB_FATAL("Attempted to add incompatible type to R1P_Elem.");
     }
@@ -198,9 +213,9 @@ R1P_Elem& R1P_Elem::operator-=(const FElemInterface& other) {
 
 R1P_Elem& R1P_Elem::operator*=(const FElemInterface& other) {
     if (other.fieldType() == R1P) {
-        elem_ *= dynamic_cast<const R1P_Elem&>(other).elem_;
+        elem_ *= static_cast<const R1P_Elem&>(other).elem_;
     } else if (other.fieldType() == AGNOSTIC) {
-        elem_ *= dynamic_cast<const FConst&>(other).asLong();
+        elem_ *= static_cast<const FConst&>(other).asLong();
     } else {
         GADGETLIB_FATAL("Attempted to add incompatible type to R1P_Elem.");
     }
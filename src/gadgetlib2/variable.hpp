@@ -134,6 +134,11 @@ public:
     FElem inverse(const FieldType& fieldType);
     long asLong() const {return elem_->asLong();}
     int getBit(unsigned int i, const FieldType& fieldType);
+    /// R1P fast path: direct access to the underlying Fp (an FConst is promoted to R1P first).
+    /// Arithmetic on the returned reference bypasses the virtual FElemInterface dispatch and the
+    /// heap allocations of the generic operators, so R1P gadgets use it for witness generation.
+    Fp& asFp();
+    Fp asFp() const;
     friend FElem power(const FElem& base, long exponent);
 
     inline friend ::std::ostream& operator<<(::std::ostream& os, const FElem& elem) {
@@ -14,9 +14,11 @@
 #ifndef R1CS_TO_QAP_TCC_
 #define R1CS_TO_QAP_TCC_
 
+#include "common/huge_page_allocator.hpp"
 #include "common/profiling.hpp"
 #include "common/utils.hpp"
 #include "algebra/evaluation_domain/evaluation_domain.hpp"
+#include "algebra/fields/field_utils.hpp"
 
 #define R1CS_TO_QAP_ADDITIONAL_CONSTRAINTS 1 // +1 is for an additional constraint needed for the soundness of input consistency
 
@@ -111,12 +113,11 @@ qap_instance_evaluation<FieldT> r1cs_to_qap_instance_map_with_evaluation(const r
 
     const std::shared_ptr<evaluation_domain<FieldT> > domain = get_evaluation_domain<FieldT>(cs.num_constraints() + R1CS_TO_QAP_ADDITIONAL_CONSTRAINTS);
 
-    std::vector<FieldT> At, Bt, Ct, Ht;
+    std::vector<FieldT> At, Bt, Ct;
 
     At.resize(cs.num_variables()+1, FieldT::zero());
     Bt.resize(cs.num_variables()+1, FieldT::zero());
     Ct.resize(cs.num_variables()+1, FieldT::zero());
-    Ht.reserve(domain->m+1);
 
     const FieldT Zt = domain->compute_Z(t);
 
@@ -153,12 +154,7 @@ qap_instance_evaluation<FieldT> r1cs_to_qap_instance_map_with_evaluation(const r
         }
     }
 
-    FieldT ti = FieldT::one();
-    for (size_t i = 0; i < domain->m+1; ++i)
-    {
-        Ht.emplace_back(ti);
-        ti *= t;
-    }
+    std::vector<FieldT> Ht = get_powers(t, domain->m+1);
     leave_block("Compute evaluations of A, B, C, H at t");
 
     leave_block("Call to r1cs_to_qap_instance_map_with_evaluation");
@@ -223,7 +219,8 @@ qap_witness<FieldT> r1cs_to_qap_witness_map(const r1cs_constraint_system<FieldT>
     full_variable_assignment.insert(full_variable_assignment.end(), auxiliary_input.begin(), auxiliary_input.end());
 
     enter_block("Compute evaluation of polynomials A, B on set S");
-    std::vector<FieldT> aA(domain->m, FieldT::zero()), aB(domain->m, FieldT::zero());
+    /* the FFTs below access aA, aB and aC at random offsets, so they may be backed by huge pages */
+    std::vector<FieldT> aA = make_vector_on_huge_pages(domain->m, FieldT::zero()), aB = make_vector_on_huge_pages(domain->m, FieldT::zero());
 
     /* account for the additional constraint (1 + \sum_{i=1}^{num_inputs} (i+1) * input_i) * 0 = 0 */
     aA[0] = FieldT::one();
@@ -281,7 +278,7 @@ qap_witness<FieldT> r1cs_to_qap_witness_map(const r1cs_constraint_system<FieldT>
     std::vector<FieldT>().swap(aB); // destroy aB
 
     enter_block("Compute evaluation of polynomial C on set S");
-    std::vector<FieldT> aC(domain->m, FieldT::zero());
+    std::vector<FieldT> aC = make_vector_on_huge_pages(domain->m, FieldT::zero());
     for (size_t i = 0; i < cs.num_constraints(); ++i)
     {
         aC[i+1] += cs.constraints[i].c.evaluate(full_variable_assignment);
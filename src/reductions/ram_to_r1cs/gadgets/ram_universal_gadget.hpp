@@ -97,9 +97,13 @@ public:
 
     std::vector<memory_line_variable_gadget<ramT>* > unrouted_memory_lines;
     std::vector<memory_line_variable_gadget<ramT> > routed_memory_lines;
+    std::vector<std::pair<var_index_t, var_index_t> > routed_memory_line_vars; /* [first, last) variable range allocated by each routed line */
+    std::vector<std::pair<lc_index_t, lc_index_t> > routed_memory_line_lcs; /* [first, last) linear combination range allocated by each routed line */
 
     std::vector<ram_cpu_checker<ramT> > execution_checkers;
     std::vector<memory_checker_gadget<ramT> > memory_checkers;
+    std::vector<std::pair<var_index_t, var_index_t> > memory_checker_vars; /* [first, last) variable range allocated by each memory checker */
+    std::vector<std::pair<lc_index_t, lc_index_t> > memory_checker_lcs; /* [first, last) linear combination range allocated by each memory checker */
 
     std::vector<pb_variable_array<FieldT> > routing_inputs;
     std::vector<pb_variable_array<FieldT> > routing_outputs;
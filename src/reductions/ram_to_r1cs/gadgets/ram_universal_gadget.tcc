@@ -89,9 +89,15 @@ ram_universal_gadget<ramT>::ram_universal_gadget(ram_protoboard<ramT> &pb,
 
     /* deal with routing */
     enter_block("Allocate routed memory lines");
+    routed_memory_line_vars.reserve(num_memory_lines);
+    routed_memory_line_lcs.reserve(num_memory_lines);
     for (size_t i = 0; i < num_memory_lines; ++i)
     {
+        const var_index_t first_var = pb.next_var_index();
+        const lc_index_t first_lc = pb.next_lc_index();
         routed_memory_lines.emplace_back(memory_line_variable_gadget<ramT>(pb, timestamp_size, pb.ap, FMT(annotation_prefix, " routed_memory_lines_%zu", i)));
+        routed_memory_line_vars.emplace_back(std::make_pair(first_var, pb.next_var_index()));
+        routed_memory_line_lcs.emplace_back(std::make_pair(first_lc, pb.next_lc_index()));
     }
     leave_block("Allocate routed memory lines");
 
@@ -131,13 +137,19 @@ ram_universal_gadget<ramT>::ram_universal_gadget(ram_protoboard<ramT> &pb,
 
     enter_block("Allocate all memory checkers");
     memory_checkers.reserve(num_memory_lines);
+    memory_checker_vars.reserve(num_memory_lines);
+    memory_checker_lcs.reserve(num_memory_lines);
     for (size_t i = 0; i < num_memory_lines; ++i)
     {
+        const var_index_t first_var = pb.next_var_index();
+        const lc_index_t first_lc = pb.next_lc_index();
         memory_checkers.emplace_back(memory_checker_gadget<ramT>(pb,
                                                                  timestamp_size,
                                                                  *unrouted_memory_lines[i],
                                                                  routed_memory_lines[i],
                                                                  FMT(this->annotation_prefix, " memory_checkers_%zu", i)));
+        memory_checker_vars.emplace_back(std::make_pair(first_var, pb.next_var_index()));
+        memory_checker_lcs.emplace_back(std::make_pair(first_lc, pb.next_lc_index()));
     }
     leave_block("Allocate all memory checkers");
 
@@ -336,16 +348,27 @@ void ram_universal_gadget<ramT>::generate_r1cs_witness(const ram_boot_trace<ramT
     /* route according to the memory permutation */
     routing_network->generate_r1cs_witness(pi);
 
+    /* the routed lines, and then the memory checkers, only write their own variables and linear combinations, so each group is filled in as independent tasks */
+    std::vector<pb_witness_task> repack_routed_lines;
+    repack_routed_lines.reserve(this->num_memory_lines);
     for (size_t i = 0; i < this->num_memory_lines; ++i)
     {
-        routed_memory_lines[i].generate_r1cs_witness_from_bits();
+        repack_routed_lines.emplace_back(pb_witness_task(routed_memory_line_vars[i].first, routed_memory_line_vars[i].second,
+                                                         routed_memory_line_lcs[i].first, routed_memory_line_lcs[i].second,
+                                                         [this, i]() { routed_memory_lines[i].generate_r1cs_witness_from_bits(); }));
     }
+    this->pb.execute_witness_tasks(repack_routed_lines);
 
     /* generate witness for memory checkers */
+    std::vector<pb_witness_task> check_memory;
+    check_memory.reserve(this->num_memory_lines);
     for (size_t i = 0; i < this->num_memory_lines; ++i)
     {
-        memory_checkers[i].generate_r1cs_witness();
+        check_memory.emplace_back(pb_witness_task(memory_checker_vars[i].first, memory_checker_vars[i].second,
+                                                  memory_checker_lcs[i].first, memory_checker_lcs[i].second,
+                                                  [this, i]() { memory_checkers[i].generate_r1cs_witness(); }));
     }
+    this->pb.execute_witness_tasks(check_memory);
 
     /* repack back the input */
     for (size_t i = 0; i < boot_trace_size_bound; ++i)
@@ -37,6 +37,7 @@ public:
                 const size_t time_bound);
     void instance_map();
     r1cs_constraint_system<FieldT> get_constraint_system() const;
+    r1cs_constraint_system<FieldT> release_constraint_system(); /* see protoboard::release_constraint_system */
     r1cs_auxiliary_input<FieldT> auxiliary_input_map(const ram_boot_trace<ramT> &boot_trace,
                                                      const ram_input_tape<ramT> &auxiliary_input);
 
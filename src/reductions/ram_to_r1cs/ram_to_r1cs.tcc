@@ -50,6 +50,12 @@ r1cs_constraint_system<ram_base_field<ramT> > ram_to_r1cs<ramT>::get_constraint_
     return main_protoboard.get_constraint_system();
 }
 
+template<typename ramT>
+r1cs_constraint_system<ram_base_field<ramT> > ram_to_r1cs<ramT>::release_constraint_system()
+{
+    return main_protoboard.release_constraint_system();
+}
+
 template<typename ramT>
 r1cs_primary_input<ram_base_field<ramT> > ram_to_r1cs<ramT>::auxiliary_input_map(const ram_boot_trace<ramT> &boot_trace,
                                                                                  const ram_input_tape<ramT> &auxiliary_input)
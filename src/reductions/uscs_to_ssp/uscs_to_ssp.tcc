@@ -14,9 +14,11 @@
 #ifndef USCS_TO_SSP_TCC_
 #define USCS_TO_SSP_TCC_
 
+#include "common/huge_page_allocator.hpp"
 #include "common/profiling.hpp"
 #include "common/utils.hpp"
 #include "algebra/evaluation_domain/evaluation_domain.hpp"
+#include "algebra/fields/field_utils.hpp"
 
 namespace libsnark {
 
@@ -82,7 +84,6 @@ ssp_instance_evaluation<FieldT> uscs_to_ssp_instance_map_with_evaluation(const u
     const std::shared_ptr<evaluation_domain<FieldT> > domain = get_evaluation_domain<FieldT>(cs.num_constraints());
 
     std::vector<FieldT> Vt(cs.num_variables()+1, FieldT::zero());
-    std::vector<FieldT> Ht(domain->m+1);
 
     const FieldT Zt = domain->compute_Z(t);
 
@@ -99,12 +100,7 @@ ssp_instance_evaluation<FieldT> uscs_to_ssp_instance_map_with_evaluation(const u
     {
         Vt[0] += u[i]; /* dummy constraint: 1^2 = 1 */
     }
-    FieldT ti = FieldT::one();
-    for (size_t i = 0; i < domain->m+1; ++i)
-    {
-        Ht[i] = ti;
-        ti *= t;
-    }
+    std::vector<FieldT> Ht = get_powers(t, domain->m+1);
     leave_block("Compute evaluations of V and H at t");
 
     leave_block("Call to uscs_to_ssp_instance_map_with_evaluation");
@@ -164,7 +160,8 @@ ssp_witness<FieldT> uscs_to_ssp_witness_map(const uscs_constraint_system<FieldT>
     const std::shared_ptr<evaluation_domain<FieldT> > domain = get_evaluation_domain<FieldT>(cs.num_constraints());
 
     enter_block("Compute evaluation of polynomial V on set S");
-    std::vector<FieldT> aA(domain->m, FieldT::zero());
+    /* the FFTs below access aA at random offsets, so it may be backed by huge pages */
+    std::vector<FieldT> aA = make_vector_on_huge_pages(domain->m, FieldT::zero());
     assert(domain->m >= cs.num_constraints());
     for (size_t i = 0; i < cs.num_constraints(); ++i)
     {
@@ -17,6 +17,7 @@ See qap.hpp .
 #include "common/profiling.hpp"
 #include "common/utils.hpp"
 #include "algebra/evaluation_domain/evaluation_domain.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/multiexp.hpp"
 
 namespace libsnark {
@@ -83,7 +84,6 @@ bool qap_instance<FieldT>::is_satisfied(const qap_witness<FieldT> &witness) cons
     std::vector<FieldT> At(this->num_variables()+1, FieldT::zero());
     std::vector<FieldT> Bt(this->num_variables()+1, FieldT::zero());
     std::vector<FieldT> Ct(this->num_variables()+1, FieldT::zero());
-    std::vector<FieldT> Ht(this->degree()+1);
 
     const FieldT Zt = this->domain->compute_Z(t);
 
@@ -107,12 +107,7 @@ bool qap_instance<FieldT>::is_satisfied(const qap_witness<FieldT> &witness) cons
         }
     }
 
-    FieldT ti = FieldT::one();
-    for (size_t i = 0; i < this->degree()+1; ++i)
-    {
-        Ht[i] = ti;
-        ti *= t;
-    }
+    std::vector<FieldT> Ht = get_powers(t, this->degree()+1);
 
     const qap_instance_evaluation<FieldT> eval_qap_inst(this->domain,
                                                         this->num_variables(),
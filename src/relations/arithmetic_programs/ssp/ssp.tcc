@@ -17,6 +17,7 @@
 #include "common/profiling.hpp"
 #include "common/utils.hpp"
 #include "algebra/evaluation_domain/evaluation_domain.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/multiexp.hpp"
 
 namespace libsnark {
@@ -72,7 +73,6 @@ bool ssp_instance<FieldT>::is_satisfied(const ssp_witness<FieldT> &witness) cons
 {
     const FieldT t = FieldT::random_element();;
     std::vector<FieldT> Vt(this->num_variables()+1, FieldT::zero());
-    std::vector<FieldT> Ht(this->degree()+1);
 
     const FieldT Zt = this->domain->compute_Z(t);
 
@@ -86,12 +86,7 @@ bool ssp_instance<FieldT>::is_satisfied(const ssp_witness<FieldT> &witness) cons
         }
     }
 
-    FieldT ti = FieldT::one();
-    for (size_t i = 0; i < this->degree()+1; ++i)
-    {
-        Ht[i] = ti;
-        ti *= t;
-    }
+    std::vector<FieldT> Ht = get_powers(t, this->degree()+1);
 
     const ssp_instance_evaluation<FieldT> eval_ssp_inst(this->domain,
                                                         this->num_variables(),
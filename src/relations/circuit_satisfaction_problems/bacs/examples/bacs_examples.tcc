@@ -17,6 +17,7 @@
 
 #include <cassert>
 
+#include "algebra/fields/field_utils.hpp"
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -43,20 +44,14 @@ bacs_example<FieldT> generate_bacs_example(const size_t primary_input_size,
                                            const size_t num_outputs)
 {
     bacs_example<FieldT> example;
-    for (size_t i = 0; i < primary_input_size; ++i)
-    {
-        example.primary_input.emplace_back(FieldT::random_element());
-    }
-
-    for (size_t i = 0; i < auxiliary_input_size; ++i)
-    {
-        example.auxiliary_input.emplace_back(FieldT::random_element());
-    }
+    example.primary_input = random_field_elements<FieldT>(primary_input_size);
+    example.auxiliary_input = random_field_elements<FieldT>(auxiliary_input_size);
 
     example.circuit.primary_input_size = primary_input_size;
     example.circuit.auxiliary_input_size = auxiliary_input_size;
 
     bacs_variable_assignment<FieldT> all_vals;
+    all_vals.reserve(primary_input_size + auxiliary_input_size + num_gates);
     all_vals.insert(all_vals.end(), example.primary_input.begin(), example.primary_input.end());
     all_vals.insert(all_vals.end(), example.auxiliary_input.begin(), example.auxiliary_input.end());
 
@@ -66,6 +66,31 @@ template<typename FieldT>
 r1cs_example<FieldT> generate_r1cs_example_with_binary_input(const size_t num_constraints,
                                                              const size_t num_inputs);
 
+/**
+ * Generate a R1CS example such that:
+ * - the number of constraints of the R1CS constraint system is num_constraints;
+ * - the number of variables of the R1CS constraint system is num_inputs + num_constraints;
+ * - the number of inputs of the R1CS constraint system is num_inputs;
+ * - the R1CS input consists of ``full'' field elements;
+ * - each constraint has the form < A , X > * x_v = x_w, where x_w is a new variable, and
+ *   A has num_terms terms (with small nonzero coefficients) on random earlier variables.
+ *
+ * The constraints come in layers of layer_width constraints, which only read variables
+ * defined before their layer; each layer is generated (constraints and witness together)
+ * in parallel, so that very large instances can be produced quickly. Only the structure
+ * (the constraints) is seeded: it is determined by the state of std::rand, and not by the
+ * number of threads. The input values are drawn by random_field_elements, and differ on
+ * every call.
+ *
+ * The constraints are returned expanded, as every consumer of an r1cs_example expects;
+ * they are not streamed into an r1cs_constraint_arena.
+ */
+template<typename FieldT>
+r1cs_example<FieldT> generate_r1cs_example_with_density(const size_t num_constraints,
+                                                        const size_t num_inputs,
+                                                        const size_t num_terms,
+                                                        const size_t layer_width = 4096);
+
 } // libsnark
 
 #include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.tcc"
@@ -15,8 +15,11 @@
 #ifndef R1CS_EXAMPLES_TCC_
 #define R1CS_EXAMPLES_TCC_
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 
+#include "algebra/fields/field_utils.hpp"
 #include "common/utils.hpp"
 
 namespace libsnark {
@@ -33,51 +36,58 @@ r1cs_example<FieldT> generate_r1cs_example_with_field_input(const size_t num_con
     cs.primary_input_size = num_inputs;
     cs.auxiliary_input_size = 2 + num_constraints - num_inputs; // TODO: explain this
 
-    r1cs_variable_assignment<FieldT> full_variable_assignment;
-    FieldT a = FieldT::random_element();
-    FieldT b = FieldT::random_element();
-    full_variable_assignment.push_back(a);
-    full_variable_assignment.push_back(b);
-
+    /* the constraints only depend on their index, so they are built in place and in parallel */
+    const FieldT one = FieldT::one();
+    cs.constraints.resize(num_constraints);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
     for (size_t i = 0; i < num_constraints-1; ++i)
     {
-        linear_combination<FieldT> A, B, C;
+        r1cs_constraint<FieldT> &constr = cs.constraints[i];
 
         if (i % 2)
         {
             // a * b = c
-            A.add_term(i+1, 1);
-            B.add_term(i+2, 1);
-            C.add_term(i+3, 1);
-            FieldT tmp = a*b;
-            full_variable_assignment.push_back(tmp);
-            a = b; b = tmp;
+            constr.a.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+1), one));
+            constr.b.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+2), one));
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+3), one));
         }
         else
         {
             // a + b = c
-            B.add_term(0, 1);
-            A.add_term(i+1, 1);
-            A.add_term(i+2, 1);
-            C.add_term(i+3, 1);
-            FieldT tmp = a+b;
-            full_variable_assignment.push_back(tmp);
-            a = b; b = tmp;
+            constr.b.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(0), one));
+            constr.a.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+1), one));
+            constr.a.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+2), one));
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i+3), one));
         }
+    }
+
+    r1cs_variable_assignment<FieldT> full_variable_assignment;
+    full_variable_assignment.reserve(num_constraints + 2);
+    FieldT a = FieldT::random_element();
+    FieldT b = FieldT::random_element();
+    full_variable_assignment.push_back(a);
+    full_variable_assignment.push_back(b);
 
-        cs.add_constraint(r1cs_constraint<FieldT>(A, B, C));
+    for (size_t i = 0; i < num_constraints-1; ++i)
+    {
+        FieldT tmp = (i % 2 ? a*b : a+b);
+        full_variable_assignment.push_back(tmp);
+        a = b; b = tmp;
     }
 
-    linear_combination<FieldT> A, B, C;
+    r1cs_constraint<FieldT> &fin_constr = cs.constraints[num_constraints-1];
+    fin_constr.a.terms.reserve(cs.num_variables()-1);
+    fin_constr.b.terms.reserve(cs.num_variables()-1);
     FieldT fin = FieldT::zero();
     for (size_t i = 1; i < cs.num_variables(); ++i)
     {
-        A.add_term(i, 1);
-        B.add_term(i, 1);
-        fin = fin + full_variable_assignment[i-1];
+        fin_constr.a.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i), one));
+        fin_constr.b.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(i), one));
+        fin += full_variable_assignment[i-1];
     }
-    C.add_term(cs.num_variables(), 1);
-    cs.add_constraint(r1cs_constraint<FieldT>(A, B, C));
+    fin_constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(cs.num_variables()), one));
     full_variable_assignment.push_back(fin.squared());
 
     /* split variable assignment */
@@ -108,12 +118,18 @@ r1cs_example<FieldT> generate_r1cs_example_with_binary_input(const size_t num_co
     cs.primary_input_size = num_inputs;
     cs.auxiliary_input_size = num_constraints; /* we will add one auxiliary variable per constraint */
 
+    const FieldT one = FieldT::one();
+    const FieldT two = one + one;
+    const FieldT minus_one = -one;
+
     r1cs_variable_assignment<FieldT> full_variable_assignment;
+    full_variable_assignment.reserve(num_inputs + num_constraints);
     for (size_t i = 0; i < num_inputs; ++i)
     {
-        full_variable_assignment.push_back(FieldT(std::rand() % 2));
+        full_variable_assignment.push_back(std::rand() % 2 ? one : FieldT::zero());
     }
 
+    cs.constraints.resize(num_constraints);
     size_t lastvar = num_inputs-1;
     for (size_t i = 0; i < num_constraints; ++i)
     {
@@ -125,22 +141,22 @@ r1cs_example<FieldT> generate_r1cs_example_with_binary_input(const size_t num_co
            res = u + v - 2 * u * v
            2 * u * v = u + v - res
         */
-        linear_combination<FieldT> A, B, C;
-        A.add_term(u+1, 2);
-        B.add_term(v+1, 1);
+        r1cs_constraint<FieldT> &constr = cs.constraints[i];
+        constr.a.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(u+1), two));
+        constr.b.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(v+1), one));
         if (u == v)
         {
-            C.add_term(u+1, 2);
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(u+1), two));
         }
         else
         {
-            C.add_term(u+1, 1);
-            C.add_term(v+1, 1);
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(u+1), one));
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(v+1), one));
         }
-        C.add_term(lastvar+1, -FieldT::one());
+        constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(lastvar+1), minus_one));
 
-        cs.add_constraint(r1cs_constraint<FieldT>(A, B, C));
-        full_variable_assignment.push_back(full_variable_assignment[u] + full_variable_assignment[v] - full_variable_assignment[u] * full_variable_assignment[v] - full_variable_assignment[u] * full_variable_assignment[v]);
+        const FieldT uv = full_variable_assignment[u] * full_variable_assignment[v];
+        full_variable_assignment.push_back(full_variable_assignment[u] + full_variable_assignment[v] - uv - uv);
     }
 
     /* split variable assignment */
@@ -159,6 +175,111 @@ r1cs_example<FieldT> generate_r1cs_example_with_binary_input(const size_t num_co
     return r1cs_example<FieldT>(std::move(cs), std::move(primary_input), std::move(auxiliary_input));
 }
 
+/* SplitMix64 finalizer, used as a counter-based generator: its outputs for distinct (seed, counter) pairs can be drawn independently and in any order */
+inline uint64_t r1cs_example_random_word(const uint64_t seed, const uint64_t counter)
+{
+    uint64_t z = seed + (counter + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+template<typename FieldT>
+r1cs_example<FieldT> generate_r1cs_example_with_density(const size_t num_constraints,
+                                                        const size_t num_inputs,
+                                                        const size_t num_terms,
+                                                        const size_t layer_width)
+{
+    enter_block("Call to generate_r1cs_example_with_density");
+
+    assert(num_terms >= 1);
+    assert(layer_width >= 1);
+
+    r1cs_constraint_system<FieldT> cs;
+    cs.primary_input_size = num_inputs;
+    cs.auxiliary_input_size = num_constraints; /* one auxiliary variable per constraint */
+
+    r1cs_variable_assignment<FieldT> full_variable_assignment = random_field_elements<FieldT>(num_inputs);
+    full_variable_assignment.resize(num_inputs + num_constraints);
+
+    const FieldT one = FieldT::one();
+    /* two statements, so that the order of the draws is specified */
+    const uint64_t seed_high = std::rand();
+    const uint64_t seed_low = std::rand();
+    const uint64_t seed = (seed_high << 32) ^ seed_low;
+    const size_t words_per_constraint = num_terms + 1;
+
+    cs.constraints.resize(num_constraints);
+    for (size_t layer_begin = 0; layer_begin < num_constraints; layer_begin += layer_width)
+    {
+        /* constraints of a layer only read variables defined before the layer, so they are independent */
+        const size_t layer_end = std::min(layer_begin + layer_width, num_constraints);
+        const size_t num_visible = 1 + num_inputs + layer_begin; /* including the constant 1 */
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+        for (size_t i = layer_begin; i < layer_end; ++i)
+        {
+            r1cs_constraint<FieldT> &constr = cs.constraints[i];
+            const uint64_t counter = i * words_per_constraint;
+
+            std::vector<linear_term<FieldT> > &terms = constr.a.terms;
+            terms.reserve(num_terms);
+            for (size_t j = 0; j < num_terms; ++j)
+            {
+                const uint64_t r = r1cs_example_random_word(seed, counter + j);
+                const size_t idx = (r >> 32) % num_visible;
+                terms.emplace_back(linear_term<FieldT>(variable<FieldT>(idx), FieldT((long)(r & 0x7fffffff) + 1)));
+            }
+
+            /* keep the terms sorted by index, merging repeated variables */
+            std::sort(terms.begin(), terms.end(),
+                      [](const linear_term<FieldT> &x, const linear_term<FieldT> &y) { return x.index < y.index; });
+            size_t num_distinct = 0;
+            for (size_t j = 0; j < terms.size(); ++j)
+            {
+                if (num_distinct > 0 && terms[num_distinct-1].index == terms[j].index)
+                {
+                    terms[num_distinct-1].coeff += terms[j].coeff;
+                }
+                else
+                {
+                    terms[num_distinct++] = terms[j];
+                }
+            }
+            terms.resize(num_distinct);
+
+            FieldT a_val = FieldT::zero();
+            for (const linear_term<FieldT> &lt : terms)
+            {
+                a_val += lt.coeff * (lt.index == 0 ? one : full_variable_assignment[lt.index-1]);
+            }
+
+            const size_t b_idx = (r1cs_example_random_word(seed, counter + num_terms) >> 32) % num_visible;
+            constr.b.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(b_idx), one));
+            constr.c.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(num_inputs + i + 1), one));
+
+            full_variable_assignment[num_inputs + i] = a_val * (b_idx == 0 ? one : full_variable_assignment[b_idx-1]);
+        }
+    }
+
+    /* split variable assignment */
+    r1cs_primary_input<FieldT> primary_input(full_variable_assignment.begin(), full_variable_assignment.begin() + num_inputs);
+    r1cs_primary_input<FieldT> auxiliary_input(full_variable_assignment.begin() + num_inputs, full_variable_assignment.end());
+
+    /* sanity checks */
+    assert(cs.num_variables() == full_variable_assignment.size());
+    assert(cs.num_inputs() == num_inputs);
+    assert(cs.num_constraints() == num_constraints);
+    assert(cs.is_valid());
+    assert(cs.is_satisfied(primary_input, auxiliary_input));
+
+    leave_block("Call to generate_r1cs_example_with_density");
+
+    return r1cs_example<FieldT>(std::move(cs), std::move(primary_input), std::move(auxiliary_input));
+}
+
 } // libsnark
 
 #endif // R1CS_EXAMPLES_TCC
@@ -0,0 +1,72 @@
+/** @file
+ *****************************************************************************
+
+ Profiling program that times the synthetic R1CS example generators, for
+ sweeping benchmark instance sizes.
+
+ The command
+
+     $ src/relations/constraint_satisfaction_problems/r1cs/profiling/profile_r1cs_examples 20 10 4
+
+ generates R1CS examples with 2^10, 2^12, ..., 2^20 constraints and 10 inputs,
+ the examples with prescribed density having 4 terms in each A.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+void profile_generators(const size_t num_constraints, const size_t num_inputs, const size_t num_terms)
+{
+    long long start = get_nsec_time();
+    const r1cs_example<FieldT> field_example = generate_r1cs_example_with_field_input<FieldT>(num_constraints, num_inputs);
+    const long long field_time = get_nsec_time() - start;
+    assert(field_example.constraint_system.num_constraints() == num_constraints);
+
+    start = get_nsec_time();
+    const r1cs_example<FieldT> binary_example = generate_r1cs_example_with_binary_input<FieldT>(num_constraints, num_inputs);
+    const long long binary_time = get_nsec_time() - start;
+    assert(binary_example.constraint_system.num_constraints() == num_constraints);
+
+    start = get_nsec_time();
+    const r1cs_example<FieldT> density_example = generate_r1cs_example_with_density<FieldT>(num_constraints, num_inputs, num_terms);
+    const long long density_time = get_nsec_time() - start;
+    assert(density_example.constraint_system.num_constraints() == num_constraints);
+
+    printf("num_constraints = %9zu: field input %10.3f ms, binary input %10.3f ms, density %10.3f ms\n",
+           num_constraints, field_time * 1e-6, binary_time * 1e-6, density_time * 1e-6);
+}
+
+int main(int argc, const char * argv[])
+{
+    default_ec_pp::init_public_params();
+    start_profiling();
+    inhibit_profiling_info = true;
+
+    if (argc != 3 && argc != 4)
+    {
+        printf("usage: %s log_max_constraints num_inputs [num_terms]\n", argv[0]);
+        return 1;
+    }
+
+    const size_t log_max_constraints = atoi(argv[1]);
+    const size_t num_inputs = atoi(argv[2]);
+    const size_t num_terms = (argc == 4 ? atoi(argv[3]) : 4);
+
+    for (size_t log_n = 10; log_n <= log_max_constraints; log_n += 2)
+    {
+        profile_generators<Fr<default_ec_pp> >(1ul<<log_n, num_inputs, num_terms);
+    }
+}
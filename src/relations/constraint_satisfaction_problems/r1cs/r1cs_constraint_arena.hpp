@@ -0,0 +1,81 @@
+/** @file
+ *****************************************************************************
+
+ Declaration of interfaces for a memory-compact list of R1CS constraints.
+
+ Storing constraints as std::vector<r1cs_constraint<FieldT> > costs three
+ heap-allocated vectors per constraint and a full field element for every
+ term, even though most coefficients produced by gadgets are 1, -1 or (as in
+ packing) powers of two. The arena instead keeps the terms of all
+ constraints in a single vector, and tags each coefficient as +2^k, -2^k
+ or an index into a shared pool of the remaining field elements.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef R1CS_CONSTRAINT_ARENA_HPP_
+#define R1CS_CONSTRAINT_ARENA_HPP_
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "relations/constraint_satisfaction_problems/r1cs/r1cs.hpp"
+
+namespace libsnark {
+
+/**
+ * A term of an arena: a variable index and a tagged coefficient. The two low
+ * bits of coeff_tag select between +2^k, -2^k and a pool entry; the remaining
+ * bits hold k or the pool index.
+ */
+class r1cs_arena_term {
+public:
+    var_index_t index;
+    size_t coeff_tag;
+};
+
+template<typename FieldT>
+class r1cs_constraint_arena {
+private:
+    std::vector<r1cs_arena_term> terms;
+    std::vector<size_t> lc_offsets; /* terms of the j-th linear combination are terms[lc_offsets[j]] ... terms[lc_offsets[j+1]-1] */
+    std::vector<FieldT> coeff_pool;
+    std::unordered_map<size_t, size_t> pool_index; /* hash of a pooled coefficient -> its position in coeff_pool */
+    std::vector<FieldT> powers_of_two;
+
+    size_t tag_coeff(const FieldT &coeff);
+    FieldT coeff_from_tag(const size_t coeff_tag) const;
+    void add_linear_combination(const linear_combination<FieldT> &lc);
+    linear_combination<FieldT> get_linear_combination(const size_t lc_idx) const;
+    FieldT evaluate_linear_combination(const size_t lc_idx, const r1cs_variable_assignment<FieldT> &full_variable_assignment) const;
+
+public:
+    r1cs_constraint_arena();
+
+    size_t size() const;
+    size_t num_terms() const;
+    size_t num_pool_coeffs() const;
+
+    void add_constraint(const r1cs_constraint<FieldT> &c);
+    r1cs_constraint<FieldT> get_constraint(const size_t i) const;
+    std::vector<r1cs_constraint<FieldT> > get_constraints() const;
+
+    /* evaluates <A_i,(1,x)>, <B_i,(1,x)> and <C_i,(1,x)> without expanding the constraint */
+    void evaluate(const size_t i,
+                  const r1cs_variable_assignment<FieldT> &full_variable_assignment,
+                  FieldT &ares, FieldT &bres, FieldT &cres) const;
+
+    /* bytes used by the arena, and by the same constraints stored as std::vector<r1cs_constraint<FieldT> > (not counting vector slack or allocator overhead) */
+    size_t size_in_bytes() const;
+    size_t expanded_size_in_bytes() const;
+};
+
+} // libsnark
+
+#include "relations/constraint_satisfaction_problems/r1cs/r1cs_constraint_arena.tcc"
+
+#endif // R1CS_CONSTRAINT_ARENA_HPP_
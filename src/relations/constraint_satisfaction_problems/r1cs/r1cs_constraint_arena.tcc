@@ -0,0 +1,246 @@
+/** @file
+ *****************************************************************************
+
+ Implementation of interfaces for a memory-compact list of R1CS constraints.
+
+ See r1cs_constraint_arena.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef R1CS_CONSTRAINT_ARENA_TCC_
+#define R1CS_CONSTRAINT_ARENA_TCC_
+
+#include <cassert>
+#include <unordered_map>
+
+#include "algebra/fields/bigint.hpp"
+
+namespace libsnark {
+
+const size_t r1cs_arena_positive_power_of_two = 0;
+const size_t r1cs_arena_negative_power_of_two = 1;
+const size_t r1cs_arena_pool_coeff = 2;
+
+template<typename FieldT>
+r1cs_constraint_arena<FieldT>::r1cs_constraint_arena() :
+    lc_offsets(1, 0)
+{
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::size() const
+{
+    return (lc_offsets.size() - 1) / 3;
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::num_terms() const
+{
+    return terms.size();
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::num_pool_coeffs() const
+{
+    return coeff_pool.size();
+}
+
+template<mp_size_t n>
+bool bigint_is_power_of_two(const bigint<n> &b, size_t &k)
+{
+    const size_t b_bits = b.num_bits();
+    if (b_bits == 0)
+    {
+        return false;
+    }
+
+    k = b_bits - 1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        const mp_limb_t expected = (i == k / GMP_NUMB_BITS ? ((mp_limb_t)1) << (k % GMP_NUMB_BITS) : 0);
+        if (b.data[i] != expected)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::tag_coeff(const FieldT &coeff)
+{
+    if (powers_of_two.empty())
+    {
+        powers_of_two.resize(FieldT::size_in_bits());
+        powers_of_two[0] = FieldT::one();
+        for (size_t k = 1; k < powers_of_two.size(); ++k)
+        {
+            powers_of_two[k] = powers_of_two[k-1] + powers_of_two[k-1];
+        }
+    }
+
+    const bigint<FieldT::num_limbs> b = coeff.as_bigint();
+    size_t k;
+    if (bigint_is_power_of_two(b, k))
+    {
+        return (k << 2) | r1cs_arena_positive_power_of_two;
+    }
+    if (bigint_is_power_of_two((-coeff).as_bigint(), k))
+    {
+        return (k << 2) | r1cs_arena_negative_power_of_two;
+    }
+
+    /* gadgets reuse a small set of other constants, so keep each of them in the pool once */
+    size_t hash = 0;
+    for (size_t i = 0; i < FieldT::num_limbs; ++i)
+    {
+        hash = hash * 0x100000001b3ul ^ b.data[i];
+    }
+
+    auto it = pool_index.find(hash);
+    if (it != pool_index.end() && coeff_pool[it->second] == coeff)
+    {
+        return (it->second << 2) | r1cs_arena_pool_coeff;
+    }
+
+    coeff_pool.emplace_back(coeff);
+    if (it == pool_index.end())
+    {
+        pool_index[hash] = coeff_pool.size() - 1;
+    }
+    return ((coeff_pool.size() - 1) << 2) | r1cs_arena_pool_coeff;
+}
+
+template<typename FieldT>
+FieldT r1cs_constraint_arena<FieldT>::coeff_from_tag(const size_t coeff_tag) const
+{
+    const size_t payload = coeff_tag >> 2;
+    switch (coeff_tag & 3)
+    {
+    case r1cs_arena_positive_power_of_two:
+        return powers_of_two[payload];
+    case r1cs_arena_negative_power_of_two:
+        return -powers_of_two[payload];
+    default:
+        return coeff_pool[payload];
+    }
+}
+
+template<typename FieldT>
+void r1cs_constraint_arena<FieldT>::add_linear_combination(const linear_combination<FieldT> &lc)
+{
+    for (const linear_term<FieldT> &lt : lc.terms)
+    {
+        r1cs_arena_term term;
+        term.index = lt.index;
+        term.coeff_tag = tag_coeff(lt.coeff);
+        terms.emplace_back(term);
+    }
+    lc_offsets.emplace_back(terms.size());
+}
+
+template<typename FieldT>
+linear_combination<FieldT> r1cs_constraint_arena<FieldT>::get_linear_combination(const size_t lc_idx) const
+{
+    linear_combination<FieldT> result;
+    result.terms.reserve(lc_offsets[lc_idx+1] - lc_offsets[lc_idx]);
+    for (size_t t = lc_offsets[lc_idx]; t < lc_offsets[lc_idx+1]; ++t)
+    {
+        result.terms.emplace_back(linear_term<FieldT>(variable<FieldT>(terms[t].index), coeff_from_tag(terms[t].coeff_tag)));
+    }
+    return result;
+}
+
+template<typename FieldT>
+FieldT r1cs_constraint_arena<FieldT>::evaluate_linear_combination(const size_t lc_idx,
+                                                                  const r1cs_variable_assignment<FieldT> &full_variable_assignment) const
+{
+    const FieldT one = FieldT::one();
+    FieldT acc = FieldT::zero();
+    for (size_t t = lc_offsets[lc_idx]; t < lc_offsets[lc_idx+1]; ++t)
+    {
+        const r1cs_arena_term &term = terms[t];
+        const FieldT &x = (term.index == 0 ? one : full_variable_assignment[term.index-1]);
+        const size_t payload = term.coeff_tag >> 2;
+        switch (term.coeff_tag & 3)
+        {
+        case r1cs_arena_positive_power_of_two:
+            acc += (payload == 0 ? x : x * powers_of_two[payload]);
+            break;
+        case r1cs_arena_negative_power_of_two:
+            acc -= (payload == 0 ? x : x * powers_of_two[payload]);
+            break;
+        default:
+            acc += x * coeff_pool[payload];
+        }
+    }
+    return acc;
+}
+
+template<typename FieldT>
+void r1cs_constraint_arena<FieldT>::add_constraint(const r1cs_constraint<FieldT> &c)
+{
+    add_linear_combination(c.a);
+    add_linear_combination(c.b);
+    add_linear_combination(c.c);
+}
+
+template<typename FieldT>
+r1cs_constraint<FieldT> r1cs_constraint_arena<FieldT>::get_constraint(const size_t i) const
+{
+    assert(i < size());
+    return r1cs_constraint<FieldT>(get_linear_combination(3*i),
+                                   get_linear_combination(3*i+1),
+                                   get_linear_combination(3*i+2));
+}
+
+template<typename FieldT>
+std::vector<r1cs_constraint<FieldT> > r1cs_constraint_arena<FieldT>::get_constraints() const
+{
+    std::vector<r1cs_constraint<FieldT> > result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); ++i)
+    {
+        result.emplace_back(get_constraint(i));
+    }
+    return result;
+}
+
+template<typename FieldT>
+void r1cs_constraint_arena<FieldT>::evaluate(const size_t i,
+                                             const r1cs_variable_assignment<FieldT> &full_variable_assignment,
+                                             FieldT &ares, FieldT &bres, FieldT &cres) const
+{
+    assert(i < size());
+    ares = evaluate_linear_combination(3*i, full_variable_assignment);
+    bres = evaluate_linear_combination(3*i+1, full_variable_assignment);
+    cres = evaluate_linear_combination(3*i+2, full_variable_assignment);
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::size_in_bytes() const
+{
+    return (sizeof(*this) +
+            terms.size() * sizeof(r1cs_arena_term) +
+            lc_offsets.size() * sizeof(size_t) +
+            (coeff_pool.size() + powers_of_two.size()) * sizeof(FieldT) +
+            pool_index.bucket_count() * sizeof(void*) +
+            pool_index.size() * (sizeof(std::pair<const size_t, size_t>) + sizeof(void*)));
+}
+
+template<typename FieldT>
+size_t r1cs_constraint_arena<FieldT>::expanded_size_in_bytes() const
+{
+    return (sizeof(std::vector<r1cs_constraint<FieldT> >) +
+            size() * sizeof(r1cs_constraint<FieldT>) +
+            num_terms() * sizeof(linear_term<FieldT>));
+}
+
+} // libsnark
+
+#endif // R1CS_CONSTRAINT_ARENA_TCC_
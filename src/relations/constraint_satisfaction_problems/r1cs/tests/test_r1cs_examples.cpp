@@ -0,0 +1,66 @@
+/**
+ *****************************************************************************
+ Test program that checks that the R1CS example generators, whose constraints
+ are built in parallel, produce constraint systems that only depend on the
+ state of std::rand, and not on the number of threads.
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include "common/default_types/ec_pp.hpp"
+#include "common/profiling.hpp"
+#include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.hpp"
+
+using namespace libsnark;
+
+template<typename FieldT>
+void test_thread_independence(const size_t num_constraints, const size_t num_inputs, const size_t num_terms, const size_t layer_width)
+{
+    const unsigned seed = 12345;
+
+    std::srand(seed);
+    const r1cs_example<FieldT> field_example = generate_r1cs_example_with_field_input<FieldT>(num_constraints, num_inputs);
+    std::srand(seed);
+    const r1cs_example<FieldT> density_example = generate_r1cs_example_with_density<FieldT>(num_constraints, num_inputs, num_terms, layer_width);
+
+#ifdef MULTICORE
+    const int max_threads = omp_get_max_threads();
+    for (const int num_threads : { 1, 2, 7 })
+    {
+        omp_set_num_threads(num_threads);
+#endif
+        std::srand(seed);
+        const r1cs_example<FieldT> other_field_example = generate_r1cs_example_with_field_input<FieldT>(num_constraints, num_inputs);
+        assert(other_field_example.constraint_system == field_example.constraint_system);
+        assert(other_field_example.constraint_system.is_satisfied(other_field_example.primary_input, other_field_example.auxiliary_input));
+
+        /* the inputs, and so the witness, differ between calls; only the constraints are seeded */
+        std::srand(seed);
+        const r1cs_example<FieldT> other_density_example = generate_r1cs_example_with_density<FieldT>(num_constraints, num_inputs, num_terms, layer_width);
+        assert(other_density_example.constraint_system == density_example.constraint_system);
+        assert(other_density_example.constraint_system.is_satisfied(other_density_example.primary_input, other_density_example.auxiliary_input));
+#ifdef MULTICORE
+    }
+    omp_set_num_threads(max_threads);
+#endif
+}
+
+int main()
+{
+    start_profiling();
+    default_ec_pp::init_public_params();
+    inhibit_profiling_info = true;
+
+    test_thread_independence<Fr<default_ec_pp> >(1000, 10, 5, 64);
+    test_thread_independence<Fr<default_ec_pp> >(100, 1, 1, 1000);
+
+    printf("All R1CS example tests passed\n");
+}
@@ -143,7 +143,7 @@ r1cs_sp_ppzkpcd_keypair<PCD_ppT> r1cs_sp_ppzkpcd_generator(const r1cs_sp_ppzkpcd
     enter_block("Construct compliance step PCD circuit");
     sp_compliance_step_pcd_circuit_maker<curve_A_pp> compliance_step_pcd_circuit(compliance_predicate);
     compliance_step_pcd_circuit.generate_r1cs_constraints();
-    const r1cs_constraint_system<FieldT_A> compliance_step_pcd_circuit_cs = compliance_step_pcd_circuit.get_circuit();
+    const r1cs_constraint_system<FieldT_A> compliance_step_pcd_circuit_cs = compliance_step_pcd_circuit.release_circuit();
     compliance_step_pcd_circuit_cs.report_linear_constraint_statistics();
     leave_block("Construct compliance step PCD circuit");
 
@@ -154,7 +154,7 @@ r1cs_sp_ppzkpcd_keypair<PCD_ppT> r1cs_sp_ppzkpcd_generator(const r1cs_sp_ppzkpcd
     enter_block("Construct translation step PCD circuit");
     sp_translation_step_pcd_circuit_maker<curve_B_pp> translation_step_pcd_circuit(compliance_step_keypair.vk);
     translation_step_pcd_circuit.generate_r1cs_constraints();
-    const r1cs_constraint_system<FieldT_B> translation_step_pcd_circuit_cs = translation_step_pcd_circuit.get_circuit();
+    const r1cs_constraint_system<FieldT_B> translation_step_pcd_circuit_cs = translation_step_pcd_circuit.release_circuit();
     translation_step_pcd_circuit_cs.report_linear_constraint_statistics();
     leave_block("Construct translation step PCD circuit");
 
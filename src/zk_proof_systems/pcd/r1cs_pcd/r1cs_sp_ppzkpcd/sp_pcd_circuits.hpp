@@ -93,6 +93,7 @@ public:
     sp_compliance_step_pcd_circuit_maker(const r1cs_pcd_compliance_predicate<FieldT> &compliance_predicate);
     void generate_r1cs_constraints();
     r1cs_constraint_system<FieldT> get_circuit() const;
+    r1cs_constraint_system<FieldT> release_circuit(); /* see protoboard::release_constraint_system */
 
     void generate_r1cs_witness(const r1cs_ppzksnark_verification_key<other_curve<ppT> > &translation_step_pcd_circuit_vk,
                                const r1cs_pcd_compliance_predicate_primary_input<FieldT> &compliance_predicate_primary_input,
@@ -134,6 +135,7 @@ public:
     sp_translation_step_pcd_circuit_maker(const r1cs_ppzksnark_verification_key<other_curve<ppT> > &compliance_step_vk);
     void generate_r1cs_constraints();
     r1cs_constraint_system<FieldT> get_circuit() const;
+    r1cs_constraint_system<FieldT> release_circuit(); /* see protoboard::release_constraint_system */
 
     void generate_r1cs_witness(const r1cs_primary_input<Fr<ppT> > translation_step_input,
                                const r1cs_ppzksnark_proof<other_curve<ppT> > &compliance_step_proof);
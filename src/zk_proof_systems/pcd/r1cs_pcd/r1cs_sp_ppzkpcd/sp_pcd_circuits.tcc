@@ -253,6 +253,12 @@ r1cs_constraint_system<Fr<ppT> > sp_compliance_step_pcd_circuit_maker<ppT>::get_
     return pb.get_constraint_system();
 }
 
+template<typename ppT>
+r1cs_constraint_system<Fr<ppT> > sp_compliance_step_pcd_circuit_maker<ppT>::release_circuit()
+{
+    return pb.release_constraint_system();
+}
+
 template<typename ppT>
 r1cs_primary_input<Fr<ppT> > sp_compliance_step_pcd_circuit_maker<ppT>::get_primary_input() const
 {
@@ -396,6 +402,12 @@ r1cs_constraint_system<Fr<ppT> > sp_translation_step_pcd_circuit_maker<ppT>::get
     return pb.get_constraint_system();
 }
 
+template<typename ppT>
+r1cs_constraint_system<Fr<ppT> > sp_translation_step_pcd_circuit_maker<ppT>::release_circuit()
+{
+    return pb.release_constraint_system();
+}
+
 template<typename ppT>
 void sp_translation_step_pcd_circuit_maker<ppT>::generate_r1cs_witness(const r1cs_primary_input<Fr<ppT> > sp_translation_step_input,
                                                                        const r1cs_ppzksnark_proof<other_curve<ppT> > &compliance_step_proof)
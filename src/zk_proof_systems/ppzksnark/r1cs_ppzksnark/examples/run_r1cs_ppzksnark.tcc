@@ -81,6 +81,9 @@ bool run_r1cs_ppzksnark(const r1cs_example<Fr<ppT> > &example,
         leave_block("Test serialization of keys");
     }
 
+    /* e.g. after loading the key: move its queries to where the prover's worker threads will read them */
+    keypair.pk.place_on_numa_nodes();
+
     print_header("R1CS ppzkSNARK Prover");
     r1cs_ppzksnark_proof<ppT> proof = r1cs_ppzksnark_prover<ppT>(keypair.pk, example.primary_input, example.auxiliary_input);
     printf("\n"); print_indent(); print_mem("after prover");
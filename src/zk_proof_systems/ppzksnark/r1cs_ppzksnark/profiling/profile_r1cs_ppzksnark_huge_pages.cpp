@@ -0,0 +1,217 @@
+/** @file
+ *****************************************************************************
+ Profiling program that measures the effect of huge pages on the FFTs and on
+ the generator and prover of the R1CS ppzkSNARK.
+
+ For every huge_page_policy (none, transparent, explicit), it times an FFT
+ over the evaluation domain of the instance, the generator, and the prover,
+ and reports the data-TLB misses of the FFT and of the prover as counted by
+ perf_event_open (which needs /proc/sys/kernel/perf_event_paranoid <= 2 and a
+ PMU that is visible to the process; otherwise "n/a" is printed). It also
+ reports how much of the process memory is backed by transparent huge pages
+ while the FFT buffer is alive.
+
+ The command
+
+     $ src/zk_proof_systems/ppzksnark/r1cs_ppzksnark/profiling/profile_r1cs_ppzksnark_huge_pages 1000000 10
+
+ profiles an R1CS instance with 1000000 equations and an input consisting of
+ 10 field elements. The counters only cover the main thread and the threads
+ it creates afterwards, so build without MULTICORE for exact TLB-miss counts.
+ Explicit huge pages need a pool, e.g. "sysctl vm.nr_hugepages=1024".
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "algebra/evaluation_domain/evaluation_domain.hpp"
+#include "common/default_types/r1cs_ppzksnark_pp.hpp"
+#include "common/huge_page_allocator.hpp"
+#include "common/profiling.hpp"
+#include "common/prover_config.hpp"
+#include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.hpp"
+#include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.hpp"
+
+using namespace libsnark;
+
+/* return a file descriptor of a stopped counter of data-TLB read misses of the calling thread (-1 if unavailable) */
+int open_dtlb_miss_counter()
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+void start_counter(const int fd)
+{
+#ifdef __linux__
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/* stop the counter and return its value (-1 if unavailable) */
+long long stop_counter(const int fd)
+{
+    long long count = -1;
+#ifdef __linux__
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &count, sizeof(count)) != sizeof(count))
+        {
+            count = -1;
+        }
+    }
+#endif
+    return count;
+}
+
+/* return the AnonHugePages entry of /proc/self/smaps_rollup in kB (-1 if unavailable) */
+long long anon_huge_pages_in_kb()
+{
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(smaps, line))
+    {
+        if (line.compare(0, 14, "AnonHugePages:") == 0)
+        {
+            return atoll(line.c_str() + 14);
+        }
+    }
+    return -1;
+}
+
+void print_count(const char *name, const long long count)
+{
+    if (count < 0)
+    {
+        printf(" %s %12s", name, "n/a");
+    }
+    else
+    {
+        printf(" %s %12lld", name, count);
+    }
+}
+
+template<typename FieldT>
+void profile_fft(const size_t num_constraints, const int counter)
+{
+    const std::shared_ptr<evaluation_domain<FieldT> > domain = get_evaluation_domain<FieldT>(num_constraints);
+    std::vector<FieldT> a = make_vector_on_huge_pages(domain->m, FieldT::zero());
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = FieldT::random_element();
+    }
+
+    start_counter(counter);
+    const long long start = get_nsec_time();
+    domain->FFT(a);
+    const long long time = get_nsec_time() - start;
+    const long long misses = stop_counter(counter);
+
+    printf("  FFT of size %zu: %10.3f ms,", domain->m, time * 1e-6);
+    print_count("dTLB misses", misses);
+    printf(",");
+    print_count("kB on transparent huge pages", anon_huge_pages_in_kb());
+    printf("\n");
+}
+
+template<typename ppT>
+void profile_policies(const size_t num_constraints, const size_t input_size)
+{
+    const r1cs_example<Fr<ppT> > example = generate_r1cs_example_with_field_input<Fr<ppT> >(num_constraints, input_size);
+    const int counter = open_dtlb_miss_counter();
+
+    const huge_page_policy policies[] = { huge_pages_none, huge_pages_transparent, huge_pages_explicit };
+    const char *names[] = { "none", "transparent", "explicit" };
+    for (size_t p = 0; p < 3; ++p)
+    {
+        set_prover_config(prover_config(0, 0, numa_first_touch, false, policies[p]));
+        printf("* %s:\n", names[p]);
+
+        profile_fft<Fr<ppT> >(num_constraints, counter);
+
+        const long long generator_start = get_nsec_time();
+        const r1cs_ppzksnark_keypair<ppT> keypair = r1cs_ppzksnark_generator<ppT>(example.constraint_system);
+        const long long generator_time = get_nsec_time() - generator_start;
+
+        std::vector<long long> times, misses;
+        for (size_t rep = 0; rep < 3; ++rep)
+        {
+            start_counter(counter);
+            const long long start = get_nsec_time();
+            const r1cs_ppzksnark_proof<ppT> proof = r1cs_ppzksnark_prover<ppT>(keypair.pk, example.primary_input, example.auxiliary_input);
+            times.emplace_back(get_nsec_time() - start);
+            misses.emplace_back(stop_counter(counter));
+            assert(r1cs_ppzksnark_verifier_strong_IC<ppT>(keypair.vk, example.primary_input, proof));
+        }
+        std::sort(times.begin(), times.end());
+        std::sort(misses.begin(), misses.end());
+
+        printf("  generator %10.3f ms, prover %10.3f ms (median of 3),", generator_time * 1e-6, times[1] * 1e-6);
+        print_count("dTLB misses", misses[1]);
+        printf("\n");
+    }
+
+#ifdef __linux__
+    if (counter >= 0)
+    {
+        close(counter);
+    }
+#endif
+}
+
+int main(int argc, const char * argv[])
+{
+    default_r1cs_ppzksnark_pp::init_public_params();
+    start_profiling();
+
+    if (argc != 3)
+    {
+        printf("usage: %s num_constraints input_size\n", argv[0]);
+        return 1;
+    }
+    const size_t num_constraints = atoi(argv[1]);
+    const size_t input_size = atoi(argv[2]);
+
+    std::ifstream thp("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string thp_setting;
+    if (std::getline(thp, thp_setting))
+    {
+        printf("* transparent huge pages: %s\n", thp_setting.c_str());
+    }
+
+    inhibit_profiling_info = true;
+    profile_policies<default_r1cs_ppzksnark_pp>(num_constraints, input_size);
+}
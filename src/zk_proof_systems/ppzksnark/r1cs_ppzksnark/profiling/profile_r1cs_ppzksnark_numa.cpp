@@ -0,0 +1,155 @@
+/** @file
+ *****************************************************************************
+ Profiling program that measures the effect of NUMA placement on the R1CS
+ ppzkSNARK prover.
+
+ It first measures the read bandwidth of the main thread from a buffer on each
+ NUMA node (local against remote memory). It then generates a key pair, and
+ times the prover with the proving key left where the generating thread put it
+ (numa_first_touch), interleaved over all nodes (numa_interleave), and
+ partitioned to match the chunks of the multi-exponentiations
+ (numa_partition), always with pinned worker threads. For every placement, it
+ reports the share of the pages of the H-query on each node.
+
+ The command
+
+     $ src/zk_proof_systems/ppzksnark/r1cs_ppzksnark/profiling/profile_r1cs_ppzksnark_numa 100000 10
+
+ profiles an R1CS instance with 100000 equations and an input consisting of 10
+ field elements. Build with NUMA=1 MULTICORE=1 for meaningful results; without
+ libnuma there is a single node and the placements coincide.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#ifdef USE_NUMA
+#include <numa.h>
+#endif
+
+#include "common/default_types/r1cs_ppzksnark_pp.hpp"
+#include "common/numa_placement.hpp"
+#include "common/profiling.hpp"
+#include "common/prover_config.hpp"
+#include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.hpp"
+#include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.hpp"
+
+using namespace libsnark;
+
+volatile uint64_t read_sink; /* keeps the reads below from being optimized away */
+
+/* return the read bandwidth (in GB/s) of the calling thread from num_words words at data */
+double read_bandwidth(const uint64_t *data, const size_t num_words)
+{
+    uint64_t sum = 0;
+    const long long start = get_nsec_time();
+    for (size_t rep = 0; rep < 4; ++rep)
+    {
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            sum += data[i];
+        }
+    }
+    const long long time = get_nsec_time() - start;
+    read_sink = sum;
+
+    return 4. * num_words * sizeof(uint64_t) / time;
+}
+
+void profile_bandwidth(const size_t num_bytes)
+{
+    const size_t num_words = num_bytes / sizeof(uint64_t);
+    for (size_t node = 0; node < numa_num_nodes(); ++node)
+    {
+#ifdef USE_NUMA
+        uint64_t *data = (uint64_t*) numa_alloc_onnode(num_words * sizeof(uint64_t), node);
+#else
+        uint64_t *data = (uint64_t*) malloc(num_words * sizeof(uint64_t));
+#endif
+        std::fill(data, data + num_words, 1);
+        printf("* read bandwidth from node %zu (main thread on node %zu): %6.2f GB/s\n",
+               node, numa_node_of_calling_thread(), read_bandwidth(data, num_words));
+#ifdef USE_NUMA
+        numa_free(data, num_words * sizeof(uint64_t));
+#else
+        free(data);
+#endif
+    }
+}
+
+template<typename T>
+void print_node_shares(const std::vector<T> &v)
+{
+    const size_t page_size = 4096;
+    std::vector<size_t> pages_on_node(numa_num_nodes(), 0);
+    const char *begin = (const char*) v.data();
+    for (size_t offset = 0; offset < v.size() * sizeof(T); offset += page_size)
+    {
+        ++pages_on_node[std::min(numa_node_of_address(begin + offset), pages_on_node.size() - 1)];
+    }
+
+    const size_t num_pages = div_ceil(v.size() * sizeof(T), page_size);
+    printf("  H-query pages on nodes:");
+    for (size_t node = 0; node < pages_on_node.size(); ++node)
+    {
+        printf(" %zu: %5.1f%%", node, 100. * pages_on_node[node] / num_pages);
+    }
+    printf("\n");
+}
+
+template<typename ppT>
+void profile_placements(const size_t num_constraints, const size_t input_size)
+{
+    const r1cs_example<Fr<ppT> > example = generate_r1cs_example_with_field_input<Fr<ppT> >(num_constraints, input_size);
+    const r1cs_ppzksnark_keypair<ppT> keypair = r1cs_ppzksnark_generator<ppT>(example.constraint_system);
+
+    const numa_placement_policy policies[] = { numa_first_touch, numa_interleave, numa_partition };
+    const char *names[] = { "first touch", "interleave", "partition" };
+    for (size_t p = 0; p < 3; ++p)
+    {
+        set_prover_config(prover_config(0, 0, policies[p], true));
+
+        const long long place_start = get_nsec_time();
+        keypair.pk.place_on_numa_nodes();
+        const long long place_time = get_nsec_time() - place_start;
+
+        std::vector<long long> times;
+        for (size_t rep = 0; rep < 3; ++rep)
+        {
+            const long long start = get_nsec_time();
+            const r1cs_ppzksnark_proof<ppT> proof = r1cs_ppzksnark_prover<ppT>(keypair.pk, example.primary_input, example.auxiliary_input);
+            times.emplace_back(get_nsec_time() - start);
+            assert(r1cs_ppzksnark_verifier_strong_IC<ppT>(keypair.vk, example.primary_input, proof));
+        }
+        std::sort(times.begin(), times.end());
+
+        printf("* %-11s: prover %10.3f ms (median of 3), placement %8.3f ms\n", names[p], times[1] * 1e-6, place_time * 1e-6);
+        print_node_shares(keypair.pk.H_query);
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    default_r1cs_ppzksnark_pp::init_public_params();
+    start_profiling();
+
+    if (argc != 3)
+    {
+        printf("usage: %s num_constraints input_size\n", argv[0]);
+        return 1;
+    }
+    const size_t num_constraints = atoi(argv[1]);
+    const size_t input_size = atoi(argv[2]);
+
+    set_prover_config(prover_config(0, 0, numa_first_touch, true));
+    profile_bandwidth(1ul << 28);
+
+    inhibit_profiling_info = true;
+    profile_placements<default_r1cs_ppzksnark_pp>(num_constraints, input_size);
+}
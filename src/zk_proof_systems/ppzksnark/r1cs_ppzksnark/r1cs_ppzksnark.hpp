@@ -50,6 +50,7 @@
 
 #include "algebra/curves/public_params.hpp"
 #include "common/data_structures/accumulation_vector.hpp"
+#include "common/numa_placement.hpp"
 #include "algebra/knowledge_commitment/knowledge_commitment.hpp"
 #include "relations/constraint_satisfaction_problems/r1cs/r1cs.hpp"
 #include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark_params.hpp"
@@ -133,6 +134,16 @@ public:
         print_indent(); printf("* PK size in bits: %zu\n", this->size_in_bits());
     }
 
+    /* migrate the queries to NUMA nodes, as set by the active prover configuration (see common/numa_placement.hpp) */
+    void place_on_numa_nodes() const
+    {
+        numa_place_vector(A_query.values);
+        numa_place_vector(B_query.values);
+        numa_place_vector(C_query.values);
+        numa_place_vector(H_query);
+        numa_place_vector(K_query);
+    }
+
     bool operator==(const r1cs_ppzksnark_proving_key<ppT> &other) const;
     friend std::ostream& operator<< <ppT>(std::ostream &out, const r1cs_ppzksnark_proving_key<ppT> &pk);
     friend std::istream& operator>> <ppT>(std::istream &in, r1cs_ppzksnark_proving_key<ppT> &pk);
@@ -207,6 +218,12 @@ public:
         print_indent(); printf("* VK size in bits: %zu\n", this->size_in_bits());
     }
 
+    /**
+     * Check that all elements lie on the curve and in the right subgroup.
+     * Deserialization runs this check, and fails the stream when it does not hold.
+     */
+    bool is_well_formed() const;
+
     bool operator==(const r1cs_ppzksnark_verification_key<ppT> &other) const;
     friend std::ostream& operator<< <ppT>(std::ostream &out, const r1cs_ppzksnark_verification_key<ppT> &vk);
     friend std::istream& operator>> <ppT>(std::istream &in, r1cs_ppzksnark_verification_key<ppT> &vk);
@@ -232,6 +249,10 @@ std::istream& operator>>(std::istream &in, r1cs_ppzksnark_processed_verification
  * Compared to a (non-processed) verification key, a processed verification key
  * contains a small constant amount of additional pre-computed information that
  * enables a faster verification time.
+ *
+ * The online verifiers only read a processed verification key, so a single one
+ * can serve any number of verifications, also concurrently from several threads
+ * (provided that inhibit_profiling_counters is set, as profiling is not thread-safe).
  */
 template<typename ppT>
 class r1cs_ppzksnark_processed_verification_key {
@@ -349,13 +370,15 @@ public:
         print_indent(); printf("* Proof size in bits: %zu\n", this->size_in_bits());
     }
 
+    /**
+     * Check that all elements lie on the curve and in the right subgroup (in
+     * parallel across elements); the online verifiers reject proofs that fail it,
+     * and deserialization fails the stream for them.
+     */
     bool is_well_formed() const
     {
-        return (g_A.g.is_well_formed() && g_A.h.is_well_formed() &&
-                g_B.g.is_well_formed() && g_B.h.is_well_formed() &&
-                g_C.g.is_well_formed() && g_C.h.is_well_formed() &&
-                g_H.is_well_formed() &&
-                g_K.is_well_formed());
+        return (batch_is_valid<G1<ppT> >({ g_A.g, g_A.h, g_B.h, g_C.g, g_C.h, g_H, g_K }) &&
+                batch_is_valid<G2<ppT> >({ g_B.g }));
     }
 
     bool operator==(const r1cs_ppzksnark_proof<ppT> &other) const;
@@ -374,6 +397,14 @@ public:
 template<typename ppT>
 r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constraint_system<ppT> &cs);
 
+/**
+ * Returns an estimate of the peak memory (in bytes) of r1cs_ppzksnark_prover
+ * for the proving key pk, under the active prover configuration (see
+ * common/prover_config.hpp), including the proving key itself.
+ */
+template<typename ppT>
+size_t r1cs_ppzksnark_prover_peak_memory(const r1cs_ppzksnark_proving_key<ppT> &pk);
+
 /**
  * A prover algorithm for the R1CS ppzkSNARK.
  *
@@ -447,6 +478,19 @@ bool r1cs_ppzksnark_online_verifier_strong_IC(const r1cs_ppzksnark_processed_ver
                                               const r1cs_ppzksnark_primary_input<ppT> &primary_input,
                                               const r1cs_ppzksnark_proof<ppT> &proof);
 
+/**
+ * The pairing checks of the online verifiers, given the input-dependent part
+ * acc of A, i.e., the encoded IC query already accumulated against the primary
+ * input (pvk.encoded_IC_query is not used).
+ *
+ * This lets ppzkSNARKs built on top of the R1CS ppzkSNARK (e.g., the RAM one)
+ * bind their inputs to the IC query without copying the processed verification key.
+ */
+template<typename ppT>
+bool r1cs_ppzksnark_online_verifier_accumulated_IC(const r1cs_ppzksnark_processed_verification_key<ppT> &pvk,
+                                                   const G1<ppT> &acc,
+                                                   const r1cs_ppzksnark_proof<ppT> &proof);
+
 /****************************** Miscellaneous ********************************/
 
 /**
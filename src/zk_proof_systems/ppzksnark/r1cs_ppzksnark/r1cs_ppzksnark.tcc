@@ -21,7 +21,9 @@ See r1cs_ppzksnark.hpp .
 #include <sstream>
 
 #include "common/profiling.hpp"
+#include "common/prover_config.hpp"
 #include "common/utils.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/multiexp.hpp"
 #include "algebra/scalar_multiplication/kc_multiexp.hpp"
 #include "reductions/r1cs_to_qap/r1cs_to_qap.hpp"
@@ -65,6 +67,14 @@ std::istream& operator>>(std::istream &in, r1cs_ppzksnark_proving_key<ppT> &pk)
     return in;
 }
 
+template<typename ppT>
+bool r1cs_ppzksnark_verification_key<ppT>::is_well_formed() const
+{
+    return (batch_is_valid<G1<ppT> >({ this->alphaB_g1, this->gamma_beta_g1, this->encoded_IC_query.first }) &&
+            batch_is_valid<G1<ppT> >(this->encoded_IC_query.rest.values) &&
+            batch_is_valid<G2<ppT> >({ this->alphaA_g2, this->alphaC_g2, this->gamma_g2, this->gamma_beta_g2, this->rC_Z_g2 }));
+}
+
 template<typename ppT>
 bool r1cs_ppzksnark_verification_key<ppT>::operator==(const r1cs_ppzksnark_verification_key<ppT> &other) const
 {
@@ -113,6 +123,11 @@ std::istream& operator>>(std::istream &in, r1cs_ppzksnark_verification_key<ppT>
     in >> vk.encoded_IC_query;
     consume_OUTPUT_NEWLINE(in);
 
+    if (!vk.is_well_formed())
+    {
+        in.setstate(std::ios_base::failbit);
+    }
+
     return in;
 }
 
@@ -207,6 +222,11 @@ std::istream& operator>>(std::istream &in, r1cs_ppzksnark_proof<ppT> &proof)
     in >> proof.g_K;
     consume_OUTPUT_NEWLINE(in);
 
+    if (!proof.is_well_formed())
+    {
+        in.setstate(std::ios_base::failbit);
+    }
+
     return in;
 }
 
@@ -243,8 +263,9 @@ r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constr
     r1cs_ppzksnark_constraint_system<ppT> cs_copy(cs);
     cs_copy.swap_AB_if_beneficial();
 
-    /* draw random element at which the QAP is evaluated */
-    const  Fr<ppT> t = Fr<ppT>::random_element();
+    /* draw, at once, the random element at which the QAP is evaluated and the other secrets of the generator */
+    const Fr_vector<ppT> secrets = random_field_elements<Fr<ppT> >(8);
+    const  Fr<ppT> t = secrets[0];
 
     qap_instance_evaluation<Fr<ppT> > qap_inst = r1cs_to_qap_instance_map_with_evaluation(cs_copy, t);
 
@@ -289,13 +310,13 @@ r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constr
     Bt.emplace_back(qap_inst.Zt);
     Ct.emplace_back(qap_inst.Zt);
 
-    const  Fr<ppT> alphaA = Fr<ppT>::random_element(),
-        alphaB = Fr<ppT>::random_element(),
-        alphaC = Fr<ppT>::random_element(),
-        rA = Fr<ppT>::random_element(),
-        rB = Fr<ppT>::random_element(),
-        beta = Fr<ppT>::random_element(),
-        gamma = Fr<ppT>::random_element();
+    const  Fr<ppT> alphaA = secrets[1],
+        alphaB = secrets[2],
+        alphaC = secrets[3],
+        rA = secrets[4],
+        rB = secrets[5],
+        beta = secrets[6],
+        gamma = secrets[7];
     const Fr<ppT>      rC = rA * rB;
 
     // consrtuct the same-coefficient-check query (must happen before zeroing out the prefix of At)
@@ -322,16 +343,24 @@ r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constr
     const size_t g1_exp_count = 2*(non_zero_At - qap_inst.num_inputs() + non_zero_Ct) + non_zero_Bt + non_zero_Ht + Kt.size();
     const size_t g2_exp_count = non_zero_Bt;
 
-    size_t g1_window = get_exp_window_size<G1<ppT> >(g1_exp_count);
-    size_t g2_window = get_exp_window_size<G2<ppT> >(g2_exp_count);
+    /* the fixed-base tables share the memory left once the key and the evaluations At, ..., Kt are in place */
+    typedef typename knowledge_commitment_vector<G1<ppT>, G1<ppT> >::index_type index_type;
+    const size_t key_bytes = ((non_zero_At + non_zero_Ct) * (sizeof(knowledge_commitment<G1<ppT>, G1<ppT> >) + sizeof(index_type)) +
+                              non_zero_Bt * (sizeof(knowledge_commitment<G2<ppT>, G1<ppT> >) + sizeof(index_type)) +
+                              (Ht.size() + Kt.size()) * sizeof(G1<ppT>));
+    const size_t evaluations_bytes = (At.size() + Bt.size() + Ct.size() + Ht.size() + Kt.size()) * sizeof(Fr<ppT>);
+    const size_t table_budget = active_prover_config.available_memory(key_bytes + evaluations_bytes) / 2;
+
+    size_t g1_window = fit_window_size<G1<ppT> >(Fr<ppT>::size_in_bits(), get_exp_window_size<G1<ppT> >(g1_exp_count), table_budget);
+    size_t g2_window = fit_window_size<G2<ppT> >(Fr<ppT>::size_in_bits(), get_exp_window_size<G2<ppT> >(g2_exp_count), table_budget);
     print_indent(); printf("* G1 window: %zu\n", g1_window);
     print_indent(); printf("* G2 window: %zu\n", g2_window);
+    active_prover_config.print();
+    print_memory_estimate("Predicted peak memory", key_bytes + evaluations_bytes +
+                          window_table_size_in_bytes<G1<ppT> >(Fr<ppT>::size_in_bits(), g1_window) +
+                          window_table_size_in_bytes<G2<ppT> >(Fr<ppT>::size_in_bits(), g2_window));
 
-#ifdef MULTICORE
-    const size_t chunks = 4; //omp_get_max_threads();
-#else
-    const size_t chunks = 1;
-#endif
+    const size_t chunks = active_prover_config.multiexp_chunks();
 
     enter_block("Generating G1 multiexp table");
     window_table<G1<ppT> > g1_table = get_window_table(Fr<ppT>::size_in_bits(), g1_window, G1<ppT>::one());
@@ -346,18 +375,23 @@ r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constr
     enter_block("Generate knowledge commitments");
     enter_block("Compute the A-query", false);
     knowledge_commitment_vector<G1<ppT>, G1<ppT> > A_query = kc_batch_exp(Fr<ppT>::size_in_bits(), g1_window, g1_window, g1_table, g1_table, rA, rA*alphaA, At, chunks);
+    Fr_vector<ppT>().swap(At); // destroy At
     leave_block("Compute the A-query", false);
 
     enter_block("Compute the B-query", false);
     knowledge_commitment_vector<G2<ppT>, G1<ppT> > B_query = kc_batch_exp(Fr<ppT>::size_in_bits(), g2_window, g1_window, g2_table, g1_table, rB, rB*alphaB, Bt, chunks);
+    Fr_vector<ppT>().swap(Bt); // destroy Bt
+    window_table<G2<ppT> >().swap(g2_table); // destroy g2_table, which is only used for the B-query
     leave_block("Compute the B-query", false);
 
     enter_block("Compute the C-query", false);
     knowledge_commitment_vector<G1<ppT>, G1<ppT> > C_query = kc_batch_exp(Fr<ppT>::size_in_bits(), g1_window, g1_window, g1_table, g1_table, rC, rC*alphaC, Ct, chunks);
+    Fr_vector<ppT>().swap(Ct); // destroy Ct
     leave_block("Compute the C-query", false);
 
     enter_block("Compute the H-query", false);
     G1_vector<ppT> H_query = batch_exp(Fr<ppT>::size_in_bits(), g1_window, g1_table, Ht);
+    Fr_vector<ppT>().swap(Ht); // destroy Ht
     leave_block("Compute the H-query", false);
 
     enter_block("Compute the K-query", false);
@@ -418,6 +452,28 @@ r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator(const r1cs_ppzksnark_constr
     return r1cs_ppzksnark_keypair<ppT>(std::move(pk), std::move(vk));
 }
 
+template <typename ppT>
+size_t r1cs_ppzksnark_prover_peak_memory(const r1cs_ppzksnark_proving_key<ppT> &pk)
+{
+    const size_t num_variables = pk.constraint_system.num_variables();
+    const size_t degree = pk.H_query.size() - 1;
+
+    /* the QAP witness, and the evaluations of A, B, C (and an FFT scratch copy) while it is computed */
+    const size_t witness_bytes = (num_variables + 1 + degree + 1) * sizeof(Fr<ppT>);
+    const size_t witness_map_bytes = (active_prover_config.fits_scratch_budget(degree * sizeof(Fr<ppT>)) ? 4 : 3) * degree * sizeof(Fr<ppT>);
+
+    /* the largest multi-exponentiation: kc_multi_exp_with_mixed_addition copies the terms it passes to multi_exp */
+    const size_t A_bytes = pk.A_query.size() * (sizeof(knowledge_commitment<G1<ppT>, G1<ppT> >) + sizeof(Fr<ppT>)) +
+        multi_exp_scratch_size_in_bytes<knowledge_commitment<G1<ppT>, G1<ppT> >, Fr<ppT> >(pk.A_query.size());
+    const size_t B_bytes = pk.B_query.size() * (sizeof(knowledge_commitment<G2<ppT>, G1<ppT> >) + sizeof(Fr<ppT>)) +
+        multi_exp_scratch_size_in_bytes<knowledge_commitment<G2<ppT>, G1<ppT> >, Fr<ppT> >(pk.B_query.size());
+    const size_t H_bytes = multi_exp_scratch_size_in_bytes<G1<ppT>, Fr<ppT> >(pk.H_query.size());
+    const size_t K_bytes = pk.K_query.size() * (sizeof(G1<ppT>) + sizeof(Fr<ppT>)) +
+        multi_exp_scratch_size_in_bytes<G1<ppT>, Fr<ppT> >(pk.K_query.size());
+
+    return pk.size_in_bits() / 8 + witness_bytes + std::max(witness_map_bytes, std::max(std::max(A_bytes, B_bytes), std::max(H_bytes, K_bytes)));
+}
+
 template <typename ppT>
 r1cs_ppzksnark_proof<ppT> r1cs_ppzksnark_prover(const r1cs_ppzksnark_proving_key<ppT> &pk,
                                                 const r1cs_ppzksnark_primary_input<ppT> &primary_input,
@@ -465,11 +521,9 @@ r1cs_ppzksnark_proof<ppT> r1cs_ppzksnark_prover(const r1cs_ppzksnark_proving_key
     assert(pk.K_query.size() == qap_wit.num_variables()+4);
 #endif
 
-#ifdef MULTICORE
-    const size_t chunks = 4; //omp_get_max_threads();
-#else
-    const size_t chunks = 1;
-#endif
+    const size_t chunks = active_prover_config.multiexp_chunks();
+    active_prover_config.print();
+    print_memory_estimate("Predicted peak memory", r1cs_ppzksnark_prover_peak_memory<ppT>(pk));
 
     enter_block("Compute the proof");
 
@@ -522,14 +576,14 @@ r1cs_ppzksnark_processed_verification_key<ppT> r1cs_ppzksnark_verifier_process_v
     enter_block("Call to r1cs_ppzksnark_verifier_process_vk");
 
     r1cs_ppzksnark_processed_verification_key<ppT> pvk;
-    pvk.pp_G2_one_precomp        = ppT::precompute_G2(G2<ppT>::one());
-    pvk.vk_alphaA_g2_precomp     = ppT::precompute_G2(vk.alphaA_g2);
+    pvk.pp_G2_one_precomp        = ppT::precompute_G2_for_reuse(G2<ppT>::one());
+    pvk.vk_alphaA_g2_precomp     = ppT::precompute_G2_for_reuse(vk.alphaA_g2);
     pvk.vk_alphaB_g1_precomp     = ppT::precompute_G1(vk.alphaB_g1);
-    pvk.vk_alphaC_g2_precomp     = ppT::precompute_G2(vk.alphaC_g2);
-    pvk.vk_rC_Z_g2_precomp       = ppT::precompute_G2(vk.rC_Z_g2);
-    pvk.vk_gamma_g2_precomp      = ppT::precompute_G2(vk.gamma_g2);
+    pvk.vk_alphaC_g2_precomp     = ppT::precompute_G2_for_reuse(vk.alphaC_g2);
+    pvk.vk_rC_Z_g2_precomp       = ppT::precompute_G2_for_reuse(vk.rC_Z_g2);
+    pvk.vk_gamma_g2_precomp      = ppT::precompute_G2_for_reuse(vk.gamma_g2);
     pvk.vk_gamma_beta_g1_precomp = ppT::precompute_G1(vk.gamma_beta_g1);
-    pvk.vk_gamma_beta_g2_precomp = ppT::precompute_G2(vk.gamma_beta_g2);
+    pvk.vk_gamma_beta_g2_precomp = ppT::precompute_G2_for_reuse(vk.gamma_beta_g2);
 
     pvk.encoded_IC_query = vk.encoded_IC_query;
 
@@ -547,10 +601,20 @@ bool r1cs_ppzksnark_online_verifier_weak_IC(const r1cs_ppzksnark_processed_verif
     assert(pvk.encoded_IC_query.domain_size() >= primary_input.size());
 
     enter_block("Compute input-dependent part of A");
-    const accumulation_vector<G1<ppT> > accumulated_IC = pvk.encoded_IC_query.template accumulate_chunk<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
-    const G1<ppT> &acc = accumulated_IC.first;
+    const G1<ppT> acc = pvk.encoded_IC_query.template accumulate_chunk_value<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
     leave_block("Compute input-dependent part of A");
 
+    const bool result = r1cs_ppzksnark_online_verifier_accumulated_IC<ppT>(pvk, acc, proof);
+    leave_block("Call to r1cs_ppzksnark_online_verifier_weak_IC");
+
+    return result;
+}
+
+template <typename ppT>
+bool r1cs_ppzksnark_online_verifier_accumulated_IC(const r1cs_ppzksnark_processed_verification_key<ppT> &pvk,
+                                                   const G1<ppT> &acc,
+                                                   const r1cs_ppzksnark_proof<ppT> &proof)
+{
     bool result = true;
 
     enter_block("Check if the proof is well-formed");
@@ -647,7 +711,6 @@ bool r1cs_ppzksnark_online_verifier_weak_IC(const r1cs_ppzksnark_processed_verif
     }
     leave_block("Check same coefficients were used");
     leave_block("Online pairing computations");
-    leave_block("Call to r1cs_ppzksnark_online_verifier_weak_IC");
 
     return result;
 }
@@ -716,9 +779,8 @@ bool r1cs_ppzksnark_affine_verifier_weak_IC(const r1cs_ppzksnark_verification_ke
     affine_ate_G2_precomp<ppT> pvk_vk_gamma_beta_g2_precomp = ppT::affine_ate_precompute_G2(vk.gamma_beta_g2);
 
     enter_block("Compute input-dependent part of A");
-    const accumulation_vector<G1<ppT> > accumulated_IC = vk.encoded_IC_query.template accumulate_chunk<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
-    assert(accumulated_IC.is_fully_accumulated());
-    const G1<ppT> &acc = accumulated_IC.first;
+    assert(vk.encoded_IC_query.rest.find_range(0, primary_input.size()).second == vk.encoded_IC_query.rest.size()); // i.e., fully accumulated below
+    const G1<ppT> acc = vk.encoded_IC_query.template accumulate_chunk_value<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
     leave_block("Compute input-dependent part of A");
 
     bool result = true;
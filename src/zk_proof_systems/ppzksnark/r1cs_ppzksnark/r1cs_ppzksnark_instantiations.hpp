@@ -0,0 +1,92 @@
+/** @file
+ *****************************************************************************
+
+ Explicit instantiations of the R1CS ppzkSNARK algorithms for the curves
+ compiled into libsnark: alt_bn128, edwards, mnt4 and mnt6 (and bn128, when
+ CURVE=BN128). These include default_ec_pp, whichever curve it is.
+
+ The instantiations are compiled once, in r1cs_ppzksnark_instantiations.cpp.
+ This header declares them extern. It is opt-in: r1cs_ppzksnark.hpp does not
+ include it. A translation unit that includes it links against the library
+ instead of re-instantiating the generator, prover and verifiers (and, with
+ them, the QAP reduction and multi-exponentiation code), which saves most of
+ its compile time. It then runs the library's code, so it must be compiled
+ with the same flags (CURVE, MULTICORE, DEBUG, etc.) as libsnark, as the
+ in-tree tests and profilers that include it are. Translation units that do
+ not include it, and all other ppT, instantiate implicitly, as before.
+
+ Define NO_EXPLICIT_INSTANTIATION (make NO_EXPLICIT_INSTANTIATION=1) to
+ instantiate everything implicitly, e.g. when using the headers without
+ linking against libsnark.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef R1CS_PPZKSNARK_INSTANTIATIONS_HPP_
+#define R1CS_PPZKSNARK_INSTANTIATIONS_HPP_
+
+#include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.hpp"
+
+#ifndef NO_EXPLICIT_INSTANTIATION
+
+#include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "algebra/curves/edwards/edwards_pp.hpp"
+#include "algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#ifdef CURVE_BN128
+#include "algebra/curves/bn128/bn128_pp.hpp"
+#endif
+
+/*
+ Expands to explicit instantiation declarations (EXTERN = extern) or
+ definitions (EXTERN empty) of the main algorithms for ppT.
+ */
+#define R1CS_PPZKSNARK_INSTANTIATE(EXTERN, ppT)                                                                             \
+    EXTERN template r1cs_ppzksnark_keypair<ppT> r1cs_ppzksnark_generator<ppT>(const r1cs_ppzksnark_constraint_system<ppT> &); \
+    EXTERN template r1cs_ppzksnark_proof<ppT> r1cs_ppzksnark_prover<ppT>(const r1cs_ppzksnark_proving_key<ppT> &,          \
+                                                                         const r1cs_ppzksnark_primary_input<ppT> &,        \
+                                                                         const r1cs_ppzksnark_auxiliary_input<ppT> &);     \
+    EXTERN template bool r1cs_ppzksnark_verifier_weak_IC<ppT>(const r1cs_ppzksnark_verification_key<ppT> &,               \
+                                                              const r1cs_ppzksnark_primary_input<ppT> &,                   \
+                                                              const r1cs_ppzksnark_proof<ppT> &);                          \
+    EXTERN template bool r1cs_ppzksnark_verifier_strong_IC<ppT>(const r1cs_ppzksnark_verification_key<ppT> &,             \
+                                                                const r1cs_ppzksnark_primary_input<ppT> &,                 \
+                                                                const r1cs_ppzksnark_proof<ppT> &);                        \
+    EXTERN template r1cs_ppzksnark_processed_verification_key<ppT>                                                         \
+        r1cs_ppzksnark_verifier_process_vk<ppT>(const r1cs_ppzksnark_verification_key<ppT> &);                            \
+    EXTERN template bool r1cs_ppzksnark_online_verifier_weak_IC<ppT>(const r1cs_ppzksnark_processed_verification_key<ppT> &, \
+                                                                     const r1cs_ppzksnark_primary_input<ppT> &,            \
+                                                                     const r1cs_ppzksnark_proof<ppT> &);                   \
+    EXTERN template bool r1cs_ppzksnark_online_verifier_strong_IC<ppT>(const r1cs_ppzksnark_processed_verification_key<ppT> &, \
+                                                                       const r1cs_ppzksnark_primary_input<ppT> &,          \
+                                                                       const r1cs_ppzksnark_proof<ppT> &);                 \
+    EXTERN template bool r1cs_ppzksnark_online_verifier_accumulated_IC<ppT>(const r1cs_ppzksnark_processed_verification_key<ppT> &, \
+                                                                            const G1<ppT> &,                               \
+                                                                            const r1cs_ppzksnark_proof<ppT> &);
+
+/* the affine verifier needs affine ate pairings, which only the MNT curves provide */
+#define R1CS_PPZKSNARK_INSTANTIATE_AFFINE_VERIFIER(EXTERN, ppT)                                                           \
+    EXTERN template bool r1cs_ppzksnark_affine_verifier_weak_IC<ppT>(const r1cs_ppzksnark_verification_key<ppT> &,        \
+                                                                     const r1cs_ppzksnark_primary_input<ppT> &,            \
+                                                                     const r1cs_ppzksnark_proof<ppT> &);
+
+namespace libsnark {
+
+R1CS_PPZKSNARK_INSTANTIATE(extern, alt_bn128_pp)
+R1CS_PPZKSNARK_INSTANTIATE(extern, edwards_pp)
+R1CS_PPZKSNARK_INSTANTIATE(extern, mnt4_pp)
+R1CS_PPZKSNARK_INSTANTIATE(extern, mnt6_pp)
+R1CS_PPZKSNARK_INSTANTIATE_AFFINE_VERIFIER(extern, mnt4_pp)
+R1CS_PPZKSNARK_INSTANTIATE_AFFINE_VERIFIER(extern, mnt6_pp)
+#ifdef CURVE_BN128
+R1CS_PPZKSNARK_INSTANTIATE(extern, bn128_pp)
+#endif
+
+} // libsnark
+
+#endif // NO_EXPLICIT_INSTANTIATION
+
+#endif // R1CS_PPZKSNARK_INSTANTIATIONS_HPP_
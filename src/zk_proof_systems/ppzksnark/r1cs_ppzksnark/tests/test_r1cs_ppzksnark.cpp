@@ -13,9 +13,11 @@
 
 #include "common/default_types/r1cs_ppzksnark_pp.hpp"
 #include "common/profiling.hpp"
+#include "common/prover_config.hpp"
 #include "common/utils.hpp"
 #include "relations/constraint_satisfaction_problems/r1cs/examples/r1cs_examples.hpp"
 #include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/examples/run_r1cs_ppzksnark.hpp"
+#include "zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark_instantiations.hpp"
 
 using namespace libsnark;
 
@@ -30,6 +32,17 @@ void test_r1cs_ppzksnark(size_t num_constraints,
     const bool bit = run_r1cs_ppzksnark<ppT>(example, test_serialization);
     assert(bit);
 
+    /* the same sizes, with denser constraints spread over several layers */
+    r1cs_example<Fr<ppT> > dense_example = generate_r1cs_example_with_density<Fr<ppT> >(num_constraints, input_size, 4, 64);
+    const bool dense_bit = run_r1cs_ppzksnark<ppT>(dense_example, test_serialization);
+    assert(dense_bit);
+
+    /* a memory budget small enough to shrink the fixed-base windows and to switch multi_exp to the bucket method */
+    set_prover_config(prover_config(1ul << 19));
+    const bool budget_bit = run_r1cs_ppzksnark<ppT>(example, test_serialization);
+    assert(budget_bit);
+    set_prover_config(prover_config());
+
     print_header("(leave) Test R1CS ppzkSNARK");
 }
 
@@ -51,11 +51,20 @@ bool run_ram_ppzksnark(const ram_example<ram_ppzksnark_machine_pp<ram_ppzksnark_
     ram_ppzksnark_keypair<ram_ppzksnark_ppT> keypair = ram_ppzksnark_generator<ram_ppzksnark_ppT>(example.ap, example.boot_trace_size_bound, example.time_bound);
     printf("\n"); print_indent(); print_mem("after generator");
 
+    print_header("Preprocess verification key");
+    ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> pvk = ram_ppzksnark_verifier_process_vk<ram_ppzksnark_ppT>(keypair.vk);
+
     if (test_serialization)
     {
         enter_block("Test serialization of keys");
         keypair.pk = reserialize<ram_ppzksnark_proving_key<ram_ppzksnark_ppT> >(keypair.pk);
         keypair.vk = reserialize<ram_ppzksnark_verification_key<ram_ppzksnark_ppT> >(keypair.vk);
+        pvk = reserialize<ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> >(pvk);
+
+        /* the locations bound so far must survive, as binding them twice is an error */
+        const ram_ppzksnark_verification_key<ram_ppzksnark_ppT> bound_vk = keypair.vk.bind_primary_input(example.boot_trace);
+        const ram_ppzksnark_verification_key<ram_ppzksnark_ppT> reserialized_bound_vk = reserialize<ram_ppzksnark_verification_key<ram_ppzksnark_ppT> >(bound_vk);
+        assert(reserialized_bound_vk.bound_primary_input_locations == bound_vk.bound_primary_input_locations);
         leave_block("Test serialization of keys");
     }
 
@@ -75,6 +84,10 @@ bool run_ram_ppzksnark(const ram_example<ram_ppzksnark_machine_pp<ram_ppzksnark_
     printf("\n"); print_indent(); print_mem("after verifier");
     printf("* The verification result is: %s\n", (ans ? "PASS" : "FAIL"));
 
+    print_header("RAM ppzkSNARK Online Verifier");
+    const bool ans2 = ram_ppzksnark_online_verifier<ram_ppzksnark_ppT>(pvk, example.boot_trace, proof);
+    assert(ans == ans2);
+
     leave_block("Call to run_ram_ppzksnark");
 
     return ans;
@@ -6,11 +6,13 @@
  This includes:
  - the class for a proving key;
  - the class for a verification key;
+ - the class for a processed verification key;
  - the class for a key pair (proving key & verification key);
  - the class for a proof;
  - the generator algorithm;
  - the prover algorithm;
- - the verifier algorithm.
+ - the verifier algorithm;
+ - the online verifier algorithm.
 
  The implementation follows, extends, and optimizes the approach described
  in \[BCTV14] (itself building on \[BCGTV13]). In particular, the ppzkSNARK
@@ -148,6 +150,45 @@ public:
 };
 
 
+/************************ Processed verification key *************************/
+
+template<typename ram_ppzksnark_ppT>
+class ram_ppzksnark_processed_verification_key;
+
+template<typename ram_ppzksnark_ppT>
+std::ostream& operator<<(std::ostream &out, const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk);
+
+template<typename ram_ppzksnark_ppT>
+std::istream& operator>>(std::istream &in, ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk);
+
+/**
+ * A processed verification key for the RAM ppzkSNARK.
+ *
+ * It holds the processed verification key of the underlying R1CS ppzkSNARK (with
+ * the pairing pre-computations for the fixed G1/G2 elements), so that verifying
+ * many proofs for the same architecture and bounds does not redo them. Primary
+ * inputs are bound to a copy of the IC query during each verification, so the
+ * processed verification key itself is never modified and can be shared
+ * read-only across threads (with inhibit_profiling_counters set).
+ */
+template<typename ram_ppzksnark_ppT>
+class ram_ppzksnark_processed_verification_key {
+public:
+    typedef ram_ppzksnark_snark_pp<ram_ppzksnark_ppT> snark_ppT;
+
+    r1cs_ppzksnark_processed_verification_key<snark_ppT> r1cs_pvk;
+    ram_ppzksnark_architecture_params<ram_ppzksnark_ppT> ap;
+    size_t primary_input_size_bound;
+    size_t time_bound;
+
+    std::set<size_t> bound_primary_input_locations;
+
+    bool operator==(const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &other) const;
+    friend std::ostream& operator<< <ram_ppzksnark_ppT>(std::ostream &out, const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk);
+    friend std::istream& operator>> <ram_ppzksnark_ppT>(std::istream &in, ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk);
+};
+
+
 /********************************** Key pair *********************************/
 
 /**
@@ -220,6 +261,20 @@ bool ram_ppzksnark_verifier(const ram_ppzksnark_verification_key<ram_ppzksnark_p
                             const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
                             const ram_ppzksnark_proof<ram_ppzksnark_ppT> &proof);
 
+/**
+ * Convert a (non-processed) verification key into a processed verification key.
+ */
+template<typename ram_ppzksnark_ppT>
+ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> ram_ppzksnark_verifier_process_vk(const ram_ppzksnark_verification_key<ram_ppzksnark_ppT> &vk);
+
+/**
+ * A verifier algorithm for the RAM ppzkSNARK that accepts a processed verification key.
+ */
+template<typename ram_ppzksnark_ppT>
+bool ram_ppzksnark_online_verifier(const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk,
+                                   const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
+                                   const ram_ppzksnark_proof<ram_ppzksnark_ppT> &proof);
+
 } // libsnark
 
 #include "zk_proof_systems/ppzksnark/ram_ppzksnark/ram_ppzksnark.tcc"
@@ -52,32 +52,72 @@ std::istream& operator>>(std::istream &in, ram_ppzksnark_proving_key<ram_ppzksna
     return in;
 }
 
+/**
+ * Return the (offset, scalars) chunks of the IC query of the underlying R1CS
+ * ppzkSNARK that bind the given primary input, one per trace entry. None of
+ * its locations may be in bound_primary_input_locations already.
+ */
 template<typename ram_ppzksnark_ppT>
-ram_ppzksnark_verification_key<ram_ppzksnark_ppT> ram_ppzksnark_verification_key<ram_ppzksnark_ppT>::bind_primary_input(const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input) const
+std::vector<std::pair<size_t, std::vector<ram_base_field<ram_ppzksnark_machine_pp<ram_ppzksnark_ppT> > > > >
+ram_ppzksnark_primary_input_IC_chunks(const ram_ppzksnark_architecture_params<ram_ppzksnark_ppT> &ap,
+                                      const size_t primary_input_size_bound,
+                                      const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
+                                      const std::set<size_t> &bound_primary_input_locations)
 {
     typedef ram_ppzksnark_machine_pp<ram_ppzksnark_ppT> ram_ppT;
     typedef ram_base_field<ram_ppT> FieldT;
 
-    enter_block("Call to ram_ppzksnark_verification_key::bind_primary_input");
-    ram_ppzksnark_verification_key<ram_ppzksnark_ppT> result(*this);
-
     const size_t packed_input_element_size = ram_universal_gadget<ram_ppT>::packed_input_element_size(ap);
 
+    std::vector<std::pair<size_t, std::vector<FieldT> > > chunks;
     for (auto it : primary_input.get_all_trace_entries())
     {
         const size_t input_pos = it.first;
         const address_and_value av = it.second;
 
         assert(input_pos < primary_input_size_bound);
-        assert(result.bound_primary_input_locations.find(input_pos) == result.bound_primary_input_locations.end());
+        assert(bound_primary_input_locations.find(input_pos) == bound_primary_input_locations.end());
 
-        const std::vector<FieldT> packed_input_element = ram_to_r1cs<ram_ppT>::pack_primary_input_address_and_value(ap, av);
-        result.r1cs_vk.encoded_IC_query = result.r1cs_vk.encoded_IC_query.template accumulate_chunk<FieldT>(packed_input_element.begin(), packed_input_element.end(), packed_input_element_size * (primary_input_size_bound - 1 - input_pos));
+        chunks.emplace_back(packed_input_element_size * (primary_input_size_bound - 1 - input_pos),
+                            ram_to_r1cs<ram_ppT>::pack_primary_input_address_and_value(ap, av));
+    }
+
+    return chunks;
+}
 
-        result.bound_primary_input_locations.insert(input_pos);
+/**
+ * Bind the given primary input to an IC query of the underlying R1CS ppzkSNARK,
+ * recording the bound locations in bound_primary_input_locations.
+ */
+template<typename ram_ppzksnark_ppT>
+void ram_ppzksnark_bind_primary_input_to_IC(const ram_ppzksnark_architecture_params<ram_ppzksnark_ppT> &ap,
+                                            const size_t primary_input_size_bound,
+                                            const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
+                                            accumulation_vector<G1<ram_ppzksnark_snark_pp<ram_ppzksnark_ppT> > > &encoded_IC_query,
+                                            std::set<size_t> &bound_primary_input_locations)
+{
+    typedef ram_base_field<ram_ppzksnark_machine_pp<ram_ppzksnark_ppT> > FieldT;
+
+    /* bind all entries at once: a single multi-exponentiation, and a single copy of the rest of the IC query */
+    const std::vector<std::pair<size_t, std::vector<FieldT> > > chunks =
+        ram_ppzksnark_primary_input_IC_chunks<ram_ppzksnark_ppT>(ap, primary_input_size_bound, primary_input, bound_primary_input_locations);
+    encoded_IC_query = encoded_IC_query.template accumulate_chunks<FieldT>(chunks);
+
+    for (auto it : primary_input.get_all_trace_entries())
+    {
+        bound_primary_input_locations.insert(it.first);
     }
+}
 
+template<typename ram_ppzksnark_ppT>
+ram_ppzksnark_verification_key<ram_ppzksnark_ppT> ram_ppzksnark_verification_key<ram_ppzksnark_ppT>::bind_primary_input(const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input) const
+{
+    enter_block("Call to ram_ppzksnark_verification_key::bind_primary_input");
+    ram_ppzksnark_verification_key<ram_ppzksnark_ppT> result(*this);
+    ram_ppzksnark_bind_primary_input_to_IC<ram_ppzksnark_ppT>(ap, primary_input_size_bound, primary_input,
+                                                              result.r1cs_vk.encoded_IC_query, result.bound_primary_input_locations);
     leave_block("Call to ram_ppzksnark_verification_key::bind_primary_input");
+
     return result;
 }
 
@@ -87,7 +127,8 @@ bool ram_ppzksnark_verification_key<ram_ppzksnark_ppT>::operator==(const ram_ppz
     return (this->r1cs_vk == other.r1cs_vk &&
             this->ap == other.ap &&
             this->primary_input_size_bound == other.primary_input_size_bound &&
-            this->time_bound == other.time_bound);
+            this->time_bound == other.time_bound &&
+            this->bound_primary_input_locations == other.bound_primary_input_locations);
 }
 
 template<typename ram_ppzksnark_ppT>
@@ -97,6 +138,7 @@ std::ostream& operator<<(std::ostream &out, const ram_ppzksnark_verification_key
     out << vk.ap;
     out << vk.primary_input_size_bound << "\n";
     out << vk.time_bound << "\n";
+    out << vk.bound_primary_input_locations;
 
     return out;
 }
@@ -110,6 +152,43 @@ std::istream& operator>>(std::istream &in, ram_ppzksnark_verification_key<ram_pp
     consume_newline(in);
     in >> vk.time_bound;
     consume_newline(in);
+    in >> vk.bound_primary_input_locations;
+
+    return in;
+}
+
+template<typename ram_ppzksnark_ppT>
+bool ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT>::operator==(const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &other) const
+{
+    return (this->r1cs_pvk == other.r1cs_pvk &&
+            this->ap == other.ap &&
+            this->primary_input_size_bound == other.primary_input_size_bound &&
+            this->time_bound == other.time_bound &&
+            this->bound_primary_input_locations == other.bound_primary_input_locations);
+}
+
+template<typename ram_ppzksnark_ppT>
+std::ostream& operator<<(std::ostream &out, const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk)
+{
+    out << pvk.r1cs_pvk;
+    out << pvk.ap;
+    out << pvk.primary_input_size_bound << "\n";
+    out << pvk.time_bound << "\n";
+    out << pvk.bound_primary_input_locations;
+
+    return out;
+}
+
+template<typename ram_ppzksnark_ppT>
+std::istream& operator>>(std::istream &in, ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk)
+{
+    in >> pvk.r1cs_pvk;
+    in >> pvk.ap;
+    in >> pvk.primary_input_size_bound;
+    consume_newline(in);
+    in >> pvk.time_bound;
+    consume_newline(in);
+    in >> pvk.bound_primary_input_locations;
 
     return in;
 }
@@ -125,7 +204,7 @@ ram_ppzksnark_keypair<ram_ppzksnark_ppT> ram_ppzksnark_generator(const ram_ppzks
     enter_block("Call to ram_ppzksnark_generator");
     ram_to_r1cs<ram_ppT> universal_r1cs(ap, primary_input_size_bound, time_bound);
     universal_r1cs.instance_map();
-    r1cs_ppzksnark_keypair<snark_ppT> ppzksnark_keypair = r1cs_ppzksnark_generator<snark_ppT>(universal_r1cs.get_constraint_system());
+    r1cs_ppzksnark_keypair<snark_ppT> ppzksnark_keypair = r1cs_ppzksnark_generator<snark_ppT>(universal_r1cs.release_constraint_system());
     leave_block("Call to ram_ppzksnark_generator");
 
     ram_ppzksnark_proving_key<ram_ppzksnark_ppT> pk = ram_ppzksnark_proving_key<ram_ppzksnark_ppT>(std::move(ppzksnark_keypair.pk), ap, primary_input_size_bound, time_bound);
@@ -163,16 +242,53 @@ bool ram_ppzksnark_verifier(const ram_ppzksnark_verification_key<ram_ppzksnark_p
                             const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
                             const ram_ppzksnark_proof<ram_ppzksnark_ppT> &proof)
 {
-    typedef ram_ppzksnark_snark_pp<ram_ppzksnark_ppT> snark_ppT;
-
     enter_block("Call to ram_ppzksnark_verifier");
-    const ram_ppzksnark_verification_key<ram_ppzksnark_ppT> input_specific_vk = vk.bind_primary_input(primary_input);
-    const bool ans = r1cs_ppzksnark_verifier_weak_IC<snark_ppT>(input_specific_vk.r1cs_vk, r1cs_primary_input<Fr<snark_ppT> >(), proof);
+    const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> pvk = ram_ppzksnark_verifier_process_vk<ram_ppzksnark_ppT>(vk);
+    const bool ans = ram_ppzksnark_online_verifier<ram_ppzksnark_ppT>(pvk, primary_input, proof);
     leave_block("Call to ram_ppzksnark_verifier");
 
     return ans;
 }
 
+template<typename ram_ppzksnark_ppT>
+ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> ram_ppzksnark_verifier_process_vk(const ram_ppzksnark_verification_key<ram_ppzksnark_ppT> &vk)
+{
+    typedef ram_ppzksnark_snark_pp<ram_ppzksnark_ppT> snark_ppT;
+
+    enter_block("Call to ram_ppzksnark_verifier_process_vk");
+    ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> pvk;
+    pvk.r1cs_pvk = r1cs_ppzksnark_verifier_process_vk<snark_ppT>(vk.r1cs_vk);
+    pvk.ap = vk.ap;
+    pvk.primary_input_size_bound = vk.primary_input_size_bound;
+    pvk.time_bound = vk.time_bound;
+    pvk.bound_primary_input_locations = vk.bound_primary_input_locations;
+    leave_block("Call to ram_ppzksnark_verifier_process_vk");
+
+    return pvk;
+}
+
+template<typename ram_ppzksnark_ppT>
+bool ram_ppzksnark_online_verifier(const ram_ppzksnark_processed_verification_key<ram_ppzksnark_ppT> &pvk,
+                                   const ram_ppzksnark_primary_input<ram_ppzksnark_ppT> &primary_input,
+                                   const ram_ppzksnark_proof<ram_ppzksnark_ppT> &proof)
+{
+    typedef ram_ppzksnark_snark_pp<ram_ppzksnark_ppT> snark_ppT;
+    typedef ram_base_field<ram_ppzksnark_machine_pp<ram_ppzksnark_ppT> > FieldT;
+
+    enter_block("Call to ram_ppzksnark_online_verifier");
+    enter_block("Bind primary input to IC query");
+    /* only the accumulated value is needed, so neither the IC query nor the bound locations are copied */
+    const std::vector<std::pair<size_t, std::vector<FieldT> > > chunks =
+        ram_ppzksnark_primary_input_IC_chunks<ram_ppzksnark_ppT>(pvk.ap, pvk.primary_input_size_bound, primary_input, pvk.bound_primary_input_locations);
+    const G1<snark_ppT> accumulated_IC = pvk.r1cs_pvk.encoded_IC_query.template accumulate_chunks_value<FieldT>(chunks);
+    leave_block("Bind primary input to IC query");
+
+    const bool ans = r1cs_ppzksnark_online_verifier_accumulated_IC<snark_ppT>(pvk.r1cs_pvk, accumulated_IC, proof);
+    leave_block("Call to ram_ppzksnark_online_verifier");
+
+    return ans;
+}
+
 } // libsnark
 
 #endif // RAM_PPZKSNARK_TCC_
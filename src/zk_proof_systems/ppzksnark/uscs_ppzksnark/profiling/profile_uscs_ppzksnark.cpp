@@ -31,6 +31,7 @@
 #include "common/utils.hpp"
 #include "relations/constraint_satisfaction_problems/uscs/examples/uscs_examples.hpp"
 #include "zk_proof_systems/ppzksnark/uscs_ppzksnark/examples/run_uscs_ppzksnark.hpp"
+#include "zk_proof_systems/ppzksnark/uscs_ppzksnark/uscs_ppzksnark_instantiations.hpp"
 
 using namespace libsnark;
 
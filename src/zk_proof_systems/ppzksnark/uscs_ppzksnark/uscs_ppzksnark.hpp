@@ -192,6 +192,12 @@ public:
         print_indent(); printf("* VK size in bits: %zu\n", this->size_in_bits());
     }
 
+    /**
+     * Check that all elements lie on the curve and in the right subgroup.
+     * Deserialization runs this check, and fails the stream when it does not hold.
+     */
+    bool is_well_formed() const;
+
     bool operator==(const uscs_ppzksnark_verification_key<ppT> &other) const;
     friend std::ostream& operator<< <ppT>(std::ostream &out, const uscs_ppzksnark_verification_key<ppT> &vk);
     friend std::istream& operator>> <ppT>(std::istream &in, uscs_ppzksnark_verification_key<ppT> &vk);
@@ -217,6 +223,10 @@ std::istream& operator>>(std::istream &in, uscs_ppzksnark_processed_verification
  * Compared to a (non-processed) verification key, a processed verification key
  * contains a small constant amount of additional pre-computed information that
  * enables a faster verification time.
+ *
+ * As in the R1CS ppzkSNARK, the online verifiers leave the processed verification
+ * key untouched, so it may be shared by concurrent verifications (with
+ * inhibit_profiling_counters set).
  */
 template<typename ppT>
 class uscs_ppzksnark_processed_verification_key {
@@ -324,12 +334,15 @@ public:
         print_indent(); printf("* Proof size in bits: %zu\n", this->size_in_bits());
     }
 
+    /**
+     * Check that all elements lie on the curve and in the right subgroup (in
+     * parallel across elements); the online verifiers reject proofs that fail it,
+     * and deserialization fails the stream for them.
+     */
     bool is_well_formed() const
     {
-        return (V_g1.is_well_formed() &&
-                alpha_V_g1.is_well_formed() &&
-                H_g1.is_well_formed() &&
-                V_g2.is_well_formed());
+        return (batch_is_valid<G1<ppT> >({ V_g1, alpha_V_g1, H_g1 }) &&
+                batch_is_valid<G2<ppT> >({ V_g2 }));
     }
 
     bool operator==(const uscs_ppzksnark_proof<ppT> &other) const;
@@ -348,6 +361,14 @@ public:
 template<typename ppT>
 uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator(const uscs_ppzksnark_constraint_system<ppT> &cs);
 
+/**
+ * Returns an estimate of the peak memory (in bytes) of uscs_ppzksnark_prover
+ * for the proving key pk, under the active prover configuration (see
+ * common/prover_config.hpp), including the proving key itself.
+ */
+template<typename ppT>
+size_t uscs_ppzksnark_prover_peak_memory(const uscs_ppzksnark_proving_key<ppT> &pk);
+
 /**
  * A prover algorithm for the USCS ppzkSNARK.
  *
@@ -20,7 +20,9 @@
 
 #include "reductions/uscs_to_ssp/uscs_to_ssp.hpp"
 #include "common/profiling.hpp"
+#include "common/prover_config.hpp"
 #include "common/utils.hpp"
+#include "algebra/fields/field_utils.hpp"
 #include "algebra/scalar_multiplication/multiexp.hpp"
 #include "relations/arithmetic_programs/ssp/ssp.hpp"
 
@@ -60,6 +62,14 @@ std::istream& operator>>(std::istream &in, uscs_ppzksnark_proving_key<ppT> &pk)
     return in;
 }
 
+template<typename ppT>
+bool uscs_ppzksnark_verification_key<ppT>::is_well_formed() const
+{
+    return (batch_is_valid<G1<ppT> >({ this->encoded_IC_query.first }) &&
+            batch_is_valid<G1<ppT> >(this->encoded_IC_query.rest.values) &&
+            batch_is_valid<G2<ppT> >({ this->tilde_g2, this->alpha_tilde_g2, this->Z_g2 }));
+}
+
 template<typename ppT>
 bool uscs_ppzksnark_verification_key<ppT>::operator==(const uscs_ppzksnark_verification_key<ppT> &other) const
 {
@@ -92,6 +102,11 @@ std::istream& operator>>(std::istream &in, uscs_ppzksnark_verification_key<ppT>
     in >> vk.encoded_IC_query;
     consume_OUTPUT_NEWLINE(in);
 
+    if (!vk.is_well_formed())
+    {
+        in.setstate(std::ios_base::failbit);
+    }
+
     return in;
 }
 
@@ -174,6 +189,11 @@ std::istream& operator>>(std::istream &in, uscs_ppzksnark_proof<ppT> &proof)
     in >> proof.V_g2;
     consume_OUTPUT_NEWLINE(in);
 
+    if (!proof.is_well_formed())
+    {
+        in.setstate(std::ios_base::failbit);
+    }
+
     return in;
 }
 
@@ -202,9 +222,10 @@ uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator(const uscs_ppzksnark_constr
 {
     enter_block("Call to uscs_ppzksnark_generator");
 
-    /* draw random element at which the SSP is evaluated */
+    /* draw, at once, the random element at which the SSP is evaluated and the other secrets of the generator */
 
-    const  Fr<ppT> t = Fr<ppT>::random_element();
+    const Fr_vector<ppT> secrets = random_field_elements<Fr<ppT> >(3);
+    const  Fr<ppT> t = secrets[0];
 
     /* perform USCS-to-SSP reduction */
 
@@ -237,18 +258,27 @@ uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator(const uscs_ppzksnark_constr
         assert(!Xt_table[i].is_zero());
     }
 
-    const Fr<ppT> alpha = Fr<ppT>::random_element();
+    const Fr<ppT> alpha = secrets[1];
 
     enter_block("Generate USCS proving key");
 
     const size_t g1_exp_count = Vt_table.size() + Vt_table_minus_Xt_table.size() + Ht_table.size();
     const size_t g2_exp_count = Vt_table_minus_Xt_table.size();
 
-    size_t g1_window = get_exp_window_size<G1<ppT> >(g1_exp_count);
-    size_t g2_window = get_exp_window_size<G2<ppT> >(g2_exp_count);
+    /* the fixed-base tables share the memory left once the key and the evaluations are in place */
+    const size_t key_bytes = g1_exp_count * sizeof(G1<ppT>) + g2_exp_count * sizeof(G2<ppT>);
+    const size_t evaluations_bytes = (Vt_table.size() + Vt_table_minus_Xt_table.size() + Ht_table.size()) * sizeof(Fr<ppT>);
+    const size_t table_budget = active_prover_config.available_memory(key_bytes + evaluations_bytes) / 2;
+
+    size_t g1_window = fit_window_size<G1<ppT> >(Fr<ppT>::size_in_bits(), get_exp_window_size<G1<ppT> >(g1_exp_count), table_budget);
+    size_t g2_window = fit_window_size<G2<ppT> >(Fr<ppT>::size_in_bits(), get_exp_window_size<G2<ppT> >(g2_exp_count), table_budget);
 
     print_indent(); printf("* G1 window: %zu\n", g1_window);
     print_indent(); printf("* G2 window: %zu\n", g2_window);
+    active_prover_config.print();
+    print_memory_estimate("Predicted peak memory", key_bytes + evaluations_bytes +
+                          window_table_size_in_bytes<G1<ppT> >(Fr<ppT>::size_in_bits(), g1_window) +
+                          window_table_size_in_bytes<G2<ppT> >(Fr<ppT>::size_in_bits(), g2_window));
 
     enter_block("Generating G1 multiexp table");
     window_table<G1<ppT> > g1_table = get_window_table(Fr<ppT>::size_in_bits(), g1_window, G1<ppT>::one());
@@ -282,7 +312,7 @@ uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator(const uscs_ppzksnark_constr
 
     enter_block("Generate USCS verification key");
 
-    const Fr<ppT> tilde    = Fr<ppT>::random_element();
+    const Fr<ppT> tilde    = secrets[2];
     G2<ppT> tilde_g2       = tilde * G2<ppT>::one();
     G2<ppT> alpha_tilde_g2 = (alpha * tilde) * G2<ppT>::one();
     G2<ppT> Z_g2           = ssp_inst.Zt * G2<ppT>::one();
@@ -316,6 +346,25 @@ uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator(const uscs_ppzksnark_constr
     return uscs_ppzksnark_keypair<ppT>(std::move(pk), std::move(vk));
 }
 
+template<typename ppT>
+size_t uscs_ppzksnark_prover_peak_memory(const uscs_ppzksnark_proving_key<ppT> &pk)
+{
+    const size_t num_variables = pk.constraint_system.num_variables();
+    const size_t degree = pk.H_g1_query.size() - 1;
+
+    /* the SSP witness, and the evaluations of V (and an FFT scratch copy) while it is computed */
+    const size_t witness_bytes = (num_variables + degree + 1) * sizeof(Fr<ppT>);
+    const size_t witness_map_bytes = (active_prover_config.fits_scratch_budget(degree * sizeof(Fr<ppT>)) ? 3 : 2) * degree * sizeof(Fr<ppT>);
+
+    /* the largest multi-exponentiation: multi_exp_with_mixed_addition copies the terms it passes to multi_exp */
+    const size_t V_g1_bytes = pk.V_g1_query.size() * (sizeof(G1<ppT>) + sizeof(Fr<ppT>)) +
+        multi_exp_scratch_size_in_bytes<G1<ppT>, Fr<ppT> >(pk.V_g1_query.size());
+    const size_t H_bytes = multi_exp_scratch_size_in_bytes<G1<ppT>, Fr<ppT> >(pk.H_g1_query.size());
+    const size_t V_g2_bytes = multi_exp_scratch_size_in_bytes<G2<ppT>, Fr<ppT> >(pk.V_g2_query.size());
+
+    return pk.size_in_bits() / 8 + witness_bytes + std::max(witness_map_bytes, std::max(V_g1_bytes, std::max(H_bytes, V_g2_bytes)));
+}
+
 template <typename ppT>
 uscs_ppzksnark_proof<ppT> uscs_ppzksnark_prover(const uscs_ppzksnark_proving_key<ppT> &pk,
                                                 const uscs_ppzksnark_primary_input<ppT> &primary_input,
@@ -347,11 +396,9 @@ uscs_ppzksnark_proof<ppT> uscs_ppzksnark_prover(const uscs_ppzksnark_proving_key
     G1<ppT> H_g1       = G1<ppT>::zero();
     G2<ppT> V_g2       = pk.V_g2_query[0]+ssp_wit.d*pk.V_g2_query[pk.V_g2_query.size()-1];
 
-#ifdef MULTICORE
-    const size_t chunks = 4; //omp_get_max_threads();
-#else
-    const size_t chunks = 1;
-#endif
+    const size_t chunks = active_prover_config.multiexp_chunks();
+    active_prover_config.print();
+    print_memory_estimate("Predicted peak memory", uscs_ppzksnark_prover_peak_memory<ppT>(pk));
 
     // MAYBE LATER: do queries 1,2,4 at once for slightly better speed
 
@@ -404,11 +451,11 @@ uscs_ppzksnark_processed_verification_key<ppT> uscs_ppzksnark_verifier_process_v
     uscs_ppzksnark_processed_verification_key<ppT> pvk;
 
     pvk.pp_G1_one_precomp         = ppT::precompute_G1(G1<ppT>::one());
-    pvk.pp_G2_one_precomp         = ppT::precompute_G2(G2<ppT>::one());
+    pvk.pp_G2_one_precomp         = ppT::precompute_G2_for_reuse(G2<ppT>::one());
 
-    pvk.vk_tilde_g2_precomp       = ppT::precompute_G2(vk.tilde_g2);
-    pvk.vk_alpha_tilde_g2_precomp = ppT::precompute_G2(vk.alpha_tilde_g2);
-    pvk.vk_Z_g2_precomp           = ppT::precompute_G2(vk.Z_g2);
+    pvk.vk_tilde_g2_precomp       = ppT::precompute_G2_for_reuse(vk.tilde_g2);
+    pvk.vk_alpha_tilde_g2_precomp = ppT::precompute_G2_for_reuse(vk.alpha_tilde_g2);
+    pvk.vk_Z_g2_precomp           = ppT::precompute_G2_for_reuse(vk.Z_g2);
 
     pvk.pairing_of_g1_and_g2      = ppT::miller_loop(pvk.pp_G1_one_precomp,pvk.pp_G2_one_precomp);
 
@@ -428,9 +475,8 @@ bool uscs_ppzksnark_online_verifier_weak_IC(const uscs_ppzksnark_processed_verif
     assert(pvk.encoded_IC_query.domain_size() >= primary_input.size());
 
     enter_block("Compute input-dependent part of V");
-    const accumulation_vector<G1<ppT> > accumulated_IC = pvk.encoded_IC_query.template accumulate_chunk<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
-    assert(accumulated_IC.is_fully_accumulated());
-    const G1<ppT> &acc = accumulated_IC.first;
+    assert(pvk.encoded_IC_query.rest.find_range(0, primary_input.size()).second == pvk.encoded_IC_query.rest.size()); // i.e., fully accumulated below
+    const G1<ppT> acc = pvk.encoded_IC_query.template accumulate_chunk_value<Fr<ppT> >(primary_input.begin(), primary_input.end(), 0);
     leave_block("Compute input-dependent part of V");
 
     bool result = true;
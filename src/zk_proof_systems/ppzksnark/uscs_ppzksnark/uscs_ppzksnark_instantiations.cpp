@@ -0,0 +1,37 @@
+/** @file
+ *****************************************************************************
+
+ Explicit instantiations of the USCS ppzkSNARK algorithms.
+
+ See uscs_ppzksnark_instantiations.hpp .
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "algebra/curves/edwards/edwards_pp.hpp"
+#include "algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#ifdef CURVE_BN128
+#include "algebra/curves/bn128/bn128_pp.hpp"
+#endif
+#include "zk_proof_systems/ppzksnark/uscs_ppzksnark/uscs_ppzksnark_instantiations.hpp"
+
+#ifndef NO_EXPLICIT_INSTANTIATION
+
+namespace libsnark {
+
+USCS_PPZKSNARK_INSTANTIATE(, alt_bn128_pp)
+USCS_PPZKSNARK_INSTANTIATE(, edwards_pp)
+USCS_PPZKSNARK_INSTANTIATE(, mnt4_pp)
+USCS_PPZKSNARK_INSTANTIATE(, mnt6_pp)
+#ifdef CURVE_BN128
+USCS_PPZKSNARK_INSTANTIATE(, bn128_pp)
+#endif
+
+} // libsnark
+
+#endif // NO_EXPLICIT_INSTANTIATION
@@ -0,0 +1,71 @@
+/** @file
+ *****************************************************************************
+
+ Explicit instantiations of the USCS ppzkSNARK algorithms for the curves
+ compiled into libsnark, declared extern here and compiled once in
+ uscs_ppzksnark_instantiations.cpp. Like its R1CS counterpart, this header
+ is opt-in and needs the same compiler flags as libsnark.
+
+ See r1cs_ppzksnark_instantiations.hpp for the rationale and for
+ NO_EXPLICIT_INSTANTIATION.
+
+ *****************************************************************************
+ * @author     This file is part of libsnark, developed by SCIPR Lab
+ *             and contributors (see AUTHORS).
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+
+#ifndef USCS_PPZKSNARK_INSTANTIATIONS_HPP_
+#define USCS_PPZKSNARK_INSTANTIATIONS_HPP_
+
+#include "zk_proof_systems/ppzksnark/uscs_ppzksnark/uscs_ppzksnark.hpp"
+
+#ifndef NO_EXPLICIT_INSTANTIATION
+
+#include "algebra/curves/alt_bn128/alt_bn128_pp.hpp"
+#include "algebra/curves/edwards/edwards_pp.hpp"
+#include "algebra/curves/mnt/mnt4/mnt4_pp.hpp"
+#include "algebra/curves/mnt/mnt6/mnt6_pp.hpp"
+#ifdef CURVE_BN128
+#include "algebra/curves/bn128/bn128_pp.hpp"
+#endif
+
+/*
+ Expands to explicit instantiation declarations (EXTERN = extern) or
+ definitions (EXTERN empty) of the main algorithms for ppT.
+ */
+#define USCS_PPZKSNARK_INSTANTIATE(EXTERN, ppT)                                                                             \
+    EXTERN template uscs_ppzksnark_keypair<ppT> uscs_ppzksnark_generator<ppT>(const uscs_ppzksnark_constraint_system<ppT> &); \
+    EXTERN template uscs_ppzksnark_proof<ppT> uscs_ppzksnark_prover<ppT>(const uscs_ppzksnark_proving_key<ppT> &,          \
+                                                                         const uscs_ppzksnark_primary_input<ppT> &,        \
+                                                                         const uscs_ppzksnark_auxiliary_input<ppT> &);     \
+    EXTERN template bool uscs_ppzksnark_verifier_weak_IC<ppT>(const uscs_ppzksnark_verification_key<ppT> &,               \
+                                                              const uscs_ppzksnark_primary_input<ppT> &,                   \
+                                                              const uscs_ppzksnark_proof<ppT> &);                          \
+    EXTERN template bool uscs_ppzksnark_verifier_strong_IC<ppT>(const uscs_ppzksnark_verification_key<ppT> &,             \
+                                                                const uscs_ppzksnark_primary_input<ppT> &,                 \
+                                                                const uscs_ppzksnark_proof<ppT> &);                        \
+    EXTERN template uscs_ppzksnark_processed_verification_key<ppT>                                                         \
+        uscs_ppzksnark_verifier_process_vk<ppT>(const uscs_ppzksnark_verification_key<ppT> &);                            \
+    EXTERN template bool uscs_ppzksnark_online_verifier_weak_IC<ppT>(const uscs_ppzksnark_processed_verification_key<ppT> &, \
+                                                                     const uscs_ppzksnark_primary_input<ppT> &,            \
+                                                                     const uscs_ppzksnark_proof<ppT> &);                   \
+    EXTERN template bool uscs_ppzksnark_online_verifier_strong_IC<ppT>(const uscs_ppzksnark_processed_verification_key<ppT> &, \
+                                                                       const uscs_ppzksnark_primary_input<ppT> &,          \
+                                                                       const uscs_ppzksnark_proof<ppT> &);
+
+namespace libsnark {
+
+USCS_PPZKSNARK_INSTANTIATE(extern, alt_bn128_pp)
+USCS_PPZKSNARK_INSTANTIATE(extern, edwards_pp)
+USCS_PPZKSNARK_INSTANTIATE(extern, mnt4_pp)
+USCS_PPZKSNARK_INSTANTIATE(extern, mnt6_pp)
+#ifdef CURVE_BN128
+USCS_PPZKSNARK_INSTANTIATE(extern, bn128_pp)
+#endif
+
+} // libsnark
+
+#endif // NO_EXPLICIT_INSTANTIATION
+
+#endif // USCS_PPZKSNARK_INSTANTIATIONS_HPP_